@@ -0,0 +1,166 @@
+// Memory report of interning YoutubeVideo's repeated fields, over a synthetic subscriptions feed.
+//
+// Usage: bench_string_pool [VIDEOS]   (default 50000)
+//
+// Heap usage is measured by counting the bytes that pass through the global operator new/delete. The interned
+// fields are measured twice: as the handles plus pool they are now, and as the per-video string copies they were.
+
+#include <iostream>
+#include <string>
+#include <list>
+#include <vector>
+#include <memory>
+#include <random>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <entities/youtube_video.hpp>
+#include <entities/string_pool.hpp>
+#include <entities/packed_ids.hpp>
+
+#define BENCH_DEFAULT_VIDEOS    50000
+#define BENCH_CHANNELS          500
+#define BENCH_TAG_VOCABULARY    5000
+#define BENCH_TAGS_PER_VIDEO    8
+
+using namespace sane;
+
+static std::atomic<size_t> g_heapBytes{0};
+
+// Every allocation is prefixed with its size, so delete knows how much is being freed.
+static const size_t HEAP_HEADER = alignof(std::max_align_t);
+
+void *operator new(size_t t_size) {
+    auto *block = static_cast<char *>(std::malloc(t_size + HEAP_HEADER));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<size_t *>(block) = t_size;
+    g_heapBytes += t_size;
+
+    return block + HEAP_HEADER;
+}
+
+void operator delete(void *t_pointer) noexcept {
+    if (t_pointer == nullptr) {
+        return;
+    }
+    char *block = static_cast<char *>(t_pointer) - HEAP_HEADER;
+    g_heapBytes -= *reinterpret_cast<size_t *>(block);
+    std::free(block);
+}
+
+void operator delete(void *t_pointer, size_t) noexcept {
+    operator delete(t_pointer);
+}
+
+/**
+ * The interned fields of a video, the way YoutubeVideo used to hold them: a string copy each.
+ */
+struct copiedFields_t {
+    std::string channelId;
+    std::string channelTitle;
+    std::string categoryId;
+    std::string liveBroadcastContent;
+    std::string defaultLanguage;
+    std::string defaultAudioLanguage;
+    std::string uploadStatus;
+    std::string privacyStatus;
+    std::string license;
+    std::vector<std::string> tags;
+};
+
+struct syntheticVideo_t {
+    std::string id;
+    std::string title;
+    copiedFields_t fields;
+};
+
+static void printMegabytes(const std::string &t_name, size_t t_bytes) {
+    std::cout << t_name << ": " << (double)t_bytes / (1024 * 1024) << " MiB" << std::endl;
+}
+
+int main(int argc, char *argv[]) {
+    size_t videoCount = argc > 1 ? std::stoul(argv[1]) : BENCH_DEFAULT_VIDEOS;
+    std::mt19937_64 random(42);
+
+    const std::vector<std::string> categories = {"1", "2", "10", "15", "17", "19", "20", "22", "23", "24", "25",
+                                                 "26", "27", "28", "29"};
+    const std::vector<std::string> languages = {"en", "en-US", "en-GB", "de", "fr", "ja", "ko", "es", "pt-BR", "no"};
+
+    std::vector<std::string> tagVocabulary;
+    for (int tag = 0; tag < BENCH_TAG_VOCABULARY; tag++) {
+        tagVocabulary.push_back("synthetic tag number " + std::to_string(tag));
+    }
+
+    // Generate the feed up front, so only building the entities is measured.
+    std::vector<syntheticVideo_t> feed(videoCount);
+    for (size_t i = 0; i < videoCount; i++) {
+        auto channel = (uint32_t)(random() % BENCH_CHANNELS);
+        syntheticVideo_t &video = feed[i];
+
+        video.id = VideoId(random()).toString();
+        video.title = "Synthetic video number " + std::to_string(i) + " of a benchmark";
+        video.fields.channelId = ChannelId(0, channel).toString();
+        video.fields.channelTitle = "Synthetic channel number " + std::to_string(channel);
+        video.fields.categoryId = categories[channel % categories.size()];
+        video.fields.liveBroadcastContent = random() % 50 == 0 ? "upcoming" : "none";
+        video.fields.defaultLanguage = languages[channel % languages.size()];
+        video.fields.defaultAudioLanguage = video.fields.defaultLanguage;
+        video.fields.uploadStatus = "processed";
+        video.fields.privacyStatus = "public";
+        video.fields.license = random() % 10 == 0 ? "creativeCommon" : "youtube";
+        for (int tag = 0; tag < BENCH_TAGS_PER_VIDEO; tag++) {
+            video.fields.tags.push_back(tagVocabulary[random() % tagVocabulary.size()]);
+        }
+    }
+
+    std::cout << "Videos: " << videoCount << ", channels: " << BENCH_CHANNELS << ", tag vocabulary: "
+              << BENCH_TAG_VOCABULARY << std::endl;
+
+    // The interned fields as per-video copies.
+    size_t heapBefore = g_heapBytes;
+    std::vector<copiedFields_t> copies;
+    copies.reserve(videoCount);
+    for (const syntheticVideo_t &video : feed) {
+        copies.push_back(video.fields);
+    }
+    size_t copiedBytes = g_heapBytes - heapBefore;
+    copies = std::vector<copiedFields_t>();
+
+    // The feed as YoutubeVideo entities, with the fields interned.
+    heapBefore = g_heapBytes;
+    size_t poolBefore = getStringPool().getBytes();
+    std::list<std::shared_ptr<YoutubeVideo>> videos;
+    for (const syntheticVideo_t &video : feed) {
+        auto entity = std::make_shared<YoutubeVideo>();
+        entity->setId(video.id);
+        entity->setTitle(video.title);
+        entity->setChannelId(video.fields.channelId);
+        entity->setChannelTitle(video.fields.channelTitle);
+        entity->setCategoryId(video.fields.categoryId);
+        entity->setLiveBroadcastContent(video.fields.liveBroadcastContent);
+        entity->setDefaultLanguage(video.fields.defaultLanguage);
+        entity->setDefaultAudioLanguage(video.fields.defaultAudioLanguage);
+        entity->setUploadStatus(video.fields.uploadStatus);
+        entity->setPrivacyStatus(video.fields.privacyStatus);
+        entity->setLicense(video.fields.license);
+        entity->setTags(video.fields.tags);
+        videos.push_back(entity);
+    }
+    size_t feedBytes = g_heapBytes - heapBefore;
+    size_t poolBytes = getStringPool().getBytes() - poolBefore;
+    size_t internedBytes = videoCount * 9 * sizeof(InternedString) + poolBytes;
+    for (const auto &video : videos) {
+        internedBytes += video->getTags().capacity() * sizeof(InternedString);
+    }
+
+    printMegabytes("Interned fields as string copies", copiedBytes);
+    printMegabytes("Interned fields as handles + pool", internedBytes);
+    std::cout << "Unique pooled strings: " << getStringPool().size() << std::endl;
+    printMegabytes("Whole feed (YoutubeVideo entities)", feedBytes);
+    printMegabytes("Whole feed, estimated without interning", feedBytes - internedBytes + copiedBytes);
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+// Scan/filter benchmark of VideoTable over synthetic rows, against the same filters over a list of YoutubeVideo.
+//
+// Usage: bench_video_table [ROWS]   (default 1000000)
+//
+// A YoutubeVideo is about 2 kB, so the row-wise baseline only covers the first BENCH_ENTITY_ROWS rows.
+
+#include <iostream>
+#include <string>
+#include <list>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <functional>
+#include <algorithm>
+
+#include <entities/video_table.hpp>
+#include <entities/youtube_video.hpp>
+
+#define BENCH_DEFAULT_ROWS      1000000
+#define BENCH_ENTITY_ROWS       200000
+#define BENCH_CHANNELS          500
+#define BENCH_REPETITIONS       20
+#define BENCH_START_MS          1262304000000LL     // 2010-01-01.
+#define BENCH_SPAN_MS           315360000000LL      // 10 years.
+
+using namespace sane;
+
+/**
+ * Runs a function a number of times and prints the average time it took.
+ *
+ * @return  What the last run returned, so the work can't be optimized away.
+ */
+static size_t measure(const std::string &t_name, size_t t_rows, const std::function<size_t()> &t_function) {
+    size_t result = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < BENCH_REPETITIONS; i++) {
+        result = t_function();
+    }
+
+    double averageMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+                       / BENCH_REPETITIONS;
+    std::cout << t_name << ": " << averageMs << " ms, " << averageMs * 1e6 / std::max(t_rows, (size_t)1)
+              << " ns/row (" << result << " of " << t_rows << " rows)" << std::endl;
+
+    return result;
+}
+
+int main(int argc, char *argv[]) {
+    size_t rows = argc > 1 ? std::stoul(argv[1]) : BENCH_DEFAULT_ROWS;
+    size_t entityRows = std::min(rows, (size_t)BENCH_ENTITY_ROWS);
+    std::mt19937_64 random(42);
+
+    // Columnar rows.
+    VideoTable table;
+    table.reserve(rows, rows * 48);
+    for (uint32_t channel = 0; channel < BENCH_CHANNELS; channel++) {
+        table.internChannel(ChannelId(0, channel), "Channel " + std::to_string(channel));
+    }
+
+    // The same rows as entities, only the fields the filters look at are set.
+    std::list<std::shared_ptr<YoutubeVideo>> videos;
+
+    for (size_t row = 0; row < rows; row++) {
+        VideoId id(random());
+        auto publishedAtMs = (int64_t)(BENCH_START_MS + random() % BENCH_SPAN_MS);
+        auto channel = (uint32_t)(random() % BENCH_CHANNELS);
+        auto durationSeconds = (uint32_t)(random() % 7200);
+        auto flags = (uint8_t)(random() & (FEED_ITEM_FLAG_HD | FEED_ITEM_FLAG_CAPTIONS));
+        std::string title = "Synthetic video number " + std::to_string(row) + " of a benchmark";
+
+        table.append(id, publishedAtMs, channel, title, durationSeconds, flags);
+
+        if (row >= entityRows) {
+            continue;
+        }
+        auto video = std::make_shared<YoutubeVideo>();
+        video->setId(id.toString());
+        video->setTitle(title);
+        video->setChannelId(ChannelId(0, channel).toString());
+        video->setIsHD((flags & FEED_ITEM_FLAG_HD) != 0);
+        video->setHasCaptions((flags & FEED_ITEM_FLAG_CAPTIONS) != 0);
+        video->setDurationMs(durationSeconds * 1000UL);
+        videos.push_back(video);
+    }
+
+    // A year's worth of HD videos between 5 and 20 minutes long.
+    const int64_t fromMs = BENCH_START_MS + BENCH_SPAN_MS / 2;
+    const int64_t toMs = fromMs + BENCH_SPAN_MS / 10;
+    const uint32_t channel = 7;
+
+    std::cout << "Rows: " << rows << std::endl;
+
+    selection_t lastSelection;
+    measure("VideoTable: date range + HD + duration", rows, [&]() {
+        selection_t selection = table.selectAll();
+        table.filterPublishedBetween(fromMs, toMs, selection);
+        table.filterFlags(FEED_ITEM_FLAG_HD, 0, selection);
+        table.filterDurationBetween(300, 1200, selection);
+        lastSelection = selection;
+
+        return VideoTable::countSelected(selection);
+    });
+    size_t columnar = VideoTable::countSelected(selection_t(lastSelection.begin(),
+                                                            lastSelection.begin() + entityRows));
+
+    measure("VideoTable: single channel", rows, [&]() {
+        selection_t selection = table.selectAll();
+        table.filterChannel(channel, selection);
+
+        return VideoTable::countSelected(selection);
+    });
+
+    // Entities keep their publish date in a datetime_t, which takes a strptime() per row to set. Compare on the
+    // columnar copy instead, the row-wise scan still reads its other fields from the entities.
+    std::vector<int64_t> publishedAtMs;
+    publishedAtMs.reserve(entityRows);
+    for (size_t row = 0; row < entityRows; row++) {
+        publishedAtMs.push_back(table.getPublishedAtMs(row));
+    }
+
+    size_t rowWise = measure("list<shared_ptr<YoutubeVideo>>: date range + HD + duration", entityRows, [&]() {
+        size_t count = 0;
+        size_t row = 0;
+
+        for (const auto &video : videos) {
+            if (publishedAtMs[row] >= fromMs and publishedAtMs[row] <= toMs and video->isHD()
+                and video->getDurationMs() >= 300000 and video->getDurationMs() <= 1200000) {
+                count++;
+            }
+            row++;
+        }
+
+        return count;
+    });
+
+    measure("list<shared_ptr<YoutubeVideo>>: single channel", entityRows, [&]() {
+        size_t count = 0;
+        const std::string channelId = ChannelId(0, channel).toString();
+
+        for (const auto &video : videos) {
+            count += video->getChannelId() == channelId ? 1 : 0;
+        }
+
+        return count;
+    });
+
+    if (columnar != rowWise) {
+        std::cerr << "Result mismatch: " << columnar << " != " << rowWise << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
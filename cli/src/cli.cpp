@@ -108,9 +108,9 @@ namespace sane {
         addCommand(PRINT_CHANNEL_BY_USERNAME, "Retrieve a channel by username.", "NAME", ENTITY_CATEGORY);
         addCommand(PRINT_CHANNEL_BY_ID, "Retrieve and print a channel entity by channel ID.", "CHAN_ID",
                 ENTITY_CATEGORY);
-        addCommand(PRINT_CHANNEL_JSON_BY_USERNAME, "Retrieve and print a channel JSON by username.", "NAME",
+        addCommand(PRINT_CHANNEL_JSON_BY_USERNAME, "Retrieve and print channel JSONs by username.", "NAME...",
                 JSON_CATEGORY);
-        addCommand(PRINT_CHANNEL_JSON_BY_ID, "Retrieve and print a channel JSON by channel ID.", "CHAN_ID",
+        addCommand(PRINT_CHANNEL_JSON_BY_ID, "Retrieve and print channel JSONs by channel ID.", "CHAN_ID...",
                 JSON_CATEGORY);
         addCommand(LIST_ACTIVITIES_JSON, "Returns a list of channel activity events.",
                 "PART... FILTER [PARAM...]", JSON_CATEGORY);
@@ -154,6 +154,10 @@ namespace sane {
         addCommand(PRINT_PLAYLIST_ITEMS, "Prints a table of playlist videos.", "PLAYLIST_ID [PARAM...]", UNCATEGORISED);
         addCommand(PRINT_SUBSCRIPTIONS_FEED, "Prints a table of your subscriptions feed.", "LIMIT PART [PARAM...]",
                 UNCATEGORISED);
+        addCommand(PRINT_TRANSFER_STATS, "Prints per-endpoint wire vs decoded byte counts for this session.",
+                UNCATEGORISED);
+        addCommand(PRINT_QUOTA_USAGE, "Prints today's per-endpoint YouTube API quota usage.",
+                UNCATEGORISED);
 
         // Instantiate the API Handler.
         api = std::make_shared<sane::APIHandler>();
@@ -318,6 +322,10 @@ namespace sane {
             } else {
                 std::cerr << "Error in PRINT_PLAYLIST_ITEMS: invalid argument count: " << args.size() << std::endl;
             }
+        } else if (command == PRINT_TRANSFER_STATS) {
+            printTransferStats();
+        } else if (command == PRINT_QUOTA_USAGE) {
+            printQuotaUsage();
         }
 
     }
@@ -137,11 +137,18 @@ namespace sane {
 
         void printVideosFromApi(const std::vector<std::string> &t_input, bool t_printFullInfo = false);
 
+        void printTransferStats();
+
+        void printQuotaUsage();
+
     private:
         // Internal
         bool manuallyExit = false;
         bool isInteractive = false;
 
+        void printChannelsJsonFromApi(const std::vector<std::string> &t_input, const std::string &t_filterKey,
+                                      const std::string &t_caller, int jsonIndent);
+
         // Define Command names.
         // Internal
         const std::string EXIT = "exit";
@@ -219,6 +226,10 @@ namespace sane {
         // Subscriptions Feed
         // -- Print
         const std::string PRINT_SUBSCRIPTIONS_FEED = "print-subsfeed";
+        // Network statistics
+        // -- Print
+        const std::string PRINT_TRANSFER_STATS = "print-transfer-stats";
+        const std::string PRINT_QUOTA_USAGE = "print-quota-usage";
 
 
         // Map of commands (to be populated)
@@ -15,17 +15,17 @@ namespace sane {
         channels = sane::getChannelsFromDB(NO_ERROR_LOG);
         int counter = 1;  // Humanized counting.
         for (auto & channel : channels) {
-            std::list<std::map<std::string, nlohmann::json>> warnings = channel->getWarnings();
-            std::list<std::map<std::string, nlohmann::json>> errors = channel->getErrors();
+            size_t warningCount = channel->getWarningCount();
+            size_t errorCount = channel->getErrorCount();
 
             std::cout << "Sub#" << counter << ":" << std::endl;
             channel->print(DEFAULT_INDENT);
             // Print any warnings and errors
-            if (!warnings.empty()) {
+            if (warningCount > 0) {
                 std::cout << "Warnings:\n" << std::endl;
                 channel->printWarnings(4);
             }
-            if (!errors.empty()) {
+            if (errorCount > 0) {
                 std::cerr << "Errors:\n" << std::endl;
                 channel->printErrors(4);
             }
@@ -124,21 +124,21 @@ namespace sane {
     void CLI::printVideosFromApi(const std::vector<std::string> &t_input, bool t_printFullInfo) {
         nlohmann::json videosJson = listVideosJsonFromApi(t_input);
         if (!videosJson.empty() and videosJson.find("items") != videosJson.end()) {
-            for (nlohmann::json videoItemJson : videosJson["items"]) {
-                std::shared_ptr<YoutubeVideo> video = std::make_shared<YoutubeVideo>(videoItemJson);
+            for (nlohmann::json &videoItemJson : videosJson["items"]) {
+                std::shared_ptr<YoutubeVideo> video = std::make_shared<YoutubeVideo>(std::move(videoItemJson));
 
-                std::list<std::map<std::string, nlohmann::json>> warnings = video->getWarnings();
-                std::list<std::map<std::string, nlohmann::json>> errors = video->getErrors();
+                size_t warningCount = video->getWarningCount();
+                size_t errorCount = video->getErrorCount();
 
                 // Print video info.
                 video->print(DEFAULT_INDENT, t_printFullInfo);
 
                 // Print any warnings and errors.
-                if (!warnings.empty()) {
+                if (warningCount > 0) {
                     std::cout << "\nWarnings:" << std::endl;
                     video->printWarnings(DEFAULT_INDENT, true);
                 }
-                if (!errors.empty()) {
+                if (errorCount > 0) {
                     std::cout << "\nErrors:" << std::endl;
                     video->printErrors(DEFAULT_INDENT, true);
                 }
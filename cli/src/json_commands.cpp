@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <string>
+#include <future>
 
 #include "cli.hpp"
+#include <concurrency/futures.hpp>
 #include <youtube/toolkit.hpp>
 
 namespace sane {
@@ -78,9 +80,9 @@ namespace sane {
 
     void CLI::printChannelJsonFromApiByName(const std::vector<std::string> &t_input, int jsonIndent) {
         if (t_input.empty()) {
-            std::cout << "Error: no arguments given, required: 1." << std::endl;
+            std::cout << "Error: no arguments given, required: >= 1." << std::endl;
         } else {
-            printChannelJsonFromApiByName(t_input.front(), jsonIndent);
+            printChannelsJsonFromApi(t_input, "forUsername", "printChannelJsonFromApiByName", jsonIndent);
         }
     }
 
@@ -103,9 +105,39 @@ namespace sane {
 
     void CLI::printChannelJsonFromApiById(const std::vector<std::string> &t_input, int jsonIndent) {
         if (t_input.empty()) {
-            std::cout << "Error: no arguments given, required: 1." << std::endl;
+            std::cout << "Error: no arguments given, required: >= 1." << std::endl;
         } else {
-            printChannelJsonFromApiById(t_input.front(), jsonIndent);
+            printChannelsJsonFromApi(t_input, "id", "printChannelJsonFromApiById", jsonIndent);
+        }
+    }
+
+    /**
+     * Looks up several channels concurrently, one request each, and prints them in the order given.
+     *
+     * @param t_input       Usernames or channel IDs.
+     * @param t_filterKey   Filter to look them up by, "forUsername" or "id".
+     * @param t_caller      Name of the calling command, for error messages.
+     * @param jsonIndent
+     */
+    void CLI::printChannelsJsonFromApi(const std::vector<std::string> &t_input, const std::string &t_filterKey,
+                                       const std::string &t_caller, int jsonIndent) {
+        const std::string part = "snippet";
+        std::map<std::string, std::string> optParams;
+        std::vector<std::future<nlohmann::json>> requests;
+
+        optParams["maxResults"] = "1";
+
+        for (const std::string &input : t_input) {
+            requests.push_back(api->youtubeListChannelsFuture(part, {{t_filterKey, input}}, optParams));
+        }
+
+        for (nlohmann::json &channelListJson : whenAll(std::move(requests)).get()) {
+            if (hasItems(channelListJson)) {
+                std::cout << channelListJson["items"][0].dump(jsonIndent) << std::endl;
+            } else {
+                std::cerr << "CLI::" << t_caller << " Error: Result had no items:\n" << channelListJson.dump(4)
+                          << std::endl;
+            }
         }
     }
 
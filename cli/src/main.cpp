@@ -9,10 +9,15 @@
 // Sane++ Project specific
 #include <config.hpp>
 #include <api_handler/api_handler.hpp>
+#include <api_handler/http_context.hpp>
+#include <api_handler/quota.hpp>
 #include <db_handler/db_handler.hpp>
 #include "cli.hpp"
 
 int main(int argc, char *argv[]) {
+    // Set up libcURL globals and the shared DNS/TLS session cache before any worker threads are spawned.
+    sane::HTTPContext::initialize();
+
     // Instantiate the CLI class.
     std::shared_ptr<sane::CLI> cli = std::make_shared<sane::CLI>();
 
@@ -27,5 +32,13 @@ int main(int argc, char *argv[]) {
         // Make the CLI interactive
         cli->interactive();
     }
+
+    // Release the CLI (and with it any libcURL handles it owns) before tearing down libcURL.
+    cli.reset();
+    sane::HTTPContext::cleanup();
+
+    // Persist any quota spent outside of a subscriptions feed refresh.
+    sane::flushQuotaLedger();
+
     return 0;
 }
\ No newline at end of file
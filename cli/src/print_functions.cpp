@@ -1,5 +1,13 @@
 #include <youtube/subfeed.hpp>
+#include <entities/feed_item.hpp>
+#include <entities/video_parts.hpp>
+#include <api_handler/transfer_stats.hpp>
+#include <api_handler/hedging.hpp>
+#include <api_handler/quota.hpp>
+#include <api_handler/circuit_breaker.hpp>
 #include <algorithm>
+#include <iomanip>
+#include <ctime>
 
 #include "cli.hpp"
 
@@ -95,9 +103,26 @@ namespace sane {
         return longestChannelTitleLength;
     }
 
+    /**
+     * Formats a UTC timestamp the way datetime_t::isoDateAndTime is (YYYY-MM-DD HH:MM:SS).
+     */
+    static std::string formatDateAndTime(int64_t t_timestampMs) {
+        auto seconds = (time_t)(t_timestampMs / 1000);
+        std::tm utc = {};
+        char buffer[20];
+
+        gmtime_r(&seconds, &utc);
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S", &utc);
+
+        return std::string(buffer);
+    }
+
     /**
      * Prints the subscriptions feed videos as a nicely indented table.
      *
+     * The table only shows snippet and contentDetails fields, if nothing else is requested the feed is refreshed
+     * as FeedItems (createSubscriptionsFeedItems) instead of full YoutubeVideo entities.
+     *
      * @param t_videoLimit
      * @param t_part
      * @param t_filter
@@ -108,10 +133,36 @@ namespace sane {
                                      const std::map<std::string, std::string> &t_filter,
                                      const std::map<std::string, std::string> &t_optParams) {
         size_t longestChannelTitleLength = getLongestChannelTitleLength();
+        const VideoParts feedItemParts = VideoParts().with(VideoPart::Snippet).with(VideoPart::ContentDetails);
+        const bool feedItemsOnly = (VideoParts::parse(t_part) | feedItemParts) == feedItemParts;
 
         // Get list of subscriptions feed videos.
 //        std::cout << "Retrieving videos from \"uploaded videos\" playlists..." << std::endl;
-        std::list<std::shared_ptr<YoutubeVideo>> videos = createSubscriptionsFeed(t_part, t_filter, t_optParams);
+        refreshStats_t refreshStats;
+        std::list<std::shared_ptr<YoutubeVideo>> videos;
+        FeedChannelTable channels;
+        std::vector<FeedItem> items;
+
+        if (feedItemsOnly) {
+            items = createSubscriptionsFeedItems(channels, t_filter, t_optParams, &refreshStats);
+        } else {
+            videos = createSubscriptionsFeed(t_part, t_filter, t_optParams, &refreshStats);
+        }
+
+        std::cout << "Refreshed " << refreshStats.playlistsCompleted << " playlists in " << refreshStats.elapsedMs
+                  << " ms at concurrency " << refreshStats.concurrency << " (peak " << refreshStats.peakConcurrency
+                  << ", backed off " << refreshStats.concurrencyDecreases << " times)." << std::endl;
+
+        if (refreshStats.budgetExceeded) {
+            std::cout << "NB: Refresh budget exceeded after " << refreshStats.elapsedMs << " ms, feed is partial ("
+                      << refreshStats.playlistsCompleted << "/" << refreshStats.playlistsTotal
+                      << " playlists)." << std::endl;
+        }
+
+        if (refreshStats.playlistsOverQuota > 0) {
+            std::cout << "NB: " << refreshStats.playlistsOverQuota << " playlists were not refreshed, today's quota "
+                      << "budget only had " << refreshStats.quotaRemaining << " units left." << std::endl;
+        }
 
         // Handle any limits (0 == disable limit)
         if (t_videoLimit > 0) {
@@ -123,6 +174,8 @@ namespace sane {
 
             // Replace the original list with the new limited version.
             videos = limited;
+
+            items.resize(std::min((size_t)t_videoLimit, items.size()));
         }
 
         // Printing section
@@ -166,29 +219,109 @@ namespace sane {
                   << hasCaptionsHeading << indent << channelTitleHeading << channelHeadingIndent << indent
                   << videoTitleHeading << std::endl;
         int position = 0;
-        for (const auto& video: videos) {
-            const std::string videoId = video->getId();
-            const std::string videoTitle = video->getTitle();
-            const std::string videoPrivacyStatus = video->getPrivacyStatus();
-            const std::string videoPublishDate = video->getPublishedAt().isoDateAndTime;
-
-            const std::string channelId = video->getChannelId();
-            const std::string channelTitle = video->getChannelTitle();
-            const std::string definition = video->isHD() ? "HD" : "SD";
-            const std::string hasCaptions = video->hasCaptions() ? "Yes." : "No.";
+        auto printItem = [&](const std::string &t_publishDate, const std::string &t_videoId, bool t_isHD,
+                             bool t_hasCaptions, const std::string &t_channelTitle, const std::string &t_videoTitle) {
+            const std::string definition = t_isHD ? "HD" : "SD";
+            const std::string hasCaptions = t_hasCaptions ? "Yes." : "No.";
 
             // Per-item offsets.
             const std::string definitionOffset = std::string(definitionHeading.length() - definition.length(), ' ');
             const std::string hasCaptionsOffset = std::string(hasCaptionsHeading.length() - hasCaptions.length(), ' ');
-            const std::string channelTitleOffset = std::string(longestChannelTitleLength - channelTitle.length(), ' ');
+            const std::string channelTitleOffset = std::string(longestChannelTitleLength - t_channelTitle.length(),
+                                                               ' ');
 
             // Print table item.
-            std::cout << position << "\t" << videoPublishDate << indent
-                      << youtubeVideoURLBase << videoId << indent
+            std::cout << position << "\t" << t_publishDate << indent
+                      << youtubeVideoURLBase << t_videoId << indent
                       << definition << definitionOffset << indent << hasCaptions << hasCaptionsOffset << indent
-                      << channelTitle << channelTitleOffset << indent << videoTitle << std::endl;
+                      << t_channelTitle << channelTitleOffset << indent << t_videoTitle << std::endl;
 
             position++;
+        };
+
+        for (const auto& video: videos) {
+            printItem(video->getPublishedAt().isoDateAndTime, video->getId(), video->isHD(), video->hasCaptions(),
+                      video->getChannelTitle(), video->getTitle());
+        }
+
+        for (const auto& item: items) {
+            printItem(formatDateAndTime(item.getPublishedAtMs()), item.getId(), item.isHD(), item.hasCaptions(),
+                      channels.getChannelTitle(item.getChannel()), item.getTitle());
+        }
+    }
+    /**
+     * Prints a table of per-endpoint transfer sizes and latencies,
+     * showing how much Accept-Encoding compression saved and how often requests were hedged.
+     */
+    void CLI::printTransferStats() {
+        std::map<std::string, transferStats_t> stats = getTransferStats();
+        std::map<std::string, long> latencies = getLatencyPercentiles(HEDGING_DEFAULT_PERCENTILE);
+
+        if (stats.empty()) {
+            std::cout << "No API requests have been made yet." << std::endl;
+            return;
+        }
+
+        unsigned long long totalWireBytes = 0;
+        unsigned long long totalDecodedBytes = 0;
+
+        std::cout << "Requests\tWire bytes\tDecoded bytes\tRatio\tp" << HEDGING_DEFAULT_PERCENTILE << " ms\tEndpoint"
+                  << std::endl;
+        for (const auto& entry : stats) {
+            const transferStats_t &endpointStats = entry.second;
+            double ratio = endpointStats.decodedBytes > 0 ?
+                    (double)endpointStats.wireBytes / (double)endpointStats.decodedBytes : 0.0;
+
+            std::cout << endpointStats.requests << "\t\t" << endpointStats.wireBytes << "\t\t"
+                      << endpointStats.decodedBytes << "\t\t" << std::setprecision(3) << ratio << "\t"
+                      << (latencies.find(entry.first) != latencies.end() ? latencies[entry.first] : -1) << "\t"
+                      << entry.first << std::endl;
+
+            totalWireBytes += endpointStats.wireBytes;
+            totalDecodedBytes += endpointStats.decodedBytes;
+        }
+
+        std::cout << "Total: " << totalWireBytes << " bytes on the wire, " << totalDecodedBytes << " bytes decoded";
+        if (totalDecodedBytes > totalWireBytes) {
+            std::cout << " (saved " << totalDecodedBytes - totalWireBytes << " bytes)";
+        }
+        std::cout << "." << std::endl;
+
+        hedgingStats_t hedging = getHedgingStats();
+        if (hedging.hedgesIssued > 0) {
+            std::cout << "Hedged requests: " << hedging.hedgesIssued << " issued, " << hedging.hedgesWon
+                      << " answered first (" << hedging.quotaSpent << " extra quota units)." << std::endl;
+        }
+
+        unsigned long coalesced = APIHandler::getCoalescedRequestCount();
+        if (coalesced > 0) {
+            std::cout << "Coalesced requests: " << coalesced << " answered by an identical request already in flight."
+                      << std::endl;
+        }
+
+        for (const auto& circuit : getCircuitStates()) {
+            unsigned long shortCircuits = getCircuitBreaker(circuit.first).getShortCircuitCount();
+            if (circuit.second != CircuitState::Closed or shortCircuits > 0) {
+                std::cout << "Circuit " << circuitStateToString(circuit.second) << ": " << circuit.first << " ("
+                          << shortCircuits << " requests failed fast)." << std::endl;
+            }
+        }
+    }
+
+    void CLI::printQuotaUsage() {
+        std::map<std::string, long> usage = getQuotaUsageToday();
+        long used = 0;
+
+        std::cout << "Units\tEndpoint" << std::endl;
+        for (const auto& entry : usage) {
+            std::cout << entry.second << "\t" << entry.first << std::endl;
+            used += entry.second;
+        }
+
+        std::cout << "Total: " << used << " quota units used today (" << getQuotaDay(std::time(nullptr)) << ")";
+        if (getQuotaSettings().dailyLimit > 0) {
+            std::cout << ", " << getRemainingQuota() << " of " << getQuotaSettings().dailyLimit << " left";
         }
+        std::cout << "." << std::endl;
     }
 } // namespace sane
\ No newline at end of file
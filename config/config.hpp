@@ -0,0 +1,20 @@
+#ifndef SANE_CONFIG_HPP
+#define SANE_CONFIG_HPP
+
+/** Name and versioning. */
+#define PROJECT_NAME "Sane++"
+#define PROJECT_VER  "0.3.0"
+#define PROJECT_VER_MAJOR "0"
+#define PROJECT_VER_MINOR "3"
+#define PROJECT_VER_PATCH "0"
+#define PROJECT_BUILD_DATE "2026-10-19 01:52:26"
+
+/** git info. */
+// The short commit hash, with a trailing + if there are uncommitted changes.
+#define PROJECT_GIT_REV "bf2527f+"
+// The tag (if any).
+#define PROJECT_GIT_TAG ""
+// The current branch.
+#define PROJECT_GIT_BRANCH "master"
+
+#endif //SANE_CONFIG_HPP
@@ -5,11 +5,24 @@
 #define SANEPP_API_HANDLER_HEADER
 
 #include <list>
+#include <future>
+#include <functional>
 
+#include <curl/curl.h>
 #include <nlohmann/json.hpp>
 #include <yhirose/httplib.h>
 
 #include <entities/youtube_channel.hpp>
+#include <api_handler/request_context.hpp>
+#include <api_handler/hedging.hpp>
+#include <api_handler/retry_policy.hpp>
+#include <api_handler/quota.hpp>
+#include <api_handler/circuit_breaker.hpp>
+#include <concurrency/work_stealing_scheduler.hpp>
+#ifdef SANE_ENABLE_COROUTINES
+#include <concurrency/task.hpp>
+#include <api_handler/event_loop.hpp>
+#endif
 
 #define CLEAR_PROBLEMS true
 #define DONT_CLEAR_PROBLEMS false
@@ -50,9 +63,78 @@
 #define OAUTH2_DEFAULT_REFRESH_URI                 "https://accounts.google.com/o/oauth2/token"
 #define OAUTH2_DEFAULT_RESPONSE_TYPE               "code"
 
+// Transport limits (overridable in the config's "network" section).
+#define NETWORK_DEFAULT_CONNECT_TIMEOUT_MS         10000
+#define NETWORK_DEFAULT_TRANSFER_TIMEOUT_MS        30000
+#define NETWORK_DEFAULT_LOW_SPEED_LIMIT            1      // Bytes per second, ...
+#define NETWORK_DEFAULT_LOW_SPEED_TIME             15     // ...sustained for this many seconds aborts the transfer.
+#define NETWORK_DEFAULT_COALESCE_REQUESTS          1      // Identical concurrent requests share one round trip.
+
 namespace sane {
+    struct networkSettings_t {
+        long connectTimeoutMs = NETWORK_DEFAULT_CONNECT_TIMEOUT_MS;
+        long transferTimeoutMs = NETWORK_DEFAULT_TRANSFER_TIMEOUT_MS;
+        long lowSpeedLimit = NETWORK_DEFAULT_LOW_SPEED_LIMIT;
+        long lowSpeedTime = NETWORK_DEFAULT_LOW_SPEED_TIME;
+        bool coalesceRequests = NETWORK_DEFAULT_COALESCE_REQUESTS;
+    };
+
+    /**
+     * A parsed API response along with how the request went, as handed to every coalesced caller.
+     */
+    struct sharedResponse_t {
+        std::shared_ptr<const nlohmann::json> json;
+        FailureKind failure = FailureKind::None;
+        // Whether the request was cut short by the caller that made it (cancelled or out of time).
+        bool aborted = false;
+    };
+
+    /**
+     * A raw API response body along with how the request went, as handed to every coalesced caller.
+     */
+    struct sharedResponseBody_t {
+        std::shared_ptr<const std::string> body;
+        FailureKind failure = FailureKind::None;
+        // Whether the request was cut short by the caller that made it (cancelled or out of time).
+        bool aborted = false;
+    };
+
+    /**
+     * Outcome of a (possibly hedged) libcURL transfer.
+     */
+    struct transferResult_t {
+        CURLcode result = CURLE_OK;
+        long responseCode = 0;
+        curl_off_t wireBytes = 0;
+        curl_off_t retryAfterSeconds = 0;
+        // Time the winning transfer itself took (CURLINFO_TOTAL_TIME_T), -1 if unknown.
+        long transferMs = -1;
+        bool hedged = false;
+        bool hedgeWon = false;
+    };
+
     class APIHandler {
     public:
+        APIHandler();
+
+        explicit APIHandler(const requestContext_t &t_context);
+
+        // Owns a libcURL easy handle, so it must not be copied.
+        APIHandler(const APIHandler &) = delete;
+        APIHandler &operator=(const APIHandler &) = delete;
+
+        ~APIHandler();
+
+        void setRequestContext(const requestContext_t &t_context);
+
+        const requestContext_t &getRequestContext() const;
+
+        FailureKind getLastFailure() const;
+
+        unsigned long getOverloadSignalCount() const;
+
+        long getAverageTransferMs() const;
+
         /** OAuth2 */
         void updateOAuth2TokenConfig(nlohmann::json &t_response);
 
@@ -81,6 +163,14 @@ namespace sane {
 
         nlohmann::json getOAuth2Response(const std::string &url);
 
+        std::shared_ptr<const nlohmann::json> getSharedOAuth2Response(const std::string &t_url);
+
+        std::string getOAuth2ResponseBody(const std::string &url);
+
+        std::shared_ptr<const std::string> getSharedOAuth2ResponseBody(const std::string &t_url);
+
+        static unsigned long getCoalescedRequestCount();
+
         /** Other */
 
         void printReport(int t_warningsCount, int t_errorsCount);
@@ -90,10 +180,16 @@ namespace sane {
         static std::string compileUrlVariables(const std::list<std::map<std::string, std::string>> &t_variableMaps,
                 bool t_isBeginning = false);
 
+        static std::string normalizeRequestUrl(const std::string &t_url);
+
         static std::string compileUrlVariables(const std::list<std::string> &t_variableValues);
 
         void getSubscriptionsEntities(bool clearProblems = CLEAR_PROBLEMS);
 
+#ifdef SANE_ENABLE_COROUTINES
+        Task<void> getSubscriptionsEntitiesAsync(EventLoop &t_loop, bool t_clearProblems = CLEAR_PROBLEMS);
+#endif
+
         /** YouTube API https://www.googleapis.com/youtube/v3/ */
         nlohmann::json youtubeListActivities(const std::string &t_part,
                                              const std::map<std::string, std::string> &t_filter,
@@ -157,7 +253,166 @@ namespace sane {
                                          const std::map<std::string, std::string> &t_filter,
                                          const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
 
+        std::shared_ptr<const std::string> youtubeListVideosBody(const std::string &t_part,
+                                                                 const std::map<std::string, std::string> &t_filter,
+                                                                 const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        /** Future-based API, every request runs on the shared executor (see getApiExecutor). */
+        std::future<nlohmann::json> submitRequest(std::function<nlohmann::json(APIHandler &)> t_request);
+
+        void submitRequest(std::function<nlohmann::json(APIHandler &)> t_request,
+                           std::function<void(nlohmann::json)> t_continuation);
+
+        std::future<nlohmann::json> youtubeListActivitiesFuture(const std::string &t_part,
+                                                                const std::map<std::string, std::string> &t_filter,
+                                                                const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListCaptionsFuture(const std::string &t_part,
+                                                              const std::string &t_videoId,
+                                                              const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListChannelsFuture(const std::string &t_part,
+                                                              const std::map<std::string, std::string> &t_filter,
+                                                              const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListChannelSectionsFuture(const std::string &t_part,
+                                                                     const std::map<std::string, std::string> &t_filter,
+                                                                     const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListCommentsFuture(const std::string &t_part,
+                                                              const std::map<std::string, std::string> &t_filter,
+                                                              const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListCommentThreadsFuture(const std::string &t_part,
+                                                                    const std::map<std::string, std::string> &t_filter,
+                                                                    const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListGuideCategoriesFuture(const std::string &t_part,
+                                                                     const std::map<std::string, std::string> &t_filter,
+                                                                     const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListI18nLanguagesFuture(const std::string &t_part,
+                                                                   const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListI18nRegionsFuture(const std::string &t_part,
+                                                                 const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListPlaylistItemsFuture(const std::string &t_part,
+                                                                   const std::map<std::string, std::string> &t_filter,
+                                                                   const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListPlaylistsFuture(const std::string &t_part,
+                                                               const std::map<std::string, std::string> &t_filter,
+                                                               const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListSubscriptionsFuture(const std::string &t_part,
+                                                                   const std::map<std::string, std::string> &t_filter,
+                                                                   const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListVideoAbuseReportReasonsFuture(const std::string &t_part,
+                                                                             const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListVideoCategoriesFuture(const std::string &t_part,
+                                                                     const std::map<std::string, std::string> &t_filter,
+                                                                     const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeListVideosFuture(const std::string &t_part,
+                                                            const std::map<std::string, std::string> &t_filter,
+                                                            const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeSearchFuture(
+                const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+        std::future<nlohmann::json> youtubeSearchFilteredFuture(const std::map<std::string, std::string> &t_filter,
+                                                                const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>());
+
+#ifdef SANE_ENABLE_COROUTINES
+        /** Awaitable API, every request runs on the given EventLoop (arguments are copied into the coroutine). */
+        Task<std::string> getOAuth2ResponseBodyAsync(EventLoop &t_loop, std::string t_url);
+
+        Task<nlohmann::json> getOAuth2ResponseAsync(EventLoop &t_loop, std::string t_url);
+
+        Task<nlohmann::json> youtubeListAsync(EventLoop &t_loop, std::string t_endpoint, std::string t_part,
+                                              std::map<std::string, std::string> t_filter,
+                                              std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>());
+
+        Task<nlohmann::json> youtubeListChannelsAsync(EventLoop &t_loop, std::string t_part,
+                                                      std::map<std::string, std::string> t_filter,
+                                                      std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>());
+
+        Task<nlohmann::json> youtubeListPlaylistItemsAsync(EventLoop &t_loop, std::string t_part,
+                                                           std::map<std::string, std::string> t_filter,
+                                                           std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>());
+
+        Task<nlohmann::json> youtubeListSubscriptionsAsync(EventLoop &t_loop, std::string t_part,
+                                                           std::map<std::string, std::string> t_filter,
+                                                           std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>());
+
+        Task<nlohmann::json> youtubeListVideosAsync(EventLoop &t_loop, std::string t_part,
+                                                    std::map<std::string, std::string> t_filter,
+                                                    std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>());
+#endif
+
     private:
+        CURL *getEasyHandle();
+
+        void storeSubscriptionsEntities(std::list<std::shared_ptr<YoutubeChannel>> &t_channels,
+                                        size_t t_warningsCount, size_t t_errorsCount, bool t_clearProblems);
+
+        void loadNetworkSettings();
+
+        void applyTransportOptions(CURL *t_curl);
+
+        nlohmann::json fetchOAuth2Response(const std::string &url);
+
+        static nlohmann::json parseResponseBody(const std::string &t_body);
+
+        std::string getAccessToken();
+
+        void prepareRequest(CURL *t_curl, const std::string &t_url, curl_slist *t_headers, std::string *t_readBuffer);
+
+        static curl_slist *makeRequestHeaders(const std::string &t_accessToken);
+
+        FailureKind recordAttempt(CircuitBreaker &t_breaker, const std::string &t_url,
+                                  const transferResult_t &t_transfer, const std::string &t_readBuffer);
+
+        long getRetryDelayMs(const std::string &t_url, const transferResult_t &t_transfer, FailureKind &t_failure,
+                             int t_attempt);
+
+        std::string finishRequest(const std::string &t_url, const transferResult_t &t_transfer,
+                                  FailureKind t_failure, bool t_circuitOpen, bool t_quotaRefused,
+                                  std::string &t_readBuffer);
+
+        transferResult_t performRequest(CURL *t_curl, const std::string &t_url, std::string &t_readBuffer);
+
+        transferResult_t performHedgedRequest(CURL *t_curl, const std::string &t_url, std::string &t_readBuffer,
+                                             long t_hedgeDelayMs);
+
+        static void readTransferInfo(CURL *t_curl, transferResult_t &t_transfer);
+
+        static int transferProgressCallback(void *t_clientp, curl_off_t t_dltotal, curl_off_t t_dlnow,
+                                            curl_off_t t_ultotal, curl_off_t t_ulnow);
+
+        // Deadline and cancellation applied to every request made by this instance.
+        requestContext_t m_context;
+
+        // Timeouts, hedging and retry policy, read from config on first use.
+        networkSettings_t m_networkSettings;
+        hedgingSettings_t m_hedgingSettings;
+        retryPolicy_t m_retryPolicy;
+        bool m_networkSettingsLoaded = false;
+
+        FailureKind m_lastFailure = FailureKind::None;
+        unsigned long m_overloadSignals = 0;
+
+        // Time spent in successful transfers, without quota, back-off or hedge waits (see getAverageTransferMs).
+        long m_transferMs = 0;
+        unsigned long m_timedTransfers = 0;
+
+        // Easy handle kept alive across requests so its connection (and TLS session) can be reused.
+        CURL *m_curl = nullptr;
     };
+
+    WorkStealingScheduler &getApiExecutor();
 } // namespace sane.
 #endif // Header guards.
\ No newline at end of file
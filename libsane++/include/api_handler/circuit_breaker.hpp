@@ -0,0 +1,201 @@
+#ifndef SANE_CIRCUIT_BREAKER_HPP
+#define SANE_CIRCUIT_BREAKER_HPP
+
+#include <string>
+#include <map>
+#include <list>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <iterator>
+
+#include <nlohmann/json.hpp>
+
+// Circuit breaker defaults (overridable in the config's "network/circuit_breaker" section).
+#define CIRCUIT_BREAKER_DEFAULT_ENABLED             1
+#define CIRCUIT_BREAKER_DEFAULT_WINDOW_SIZE         20      // Most recent outcomes the failure rate is computed over.
+#define CIRCUIT_BREAKER_DEFAULT_MIN_REQUESTS        10      // Don't judge an endpoint on fewer outcomes than this.
+#define CIRCUIT_BREAKER_DEFAULT_FAILURE_RATE        50      // Percent of failures in the window that opens the circuit.
+#define CIRCUIT_BREAKER_DEFAULT_OPEN_MS             30000   // Time to fail fast before probing again.
+#define CIRCUIT_BREAKER_DEFAULT_HALF_OPEN_PROBES    1       // Requests let through at a time while half-open.
+
+// Last good responses kept around to be served while a circuit is open.
+#define RESPONSE_CACHE_DEFAULT_MAX_ENTRIES          4096
+#define RESPONSE_CACHE_DEFAULT_MAX_BYTES            (8 * 1024 * 1024)   // Approximate memory held by the responses.
+#define RESPONSE_CACHE_DEFAULT_CACHE_BODIES         0       // Also keep raw (unparsed) bodies, e.g. videos.list().
+
+namespace sane {
+    enum class CircuitState {
+        Closed,     // Requests flow normally.
+        Open,       // Requests fail fast without being sent.
+        HalfOpen    // A few probe requests are let through to see if the endpoint has recovered.
+    };
+
+    struct circuitBreakerSettings_t {
+        bool enabled = CIRCUIT_BREAKER_DEFAULT_ENABLED;
+        size_t windowSize = CIRCUIT_BREAKER_DEFAULT_WINDOW_SIZE;
+        size_t minRequests = CIRCUIT_BREAKER_DEFAULT_MIN_REQUESTS;
+        int failureRate = CIRCUIT_BREAKER_DEFAULT_FAILURE_RATE;
+        long openMs = CIRCUIT_BREAKER_DEFAULT_OPEN_MS;
+        int halfOpenProbes = CIRCUIT_BREAKER_DEFAULT_HALF_OPEN_PROBES;
+        size_t responseCacheMaxBytes = RESPONSE_CACHE_DEFAULT_MAX_BYTES;
+        bool cacheResponseBodies = RESPONSE_CACHE_DEFAULT_CACHE_BODIES;
+    };
+
+    class CircuitBreaker {
+    public:
+        explicit CircuitBreaker(const std::string &t_name,
+                                const circuitBreakerSettings_t &t_settings = circuitBreakerSettings_t());
+
+        bool allowRequest();
+
+        void recordSuccess();
+
+        void recordFailure();
+
+        void recordAbandoned();
+
+        CircuitState getState();
+
+        unsigned long getShortCircuitCount();
+
+    private:
+        void recordOutcome(bool t_failed);
+
+        void open();
+
+        std::mutex m_mutex;
+        std::string m_name;
+        circuitBreakerSettings_t m_settings;
+        CircuitState m_state = CircuitState::Closed;
+
+        // Ring buffer of the most recent outcomes (true = failed).
+        std::vector<bool> m_outcomes;
+        size_t m_nextOutcome = 0;
+
+        std::chrono::steady_clock::time_point m_openUntil;
+        int m_probesInFlight = 0;
+        unsigned long m_shortCircuits = 0;
+    };
+
+    size_t getResponseSize(const nlohmann::json &t_response);
+
+    size_t getResponseSize(const std::string &t_response);
+
+    /**
+     * Bounded map of request key to its last good response, oldest entries are evicted first.
+     *
+     * Bounded both by the number of entries and by the (approximate) memory the responses hold, a single response
+     * larger than the latter isn't kept at all.
+     *
+     * @tparam T    Response type: parsed JSON (ResponseCache) or the raw body (ResponseBodyCache).
+     */
+    template<typename T>
+    class BasicResponseCache {
+    public:
+        explicit BasicResponseCache(size_t t_maxEntries = RESPONSE_CACHE_DEFAULT_MAX_ENTRIES,
+                                    size_t t_maxBytes = RESPONSE_CACHE_DEFAULT_MAX_BYTES) {
+            m_maxEntries = t_maxEntries;
+            m_maxBytes = t_maxBytes;
+        }
+
+        void put(const std::string &t_key, const std::shared_ptr<const T> &t_response) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (m_maxEntries == 0 or t_response == nullptr) {
+                return;
+            }
+
+            const size_t bytes = t_key.size() + getResponseSize(*t_response);
+
+            // Whatever was kept for this key before is outdated either way.
+            erase(t_key);
+
+            if (bytes > m_maxBytes) {
+                return;
+            }
+
+            m_insertionOrder.push_back(t_key);
+            m_entries[t_key] = {t_response, bytes, std::prev(m_insertionOrder.end())};
+            m_bytes += bytes;
+
+            while (m_entries.size() > m_maxEntries or m_bytes > m_maxBytes) {
+                erase(m_insertionOrder.front());
+            }
+        }
+
+        /**
+         * @param t_key Request key.
+         * @return      Last good response, or nullptr if there is none.
+         */
+        std::shared_ptr<const T> get(const std::string &t_key) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            auto entry = m_entries.find(t_key);
+
+            return entry != m_entries.end() ? entry->second.response : nullptr;
+        }
+
+        size_t size() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            return m_entries.size();
+        }
+
+        /**
+         * @return  Approximate memory held by the cached responses (and their keys), in bytes.
+         */
+        size_t getBytes() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            return m_bytes;
+        }
+
+    private:
+        struct entry_t {
+            std::shared_ptr<const T> response;
+            size_t bytes;
+            // Where the key is in m_insertionOrder.
+            std::list<std::string>::iterator position;
+        };
+
+        /**
+         * Drops an entry, the mutex must be held.
+         */
+        void erase(const std::string &t_key) {
+            auto entry = m_entries.find(t_key);
+            if (entry == m_entries.end()) {
+                return;
+            }
+
+            m_bytes -= entry->second.bytes;
+            m_insertionOrder.erase(entry->second.position);
+            m_entries.erase(entry);
+        }
+
+        std::mutex m_mutex;
+        size_t m_maxEntries;
+        size_t m_maxBytes;
+        size_t m_bytes = 0;
+        std::map<std::string, entry_t> m_entries;
+        std::list<std::string> m_insertionOrder;
+    };
+
+    using ResponseCache = BasicResponseCache<nlohmann::json>;
+    using ResponseBodyCache = BasicResponseCache<std::string>;
+
+    const char *circuitStateToString(CircuitState t_state);
+
+    circuitBreakerSettings_t getCircuitBreakerSettings();
+
+    CircuitBreaker &getCircuitBreaker(const std::string &t_endpoint);
+
+    std::map<std::string, CircuitState> getCircuitStates();
+
+    ResponseCache &getStaleResponseCache();
+
+    ResponseBodyCache &getStaleResponseBodyCache();
+} // namespace sane
+
+#endif //SANE_CIRCUIT_BREAKER_HPP
@@ -0,0 +1,200 @@
+#ifndef SANE_EVENT_LOOP_HPP
+#define SANE_EVENT_LOOP_HPP
+
+// Only available in builds configured with -DSanePP_EnableCoroutines=ON (C++20).
+#ifdef SANE_ENABLE_COROUTINES
+
+#include <coroutine>
+#include <chrono>
+#include <map>
+#include <list>
+#include <vector>
+#include <optional>
+#include <functional>
+
+#include <curl/curl.h>
+
+#include <concurrency/task.hpp>
+
+#define EVENT_LOOP_MAX_POLL_MS      1000    // Longest the loop sleeps without checking on timers and cancellation.
+#define EVENT_LOOP_QUOTA_POLL_MS    50      // How often a request waiting on the quota token bucket checks again.
+
+#define EVENT_LOOP_POLL_IN          0x1     // Descriptor is to be watched for (or has) data to read.
+#define EVENT_LOOP_POLL_OUT         0x2     // Descriptor is to be watched for (or is ready for) writing.
+
+namespace sane {
+    /**
+     * A file descriptor the host loop has to watch, along with which EVENT_LOOP_POLL_* events.
+     */
+    struct pollDescriptor_t {
+        int fd;
+        int events;
+    };
+
+    /**
+     * Called when the loop starts watching a descriptor, changes its events, or stops watching it (events 0).
+     */
+    typedef std::function<void(int t_fd, int t_events)> watchCallback_t;
+
+    /**
+     * Single-threaded event loop that drives libcURL transfers and timers for coroutines.
+     *
+     * Every transfer awaited on the loop runs on one curl_multi handle, so thousands of request flows can be in
+     * flight at once on the thread that calls run(), without a thread (or a blocked curl_easy_perform) each.
+     *
+     * The loop can drive itself (run(), runUntilComplete()) or be embedded in a host loop such as Qt's, GTK's or
+     * a plain epoll one, libcURL's multi socket model style: the host watches getPollDescriptors() (or keeps
+     * up with them through setWatchCallback()), hands activity to processEvents(fd, events) and calls
+     * processEvents() once getTimeoutMs() has passed. Everything then runs on the host's thread, in small steps.
+     *
+     * Not thread-safe: tasks are spawned, awaitables used and events processed only from the loop's own thread.
+     */
+    class EventLoop {
+    public:
+        /**
+         * Awaitable that adds an easy handle to the loop and resumes the coroutine once the transfer is done.
+         *
+         * Destroying the suspended coroutine (e.g. the Task awaiting it) takes the transfer off the loop.
+         */
+        struct transferAwaiter {
+            EventLoop &loop;
+            CURL *curl;
+            CURLcode result = CURLE_OK;
+            std::coroutine_handle<> handle;
+            // The transfer is done, the coroutine is about to be resumed.
+            bool completed = false;
+
+            ~transferAwaiter();
+
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            bool await_suspend(std::coroutine_handle<> t_handle);
+
+            CURLcode await_resume() const noexcept {
+                return result;
+            }
+        };
+
+        /**
+         * Awaitable that resumes the coroutine once a point in time has passed.
+         *
+         * Destroying the suspended coroutine takes the timer off the loop.
+         */
+        struct sleepAwaiter {
+            EventLoop &loop;
+            std::chrono::steady_clock::time_point wakeAt;
+            std::coroutine_handle<> handle;
+
+            ~sleepAwaiter();
+
+            bool await_ready() const noexcept {
+                return wakeAt <= std::chrono::steady_clock::now();
+            }
+
+            void await_suspend(std::coroutine_handle<> t_handle);
+
+            void await_resume() const noexcept {}
+        };
+
+        EventLoop();
+
+        EventLoop(const EventLoop &) = delete;
+        EventLoop &operator=(const EventLoop &) = delete;
+
+        ~EventLoop();
+
+        transferAwaiter transfer(CURL *t_curl);
+
+        sleepAwaiter sleepFor(std::chrono::milliseconds t_duration);
+
+        void spawn(Task<void> t_task);
+
+        void run();
+
+        /**
+         * Runs the loop until the given task is done, along with whatever else has been spawned meanwhile.
+         *
+         * @param t_task    Task to run.
+         * @return          Its result (rethrows whatever exception escaped it).
+         */
+        template<typename T>
+        T runUntilComplete(Task<T> t_task) {
+            t_task.start();
+
+            while (!t_task.done()) {
+                runOnce();
+            }
+
+            return t_task.result();
+        }
+
+        void wakeup();
+
+        std::vector<pollDescriptor_t> getPollDescriptors() const;
+
+        void setWatchCallback(watchCallback_t t_callback);
+
+        long getTimeoutMs() const;
+
+        void processEvents(int t_fd, int t_events);
+
+        void processEvents();
+
+        bool hasPendingWork() const;
+
+        size_t getActiveTransferCount() const;
+
+        size_t getPeakTransferCount() const;
+
+        void resetPeakTransferCount();
+
+        size_t getPendingTaskCount() const;
+
+    private:
+        static int socketCallback(CURL *t_curl, curl_socket_t t_socket, int t_what, void *t_userp, void *t_socketp);
+
+        static int timerCallback(CURLM *t_multi, long t_timeoutMs, void *t_userp);
+
+        void runOnce();
+
+        void socketAction(curl_socket_t t_socket, int t_eventBitmask);
+
+        void resumeDueTimers();
+
+        void reapSpawned();
+
+        CURLM *m_multi = nullptr;
+
+        // Sockets libcURL wants watched, and the EVENT_LOOP_POLL_* events for each.
+        std::map<curl_socket_t, int> m_sockets;
+
+        // When libcURL wants CURL_SOCKET_TIMEOUT handled next, if at all.
+        std::optional<std::chrono::steady_clock::time_point> m_curlTimeoutAt;
+
+        // When transfers are next driven regardless of activity, so their progress callbacks notice cancellation.
+        std::chrono::steady_clock::time_point m_nextHousekeeping;
+
+        // Self-pipe that wakeup() writes to, its read end is one of the poll descriptors.
+        int m_wakeupPipe[2] = {-1, -1};
+
+        watchCallback_t m_watchCallback;
+
+        // Transfers in flight, and the awaiter (living in the suspended coroutine's frame) to resume for each.
+        std::map<CURL*, transferAwaiter*> m_transfers;
+
+        // High-water mark of m_transfers.
+        size_t m_peakTransfers = 0;
+
+        // Sleeping coroutines (the awaiter in the suspended coroutine's frame) by wake-up time.
+        std::multimap<std::chrono::steady_clock::time_point, sleepAwaiter*> m_timers;
+
+        // Top-level tasks nobody awaits, kept alive until they're done.
+        std::list<Task<void>> m_spawned;
+    };
+} // namespace sane
+
+#endif // SANE_ENABLE_COROUTINES
+
+#endif //SANE_EVENT_LOOP_HPP
@@ -0,0 +1,49 @@
+#ifndef SANE_HEDGING_HPP
+#define SANE_HEDGING_HPP
+
+#include <string>
+#include <map>
+
+// Number of recent latency samples kept per endpoint.
+#define LATENCY_WINDOW_SIZE          256
+
+// Hedging defaults (overridable in the config's "network/hedging" section).
+#define HEDGING_DEFAULT_ENABLED      0      // Opt-in.
+#define HEDGING_DEFAULT_PERCENTILE   95
+#define HEDGING_DEFAULT_MIN_SAMPLES  20     // Don't trust a percentile computed from fewer samples than this.
+#define HEDGING_DEFAULT_MIN_DELAY_MS 100    // Never hedge sooner than this, whatever the percentile says.
+#define HEDGING_DEFAULT_QUOTA_BUDGET 100    // Quota units that may be spent on duplicate requests per session.
+
+namespace sane {
+    struct hedgingSettings_t {
+        bool enabled = HEDGING_DEFAULT_ENABLED;
+        int percentile = HEDGING_DEFAULT_PERCENTILE;
+        size_t minSamples = HEDGING_DEFAULT_MIN_SAMPLES;
+        long minDelayMs = HEDGING_DEFAULT_MIN_DELAY_MS;
+        long quotaBudget = HEDGING_DEFAULT_QUOTA_BUDGET;
+    };
+
+    struct hedgingStats_t {
+        unsigned long hedgesIssued{};
+        unsigned long hedgesWon{};
+        long quotaSpent{};
+    };
+
+    void recordLatency(const std::string &t_endpoint, long t_milliseconds);
+
+    long getLatencyPercentile(const std::string &t_endpoint, int t_percentile, size_t t_minSamples = 1);
+
+    std::map<std::string, long> getLatencyPercentiles(int t_percentile);
+
+    bool tryAcquireHedge(long t_quotaCost, long t_quotaBudget);
+
+    void refundHedge(long t_quotaCost);
+
+    void recordHedgeWon();
+
+    hedgingStats_t getHedgingStats();
+
+    void resetLatencyTracking();
+} // namespace sane
+
+#endif //SANE_HEDGING_HPP
@@ -0,0 +1,40 @@
+#ifndef SANE_HTTP_CONTEXT_HPP
+#define SANE_HTTP_CONTEXT_HPP
+
+#include <mutex>
+
+#include <curl/curl.h>
+
+namespace sane {
+    /**
+     * Process-wide libcURL state.
+     *
+     * Owns the curl_global_init() call (which is not thread-safe and must not be left to the implicit call in
+     * curl_easy_init() on worker threads) and a CURLSH share object, so that every easy handle created through
+     * it reuses the same DNS cache and TLS session IDs.
+     */
+    class HTTPContext {
+    public:
+        static void initialize();
+
+        static void cleanup();
+
+        static CURLSH *getShareHandle();
+
+        static CURL *createEasyHandle();
+
+        static void attachEasyHandle(CURL *t_curl);
+
+    private:
+        static void lockCallback(CURL *t_handle, curl_lock_data t_data, curl_lock_access t_access, void *t_userptr);
+
+        static void unlockCallback(CURL *t_handle, curl_lock_data t_data, void *t_userptr);
+
+        static CURLSH *m_share;
+        static std::mutex m_initMutex;
+        static std::mutex m_locks[CURL_LOCK_DATA_LAST];
+        static bool m_initialized;
+    };
+} // namespace sane
+
+#endif //SANE_HTTP_CONTEXT_HPP
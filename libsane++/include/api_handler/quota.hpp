@@ -0,0 +1,74 @@
+#ifndef SANE_QUOTA_HPP
+#define SANE_QUOTA_HPP
+
+#include <string>
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <ctime>
+
+#include <api_handler/request_context.hpp>
+
+// YouTube Data API quota (overridable in the config's "quota" section).
+#define QUOTA_DEFAULT_DAILY_LIMIT           10000   // Units per day, 0 disables the daily limit.
+#define QUOTA_DEFAULT_BUCKET_CAPACITY       200     // Largest burst, in quota units.
+#define QUOTA_DEFAULT_REFILL_PER_SECOND     100     // Sustained spend rate, 0 disables the token bucket.
+
+// The quota day rolls over at midnight Pacific Time (standard time offset, DST is not accounted for).
+#define QUOTA_RESET_UTC_OFFSET_HOURS        (-8)
+
+namespace sane {
+    struct quotaSettings_t {
+        long dailyLimit = QUOTA_DEFAULT_DAILY_LIMIT;
+        double bucketCapacity = QUOTA_DEFAULT_BUCKET_CAPACITY;
+        double refillPerSecond = QUOTA_DEFAULT_REFILL_PER_SECOND;
+    };
+
+    /**
+     * Token bucket where the tokens are YouTube API quota units.
+     *
+     * Holds at most t_capacity units and refills at t_refillPerSecond, so spending is smoothed out to the refill
+     * rate once an initial burst of t_capacity has been used up.
+     */
+    class QuotaBucket {
+    public:
+        QuotaBucket(double t_capacity, double t_refillPerSecond);
+
+        bool tryAcquire(long t_units);
+
+        bool acquire(long t_units, const requestContext_t &t_context = requestContext_t());
+
+        double getAvailable();
+
+    private:
+        void refill();
+
+        std::mutex m_mutex;
+        double m_capacity;
+        double m_refillPerSecond;
+        double m_tokens;
+        std::chrono::steady_clock::time_point m_lastRefill;
+    };
+
+    std::string getQuotaEndpoint(const std::string &t_url);
+
+    long getQuotaCost(const std::string &t_url);
+
+    std::string getQuotaDay(std::time_t t_time);
+
+    quotaSettings_t getQuotaSettings();
+
+    bool acquireQuota(const std::string &t_url, const requestContext_t &t_context);
+
+    bool tryAcquireQuota(const std::string &t_url);
+
+    long getQuotaUsedToday();
+
+    long getRemainingQuota();
+
+    std::map<std::string, long> getQuotaUsageToday();
+
+    bool flushQuotaLedger();
+} // namespace sane
+
+#endif //SANE_QUOTA_HPP
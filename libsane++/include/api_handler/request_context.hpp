@@ -0,0 +1,50 @@
+#ifndef SANE_REQUEST_CONTEXT_HPP
+#define SANE_REQUEST_CONTEXT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace sane {
+    /**
+     * Cooperative cancellation flag, shared between whoever starts a batch of requests and the requests themselves.
+     *
+     * Cancelling is sticky and thread-safe; in-flight transfers notice it from their progress callback.
+     */
+    class CancellationToken {
+    public:
+        void cancel();
+
+        bool isCancelled() const;
+
+    private:
+        std::atomic<bool> m_cancelled{false};
+    };
+
+    /**
+     * Per-request deadline and cancellation, propagated from the caller down to the libcURL transfer.
+     *
+     * A default constructed context never expires and cannot be cancelled.
+     */
+    struct requestContext_t {
+        std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+        std::shared_ptr<CancellationToken> cancellationToken;
+
+        bool hasDeadline() const;
+
+        bool isExpired() const;
+
+        bool isCancelled() const;
+
+        bool shouldAbort() const;
+
+        long remainingMilliseconds() const;
+
+        bool sleepFor(std::chrono::milliseconds t_duration) const;
+    };
+
+    requestContext_t makeRequestContext(std::chrono::milliseconds t_budget,
+                                        std::shared_ptr<CancellationToken> t_cancellationToken = nullptr);
+} // namespace sane
+
+#endif //SANE_REQUEST_CONTEXT_HPP
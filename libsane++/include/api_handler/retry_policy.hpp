@@ -0,0 +1,46 @@
+#ifndef SANE_RETRY_POLICY_HPP
+#define SANE_RETRY_POLICY_HPP
+
+#include <string>
+#include <random>
+
+#include <curl/curl.h>
+
+// Retry defaults (overridable in the config's "network/retry" section).
+#define RETRY_DEFAULT_MAX_ATTEMPTS   4      // Including the first attempt.
+#define RETRY_DEFAULT_BASE_DELAY_MS  500
+#define RETRY_DEFAULT_MAX_DELAY_MS   32000
+
+namespace sane {
+    /**
+     * Why a request failed, as far as retrying it is concerned.
+     */
+    enum class FailureKind {
+        None,           // Success.
+        Transient,      // Transport errors, timeouts and 5xx: worth retrying after a backoff.
+        RateLimited,    // 429 or rateLimitExceeded/userRateLimitExceeded: retry, but slow down.
+        QuotaExceeded,  // quotaExceeded/dailyLimitExceeded: no point retrying until the quota resets.
+        Fatal,          // Any other 4xx (bad request, unauthorized, not found, ...), or a cancelled request.
+        CircuitOpen     // Not sent at all, the endpoint's circuit breaker is failing fast.
+    };
+
+    struct retryPolicy_t {
+        int maxAttempts = RETRY_DEFAULT_MAX_ATTEMPTS;
+        long baseDelayMs = RETRY_DEFAULT_BASE_DELAY_MS;
+        long maxDelayMs = RETRY_DEFAULT_MAX_DELAY_MS;
+    };
+
+    std::string getApiErrorReason(const std::string &t_responseBody);
+
+    FailureKind classifyFailure(CURLcode t_result, long t_responseCode, const std::string &t_responseBody);
+
+    bool isRetryable(FailureKind t_kind);
+
+    const char *failureKindToString(FailureKind t_kind);
+
+    long computeBackoffMs(const retryPolicy_t &t_policy, int t_attempt, std::mt19937 &t_rng);
+
+    long computeRetryAfterMs(const retryPolicy_t &t_policy, long t_retryAfterSeconds);
+} // namespace sane
+
+#endif //SANE_RETRY_POLICY_HPP
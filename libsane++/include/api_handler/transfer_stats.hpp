@@ -0,0 +1,29 @@
+#ifndef SANE_TRANSFER_STATS_HPP
+#define SANE_TRANSFER_STATS_HPP
+
+#include <string>
+#include <map>
+
+namespace sane {
+    /**
+     * Accumulated byte counters for a single API endpoint.
+     *
+     * wireBytes is what actually crossed the network (compressed, if the server honoured Accept-Encoding),
+     * decodedBytes is what was handed to the JSON parser after libcURL's streaming decompression.
+     */
+    struct transferStats_t {
+        unsigned long requests{};
+        unsigned long long wireBytes{};
+        unsigned long long decodedBytes{};
+    };
+
+    std::string getEndpointFromUrl(const std::string &t_url);
+
+    void recordTransfer(const std::string &t_url, unsigned long long t_wireBytes, unsigned long long t_decodedBytes);
+
+    std::map<std::string, transferStats_t> getTransferStats();
+
+    void resetTransferStats();
+} // namespace sane
+
+#endif //SANE_TRANSFER_STATS_HPP
@@ -0,0 +1,58 @@
+#ifndef SANE_AIMD_LIMITER_HPP
+#define SANE_AIMD_LIMITER_HPP
+
+#include <cstddef>
+
+#define AIMD_DEFAULT_DECREASE_FACTOR    0.5
+#define AIMD_DEFAULT_LATENCY_TOLERANCE  3.0     // A latency this many times the baseline counts as congestion.
+
+namespace sane {
+    /**
+     * Additive-increase/multiplicative-decrease concurrency limiter.
+     *
+     * Starts in slow start (limit grows by one per success, i.e. doubles per round of requests) until the first
+     * sign of overload, then grows by one per round and shrinks multiplicatively on every overload signal:
+     * rate limiting (429), server errors or latency well above the best seen so far.
+     *
+     * Not thread-safe: meant to be owned by the single thread that dispatches the work.
+     */
+    class AIMDLimiter {
+    public:
+        AIMDLimiter(int t_initialLimit, int t_minLimit, int t_maxLimit,
+                    double t_decreaseFactor = AIMD_DEFAULT_DECREASE_FACTOR,
+                    double t_latencyTolerance = AIMD_DEFAULT_LATENCY_TOLERANCE);
+
+        int getLimit() const;
+
+        int getPeakLimit() const;
+
+        size_t getDecreaseCount() const;
+
+        long getBaselineLatency() const;
+
+        void onSuccess(long t_latencyMs);
+
+        void onOverload();
+
+        void onResult(long t_latencyMs, bool t_overloaded);
+
+    private:
+        void decrease();
+
+        void tick();
+
+        double m_limit;
+        int m_minLimit;
+        int m_maxLimit;
+        int m_peakLimit;
+        double m_decreaseFactor;
+        double m_latencyTolerance;
+        bool m_slowStart = true;
+        long m_baselineLatencyMs = -1;
+        size_t m_decreaseCount = 0;
+        // Successes still to be seen before another decrease is allowed (at most one per round in flight).
+        int m_decreaseCooldown = 0;
+    };
+} // namespace sane
+
+#endif //SANE_AIMD_LIMITER_HPP
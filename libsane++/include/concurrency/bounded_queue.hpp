@@ -0,0 +1,101 @@
+#ifndef SANE_BOUNDED_QUEUE_HPP
+#define SANE_BOUNDED_QUEUE_HPP
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+
+namespace sane {
+    /**
+     * Fixed capacity multi-producer multi-consumer FIFO queue, used to connect the stages of a pipeline.
+     *
+     * A full queue blocks its producers (back-pressure) and an empty one its consumers, so the capacity caps how
+     * much work can pile up between two stages. Closing the queue lets consumers drain what is left and then stop.
+     *
+     * @tparam T    Element type, must be movable.
+     */
+    template<typename T>
+    class BoundedQueue {
+    public:
+        explicit BoundedQueue(size_t t_capacity) : m_capacity(t_capacity > 0 ? t_capacity : 1) {}
+
+        BoundedQueue(const BoundedQueue &) = delete;
+        BoundedQueue &operator=(const BoundedQueue &) = delete;
+
+        /**
+         * Appends an element, waiting for room if the queue is full.
+         *
+         * @param t_value   Element.
+         * @return          false if the queue was closed (the element is dropped).
+         */
+        bool push(T t_value) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_notFull.wait(lock, [this]() { return m_closed or m_items.size() < m_capacity; });
+            if (m_closed) {
+                return false;
+            }
+
+            m_items.push_back(std::move(t_value));
+            lock.unlock();
+            m_notEmpty.notify_one();
+
+            return true;
+        }
+
+        /**
+         * Removes the oldest element, waiting for one if the queue is empty.
+         *
+         * @param t_value   Set to the element.
+         * @return          false once the queue is closed and drained.
+         */
+        bool pop(T &t_value) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_notEmpty.wait(lock, [this]() { return m_closed or !m_items.empty(); });
+            if (m_items.empty()) {
+                return false;
+            }
+
+            t_value = std::move(m_items.front());
+            m_items.pop_front();
+            lock.unlock();
+            m_notFull.notify_one();
+
+            return true;
+        }
+
+        /**
+         * No more elements will be pushed: wakes everyone up, consumers get what is left and then false.
+         */
+        void close() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_closed = true;
+            }
+            m_notEmpty.notify_all();
+            m_notFull.notify_all();
+        }
+
+        size_t size() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            return m_items.size();
+        }
+
+        size_t capacity() const {
+            return m_capacity;
+        }
+
+    private:
+        const size_t m_capacity;
+        std::deque<T> m_items;
+        bool m_closed = false;
+        std::mutex m_mutex;
+        std::condition_variable m_notEmpty;
+        std::condition_variable m_notFull;
+    };
+} // namespace sane
+
+#endif //SANE_BOUNDED_QUEUE_HPP
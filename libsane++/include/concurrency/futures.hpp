@@ -0,0 +1,69 @@
+#ifndef SANE_FUTURES_HPP
+#define SANE_FUTURES_HPP
+
+#include <future>
+#include <memory>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include <concurrency/work_stealing_scheduler.hpp>
+
+namespace sane {
+    /**
+     * Runs a function on an executor.
+     *
+     * @param t_executor    Executor to run it on.
+     * @param t_function    Function taking no arguments, exceptions it throws end up in the future.
+     * @return              Future of the function's result.
+     */
+    template<typename Function, typename Result = decltype(std::declval<Function &>()())>
+    std::future<Result> submitFuture(WorkStealingScheduler &t_executor, Function t_function) {
+        // std::function must be copyable, a packaged_task isn't.
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::move(t_function));
+        std::future<Result> future = task->get_future();
+
+        t_executor.submit([task]() { (*task)(); });
+
+        return future;
+    }
+
+    /**
+     * Combines futures into one for all of their results.
+     *
+     * The combined future is deferred: it waits (on the thread calling get()) rather than holding up an executor
+     * worker, which could otherwise end up waiting on work queued behind itself.
+     *
+     * @param t_futures Futures, typically of independent requests in flight at the same time.
+     * @return          Future of every result, in the order of t_futures. get() rethrows the first exception.
+     */
+    template<typename T>
+    std::future<std::vector<T>> whenAll(std::vector<std::future<T>> t_futures) {
+        return std::async(std::launch::deferred, [futures = std::move(t_futures)]() mutable {
+            std::vector<T> results;
+            results.reserve(futures.size());
+
+            for (auto &future : futures) {
+                results.push_back(future.get());
+            }
+
+            return results;
+        });
+    }
+
+    /**
+     * Combines futures of different types into one for all of their results.
+     *
+     * @return  Deferred future of a tuple of the results, in argument order.
+     */
+    template<typename... T>
+    std::future<std::tuple<T...>> whenAll(std::future<T>... t_futures) {
+        return std::async(std::launch::deferred, [](std::future<T>... t_pending) {
+            // Braced initialization is evaluated left to right.
+            return std::tuple<T...>{t_pending.get()...};
+        }, std::move(t_futures)...);
+    }
+} // namespace sane
+
+#endif //SANE_FUTURES_HPP
@@ -0,0 +1,120 @@
+#ifndef SANE_MPSC_QUEUE_HPP
+#define SANE_MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <utility>
+
+namespace sane {
+    /**
+     * Unbounded lock-free multi-producer single-consumer queue.
+     *
+     * Producers link nodes in with a single atomic exchange (Vyukov's MPSC queue), so push never blocks on other
+     * producers or on the consumer. The consumer can poll (tryPop) or block (waitPop), in which case it sleeps on a
+     * condition variable that producers only touch when the consumer has announced that it is going to sleep.
+     *
+     * push may be called from any thread, everything else only from the one consumer thread.
+     *
+     * @tparam T    Element type, must be default constructible and movable.
+     */
+    template<typename T>
+    class MPSCQueue {
+    public:
+        MPSCQueue() {
+            // The queue always holds a stub node, which the consumer's tail points at.
+            node_t *stub = new node_t();
+            m_head.store(stub);
+            m_tail = stub;
+        }
+
+        MPSCQueue(const MPSCQueue &) = delete;
+        MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+        ~MPSCQueue() {
+            while (m_tail != nullptr) {
+                node_t *next = m_tail->next.load();
+                delete m_tail;
+                m_tail = next;
+            }
+        }
+
+        void push(T t_value) {
+            node_t *node = new node_t();
+            node->value = std::move(t_value);
+
+            node_t *previous = m_head.exchange(node, std::memory_order_acq_rel);
+            // Between the exchange and this store the node is queued, but not yet reachable by the consumer.
+            previous->next.store(node, std::memory_order_seq_cst);
+
+            // Pairs with waitPop: either the consumer sees the node linked in, or we see it going to sleep.
+            if (m_consumerSleeping.load(std::memory_order_seq_cst)) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_wakeup.notify_one();
+            }
+        }
+
+        bool tryPop(T &t_value) {
+            node_t *next = m_tail->next.load(std::memory_order_acquire);
+
+            if (next == nullptr) {
+                return false;
+            }
+
+            // next becomes the new stub, its value moves out.
+            t_value = std::move(next->value);
+            delete m_tail;
+            m_tail = next;
+
+            return true;
+        }
+
+        /**
+         * Pops an element, waiting up to t_timeout for one to be pushed.
+         *
+         * @param t_value   Set to the popped element.
+         * @param t_timeout Longest time to wait.
+         * @return          true if an element was popped, false on timeout.
+         */
+        template<typename Rep, typename Period>
+        bool waitPop(T &t_value, const std::chrono::duration<Rep, Period> &t_timeout) {
+            if (tryPop(t_value)) {
+                return true;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+
+                m_consumerSleeping.store(true, std::memory_order_seq_cst);
+                m_wakeup.wait_for(lock, t_timeout, [this]() {
+                    return m_tail->next.load(std::memory_order_seq_cst) != nullptr;
+                });
+                m_consumerSleeping.store(false, std::memory_order_relaxed);
+            }
+
+            return tryPop(t_value);
+        }
+
+        bool empty() const {
+            return m_tail->next.load(std::memory_order_acquire) == nullptr;
+        }
+
+    private:
+        struct node_t {
+            std::atomic<node_t*> next{nullptr};
+            T value;
+        };
+
+        // Producers' end, the most recently pushed node.
+        std::atomic<node_t*> m_head;
+        // Consumer's end, the stub before the oldest element.
+        node_t *m_tail;
+
+        std::atomic<bool> m_consumerSleeping{false};
+        std::mutex m_mutex;
+        std::condition_variable m_wakeup;
+    };
+} // namespace sane
+
+#endif //SANE_MPSC_QUEUE_HPP
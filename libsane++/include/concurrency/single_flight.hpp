@@ -0,0 +1,143 @@
+#ifndef SANE_SINGLE_FLIGHT_HPP
+#define SANE_SINGLE_FLIGHT_HPP
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <future>
+#include <chrono>
+#include <functional>
+#include <atomic>
+#include <exception>
+
+#include <api_handler/request_context.hpp>
+
+namespace sane {
+    /**
+     * Collapses concurrent calls for the same key into a single call.
+     *
+     * The first caller for a key (the leader) runs the function, anyone asking for the same key while it is
+     * still running waits for it and is handed the very same (immutable) result. Nothing is cached: once the
+     * leader is done the next call for that key starts afresh.
+     *
+     * A result that only came about because the leader gave up (see run's t_isAborted) isn't forced on the
+     * waiting callers, those that may still carry on make the call again instead.
+     *
+     * @tparam T    Result type, shared as std::shared_ptr<const T>.
+     */
+    template<typename T>
+    class SingleFlight {
+    public:
+        using result_t = std::shared_ptr<const T>;
+
+        /**
+         * Runs t_function, unless a call for t_key is already in flight, in which case its result is awaited.
+         *
+         * @param t_key         Identifies calls that are interchangeable.
+         * @param t_function    Produces the result.
+         * @param t_context     A waiting caller stops waiting (and gets nullptr) once this is cancelled or expired,
+         *                      it doesn't affect the in-flight call, which belongs to the leader.
+         * @param t_shared      Set to whether the result came from another caller's call, send in nullptr to disable.
+         * @param t_isAborted   Tells whether a result is the leader's cancellation or deadline rather than an
+         *                      answer, a waiting caller that isn't itself aborted retries (leading, unless someone
+         *                      else beat it to it) instead of taking it. Send in nullptr to accept every result.
+         * @return              The result, or nullptr if the wait was aborted.
+         */
+        result_t run(const std::string &t_key, const std::function<result_t()> &t_function,
+                     const requestContext_t &t_context = requestContext_t(), bool *t_shared = nullptr,
+                     const std::function<bool(const T &)> &t_isAborted = nullptr) {
+            while (true) {
+                std::shared_ptr<std::promise<result_t>> promise;
+                std::shared_future<result_t> future;
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+
+                    auto inFlight = m_inFlight.find(t_key);
+                    if (inFlight != m_inFlight.end()) {
+                        future = inFlight->second;
+                        m_coalesced++;
+                    } else {
+                        promise = std::make_shared<std::promise<result_t>>();
+                        future = promise->get_future().share();
+                        m_inFlight[t_key] = future;
+                    }
+                }
+
+                if (t_shared != nullptr) {
+                    *t_shared = promise == nullptr;
+                }
+
+                if (promise == nullptr) {
+                    // Follower: wait for the leader, for as long as we are allowed to.
+                    while (future.wait_for(std::chrono::milliseconds(50)) != std::future_status::ready) {
+                        if (t_context.shouldAbort()) {
+                            return nullptr;
+                        }
+                    }
+
+                    result_t result = future.get();
+                    if (result != nullptr and t_isAborted and t_isAborted(*result) and !t_context.shouldAbort()) {
+                        // The leader gave up, which says nothing about the answer we're still after.
+                        m_retried++;
+                        continue;
+                    }
+
+                    return result;
+                }
+
+                // Leader: make the call and hand its result to everyone who showed up in the meantime.
+                result_t result;
+                std::exception_ptr error;
+                try {
+                    result = t_function();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                {
+                    // No longer in flight before anyone is woken up, so a retrying follower starts a new call.
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_inFlight.erase(t_key);
+                }
+
+                if (error) {
+                    promise->set_exception(error);
+                } else {
+                    promise->set_value(result);
+                }
+
+                return future.get();
+            }
+        }
+
+        /**
+         * @return Number of calls that were answered by another caller's in-flight call.
+         */
+        unsigned long getCoalescedCount() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            return m_coalesced;
+        }
+
+        /**
+         * @return Number of times a waiting caller made the call again because the leader had given up.
+         */
+        unsigned long getRetriedCount() {
+            return m_retried;
+        }
+
+        size_t getInFlightCount() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            return m_inFlight.size();
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::map<std::string, std::shared_future<result_t>> m_inFlight;
+        unsigned long m_coalesced = 0;
+        std::atomic<unsigned long> m_retried{0};
+    };
+} // namespace sane
+
+#endif //SANE_SINGLE_FLIGHT_HPP
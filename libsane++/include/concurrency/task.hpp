@@ -0,0 +1,254 @@
+#ifndef SANE_TASK_HPP
+#define SANE_TASK_HPP
+
+// Only available in builds configured with -DSanePP_EnableCoroutines=ON (C++20).
+#ifdef SANE_ENABLE_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace sane {
+    template<typename T>
+    class Task;
+
+    namespace detail {
+        /**
+         * What every Task promise has in common: lazy start, and resuming whoever awaits the task when it is done.
+         */
+        struct taskPromiseBase {
+            struct finalAwaiter {
+                bool await_ready() const noexcept {
+                    return false;
+                }
+
+                // Symmetric transfer: hand the thread straight to the awaiting coroutine, if any.
+                template<typename Promise>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> t_handle) noexcept {
+                    std::coroutine_handle<> continuation = t_handle.promise().continuation;
+
+                    return continuation ? continuation : std::noop_coroutine();
+                }
+
+                void await_resume() noexcept {}
+            };
+
+            std::suspend_always initial_suspend() noexcept {
+                return {};
+            }
+
+            finalAwaiter final_suspend() noexcept {
+                return {};
+            }
+
+            void unhandled_exception() noexcept {
+                exception = std::current_exception();
+            }
+
+            std::coroutine_handle<> continuation;
+            std::exception_ptr exception;
+            bool started = false;
+        };
+
+        template<typename T>
+        struct taskPromise : taskPromiseBase {
+            Task<T> get_return_object() noexcept;
+
+            void return_value(T t_value) {
+                value = std::move(t_value);
+            }
+
+            T result() {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+
+                return std::move(*value);
+            }
+
+            std::optional<T> value;
+        };
+
+        template<>
+        struct taskPromise<void> : taskPromiseBase {
+            Task<void> get_return_object() noexcept;
+
+            void return_void() noexcept {}
+
+            void result() {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        };
+    } // namespace detail
+
+    /**
+     * Lazily started coroutine returning a T.
+     *
+     * The body doesn't run until the task is awaited (co_await task) or started (start()), so a flow of several
+     * requests reads like blocking code while never holding up a thread. Starting several tasks before awaiting
+     * them runs them concurrently, see whenAll.
+     *
+     * @tparam T    Result type.
+     */
+    template<typename T = void>
+    class [[nodiscard]] Task {
+    public:
+        using promise_type = detail::taskPromise<T>;
+
+        Task() = default;
+
+        explicit Task(std::coroutine_handle<promise_type> t_handle) : m_handle(t_handle) {}
+
+        Task(Task &&t_other) noexcept : m_handle(std::exchange(t_other.m_handle, nullptr)) {}
+
+        Task &operator=(Task &&t_other) noexcept {
+            if (this != &t_other) {
+                destroy();
+                m_handle = std::exchange(t_other.m_handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+
+        ~Task() {
+            destroy();
+        }
+
+        auto operator co_await() && noexcept {
+            struct awaiter {
+                std::coroutine_handle<promise_type> handle;
+
+                bool await_ready() const noexcept {
+                    return !handle or handle.done();
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> t_awaiting) noexcept {
+                    handle.promise().continuation = t_awaiting;
+
+                    // A started task is suspended on something else, it resumes the awaiting one when done.
+                    if (handle.promise().started) {
+                        return std::noop_coroutine();
+                    }
+                    handle.promise().started = true;
+
+                    return handle;
+                }
+
+                T await_resume() {
+                    return handle.promise().result();
+                }
+            };
+
+            return awaiter{m_handle};
+        }
+
+        /**
+         * Runs the body up to its first suspension point, for top-level tasks that nobody awaits.
+         */
+        void start() {
+            if (m_handle and !m_handle.promise().started) {
+                m_handle.promise().started = true;
+                m_handle.resume();
+            }
+        }
+
+        bool done() const {
+            return !m_handle or m_handle.done();
+        }
+
+        /**
+         * @return  The task's result, rethrowing whatever exception escaped it. Only valid once done().
+         */
+        T result() {
+            return m_handle.promise().result();
+        }
+
+    private:
+        void destroy() {
+            if (m_handle) {
+                m_handle.destroy();
+                m_handle = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type> m_handle;
+    };
+
+    namespace detail {
+        template<typename T>
+        Task<T> taskPromise<T>::get_return_object() noexcept {
+            return Task<T>(std::coroutine_handle<taskPromise<T>>::from_promise(*this));
+        }
+
+        inline Task<void> taskPromise<void>::get_return_object() noexcept {
+            return Task<void>(std::coroutine_handle<taskPromise<void>>::from_promise(*this));
+        }
+    } // namespace detail
+
+    /**
+     * Runs tasks concurrently and collects their results.
+     *
+     * Every task runs to the end even if one of them fails, the first exception is rethrown only then (a task
+     * destroyed mid-flight would abandon whatever it was doing, e.g. an open transfer).
+     *
+     * @param t_tasks   Tasks (not yet awaited).
+     * @return          Task resulting in every result, in the order of t_tasks.
+     */
+    template<typename T>
+    Task<std::vector<T>> whenAll(std::vector<Task<T>> t_tasks) {
+        std::vector<T> results;
+        std::exception_ptr error;
+        results.reserve(t_tasks.size());
+
+        for (auto &task : t_tasks) {
+            task.start();
+        }
+        for (auto &task : t_tasks) {
+            try {
+                results.push_back(co_await std::move(task));
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        co_return results;
+    }
+
+    inline Task<void> whenAll(std::vector<Task<void>> t_tasks) {
+        std::exception_ptr error;
+
+        for (auto &task : t_tasks) {
+            task.start();
+        }
+        for (auto &task : t_tasks) {
+            try {
+                co_await std::move(task);
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+} // namespace sane
+
+#endif // SANE_ENABLE_COROUTINES
+
+#endif //SANE_TASK_HPP
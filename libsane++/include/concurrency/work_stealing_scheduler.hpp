@@ -0,0 +1,82 @@
+#ifndef SANE_WORK_STEALING_SCHEDULER_HPP
+#define SANE_WORK_STEALING_SCHEDULER_HPP
+
+#include <cstddef>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+
+// Bulk jobs are mostly waiting on the network, so they are given more workers than there are cores.
+#define SCHEDULER_DEFAULT_WORKERS   8
+
+namespace sane {
+    /**
+     * Fixed-size pool of workers for bulk jobs whose tasks vary a lot in cost.
+     *
+     * Every worker has its own deque: it pushes and pops tasks at the back (LIFO, cache friendly) while idle
+     * workers steal from the front of a randomly picked victim (FIFO, the oldest and likely biggest work). There is
+     * no central queue, so the only contention is between a worker and the occasional thief.
+     *
+     * Tasks submitted from within a task go onto the current worker's own deque, others are spread round-robin.
+     */
+    class WorkStealingScheduler {
+    public:
+        explicit WorkStealingScheduler(size_t t_workers = SCHEDULER_DEFAULT_WORKERS);
+
+        WorkStealingScheduler(const WorkStealingScheduler &) = delete;
+        WorkStealingScheduler &operator=(const WorkStealingScheduler &) = delete;
+
+        ~WorkStealingScheduler();
+
+        void submit(std::function<void()> t_task);
+
+        void wait();
+
+        size_t getWorkerCount() const;
+
+        unsigned long getExecutedCount() const;
+
+        unsigned long getStolenCount() const;
+
+    private:
+        struct worker_t {
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        void workerLoop(size_t t_index);
+
+        bool popLocal(size_t t_index, std::function<void()> &t_task);
+
+        bool steal(size_t t_thief, std::function<void()> &t_task);
+
+        void execute(std::function<void()> &t_task);
+
+        std::vector<std::unique_ptr<worker_t>> m_workers;
+        std::vector<std::thread> m_threads;
+        std::atomic<size_t> m_nextWorker{0};
+
+        // Tasks sitting in a deque, and tasks submitted but not yet finished.
+        std::atomic<size_t> m_queued{0};
+        std::atomic<size_t> m_unfinished{0};
+
+        // Idle workers sleep here, submitters only take the lock when someone is asleep.
+        std::atomic<size_t> m_sleeping{0};
+        std::atomic<bool> m_stopping{false};
+        std::mutex m_idleMutex;
+        std::condition_variable m_wakeup;
+
+        std::mutex m_doneMutex;
+        std::condition_variable m_done;
+
+        std::atomic<unsigned long> m_executed{0};
+        std::atomic<unsigned long> m_stolen{0};
+    };
+} // namespace sane
+
+#endif //SANE_WORK_STEALING_SCHEDULER_HPP
@@ -31,10 +31,16 @@ namespace sane {
 
         int getInt(const std::string &t_section);
 
+        int getInt(const std::string &t_section, int t_default);
+
         long int getLongInt(const std::string &t_section);
 
+        long int getLongInt(const std::string &t_section, long int t_default);
+
         const std::list<std::string> getStringList(const std::string &t_section);
     private:
+        bool findSection(const std::string &t_section, nlohmann::json &t_value);
+
         const std::string CONFIG_FILE = "config.json";
         const char SECTION_SEPARATOR = '/';
 
@@ -0,0 +1,31 @@
+#ifndef SANE_DB_QUOTA_LEDGER_HPP
+#define SANE_DB_QUOTA_LEDGER_HPP
+
+#include <string>
+#include <map>
+#include <list>
+#include <memory>
+
+#include <db_handler/db_handler.hpp>
+
+namespace sane {
+    int createQuotaLedgerTable(const std::shared_ptr<DBHandler> &t_db);
+
+    /**
+     * Adds quota usage to the per-day, per-endpoint ledger in the SQLite3 Database.
+     *
+     * Conflict handling: Units and requests are added to an already existing (day, endpoint) entry.
+     *
+     * @param t_day         Quota day on "YYYY-MM-DD" form.
+     * @param t_usage       Map of <endpoint, quota units> to add.
+     * @param t_requests    Map of <endpoint, request count> to add.
+     * @param t_errors      Pointer to a string list to put errors in.
+     * @return              SQLITE_OK or the failing status.
+     */
+    int addQuotaUsageToDB(const std::string &t_day, const std::map<std::string, long> &t_usage,
+                          const std::map<std::string, long> &t_requests, std::list<std::string> *t_errors);
+
+    std::map<std::string, long> getQuotaUsageFromDB(const std::string &t_day, std::list<std::string> *t_errors);
+} // namespace sane
+
+#endif //SANE_DB_QUOTA_LEDGER_HPP
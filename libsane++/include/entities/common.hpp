@@ -11,6 +11,7 @@
 #include <nlohmann/json.hpp>
 
 #include <types.hpp>
+#include <entities/diagnostics.hpp>
 
 
 #define GET_VARIABLE_NAME(Variable) (#Variable)
@@ -31,17 +32,17 @@ namespace sane {
 
     bool isDigits(nlohmann::json &t_json);
 
-    std::string getJsonStringValue(nlohmann::json &t_string, const std::string &t_funcName,
-            std::map<std::string, std::string> &t_problems);
+    nlohmann::json &getJsonField(nlohmann::json &t_object, const char *t_key);
 
-    bool getJsonBoolValue(nlohmann::json &t_bool, const std::string &t_funcName,
-            std::map<std::string, std::string> &t_problems);
+    std::string getJsonStringValue(nlohmann::json &t_string, const char *t_field, Diagnostics &t_diagnostics);
 
-    long getJsonLongValue(nlohmann::json &t_long, const std::string &t_funcName,
-            std::map<std::string, std::string> &t_problems);
+    std::string takeJsonStringValue(nlohmann::json &t_string, const char *t_field, Diagnostics &t_diagnostics);
 
-    unsigned long getJsonULongValue(nlohmann::json &t_ulong, const std::string &t_funcName,
-            std::map<std::string, std::string> &t_problems);
+    bool getJsonBoolValue(nlohmann::json &t_bool, const char *t_field, Diagnostics &t_diagnostics);
+
+    long getJsonLongValue(nlohmann::json &t_long, const char *t_field, Diagnostics &t_diagnostics);
+
+    unsigned long getJsonULongValue(nlohmann::json &t_ulong, const char *t_field, Diagnostics &t_diagnostics);
 
     void printIndentedString(int t_spacing, const std::string &t_string, std::string t_title = {});
 } // namespace sane
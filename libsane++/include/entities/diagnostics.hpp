@@ -0,0 +1,76 @@
+#ifndef SANE_DIAGNOSTICS_HPP
+#define SANE_DIAGNOSTICS_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <nlohmann/json.hpp>
+
+namespace sane {
+    enum class DiagnosticSeverity : uint8_t {
+        Warning,
+        Error
+    };
+
+    enum class DiagnosticCode : uint8_t {
+        NullString,         // The value was the string "null".
+        MissingValue,       // The value was null/absent.
+        NonDigitString,     // A number was expected, the value was a string that isn't one.
+        WrongType,          // The value was of a type that can't be converted.
+        Message             // Free-form message, see diagnostic_t::message.
+    };
+
+    /**
+     * One problem found while populating an entity.
+     *
+     * Coded diagnostics only point at static strings and the offending value; the text is formatted on demand
+     * by getMessage().
+     */
+    struct diagnostic_t {
+        DiagnosticSeverity severity = DiagnosticSeverity::Error;
+        DiagnosticCode code = DiagnosticCode::Message;
+        // Setter/field the problem came from, and the type it wanted (static strings).
+        const char *field = "";
+        const char *expected = "";
+        // Only used by DiagnosticCode::Message.
+        std::string message;
+        // The offending value (coded diagnostics) or the context (messages), null if none.
+        nlohmann::json json;
+
+        std::string getMessage() const;
+    };
+
+    /**
+     * Warnings and errors of an entity.
+     *
+     * Nothing is allocated until there is something to report, so an entity that parses cleanly doesn't pay
+     * for its diagnostics.
+     */
+    class Diagnostics {
+    public:
+        void add(DiagnosticSeverity t_severity, DiagnosticCode t_code, const char *t_field, const char *t_expected,
+                 const nlohmann::json &t_value = nlohmann::json());
+
+        void addMessage(DiagnosticSeverity t_severity, const std::string &t_message,
+                        const nlohmann::json &t_json = nlohmann::json());
+
+        bool empty() const;
+
+        size_t count(DiagnosticSeverity t_severity) const;
+
+        const std::vector<diagnostic_t> &getAll() const;
+
+        void clear();
+
+        void clear(DiagnosticSeverity t_severity);
+
+        void print(DiagnosticSeverity t_severity, int t_indent = 0, bool t_withJson = false,
+                   int t_jsonIndent = 0) const;
+
+    private:
+        std::vector<diagnostic_t> m_diagnostics;
+    };
+} // namespace sane
+
+#endif //SANE_DIAGNOSTICS_HPP
@@ -0,0 +1,106 @@
+#ifndef SANE_FEED_ITEM_HPP
+#define SANE_FEED_ITEM_HPP
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include <entities/packed_ids.hpp>
+
+#define FEED_ITEM_FLAG_HD           0x1     // contentDetails.definition is "hd".
+#define FEED_ITEM_FLAG_CAPTIONS     0x2     // contentDetails.caption is "true".
+#define FEED_ITEM_FLAG_LIVE         0x4     // snippet.liveBroadcastContent is "live".
+#define FEED_ITEM_FLAG_UPCOMING     0x8     // snippet.liveBroadcastContent is "upcoming".
+
+namespace sane {
+    /**
+     * Interned channels of a feed: every FeedItem refers to its channel by index instead of carrying its own copy
+     * of the channel ID and title.
+     *
+     * Not thread-safe.
+     */
+    class FeedChannelTable {
+    public:
+        uint32_t intern(const ChannelId &t_channelId, const std::string &t_channelTitle);
+
+        uint32_t intern(const std::string &t_channelId, const std::string &t_channelTitle);
+
+        const ChannelId &getPackedChannelId(uint32_t t_channel) const;
+
+        std::string getChannelId(uint32_t t_channel) const;
+
+        const std::string &getChannelTitle(uint32_t t_channel) const;
+
+        size_t size() const;
+
+    private:
+        struct channel_t {
+            ChannelId id;
+            std::string title;
+        };
+
+        std::vector<channel_t> m_channels;
+        std::unordered_map<ChannelId, uint32_t> m_indexes;
+    };
+
+    /**
+     * Compact projection of a video for feeds: just what a feed listing shows, in about a cache line.
+     *
+     * Parsed straight from videos.list() response bodies (see parseFeedItems) rather than via YoutubeVideo.
+     */
+    class FeedItem {
+    public:
+        FeedItem() = default;
+
+        FeedItem(const VideoId &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel, std::string t_title,
+                 uint32_t t_durationSeconds, uint8_t t_flags);
+
+        FeedItem(const std::string &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel, std::string t_title,
+                 uint32_t t_durationSeconds, uint8_t t_flags);
+
+        const VideoId &getVideoId() const;
+
+        std::string getId() const;
+
+        int64_t getPublishedAtMs() const;
+
+        uint32_t getChannel() const;
+
+        const std::string &getTitle() const;
+
+        uint32_t getDurationSeconds() const;
+
+        uint8_t getFlags() const;
+
+        bool isHD() const;
+
+        bool hasCaptions() const;
+
+        bool isLive() const;
+
+        bool isUpcoming() const;
+
+        static int64_t parsePublishedAtMs(const std::string &t_iso8601);
+
+        static long parseDurationSeconds(const std::string &t_iso8601Duration);
+
+    private:
+        int64_t m_publishedAtMs = 0;
+        std::string m_title;
+        VideoId m_id;
+        uint32_t m_channel = 0;
+        uint32_t m_durationSeconds = 0;
+        uint8_t m_flags = 0;
+    };
+
+    struct sortFeedItemDateDescending {
+        bool operator ()(const FeedItem &item1, const FeedItem &item2) const {
+            return item1.getPublishedAtMs() > item2.getPublishedAtMs();
+        }
+    };
+
+    bool parseFeedItems(const std::string &t_body, FeedChannelTable &t_channels, std::vector<FeedItem> &t_items);
+} // namespace sane
+
+#endif //SANE_FEED_ITEM_HPP
@@ -0,0 +1,86 @@
+#ifndef SANE_LAZY_VIDEO_HPP
+#define SANE_LAZY_VIDEO_HPP
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/youtube_video.hpp>
+#include <entities/video_parts.hpp>
+
+namespace sane {
+    /**
+     * A JSON value in a response buffer: its first byte and its length, quotes included for strings.
+     * Zero length means absent.
+     */
+    struct jsonSpan_t {
+        uint32_t offset = 0;
+        uint32_t length = 0;
+    };
+
+    /**
+     * Video of a videos.list() response that is only decoded as far as it is used.
+     *
+     * Shares ownership of the raw response body and only indexes where the item's ID and parts are, so building
+     * one costs a scan over its bytes. Fields are looked up and unescaped on access, whole parts can be parsed on
+     * their own, and materialize() turns it into a full YoutubeVideo when everything is needed after all.
+     */
+    class LazyVideo {
+    public:
+        LazyVideo(std::shared_ptr<const std::string> t_buffer, size_t t_offset);
+
+        bool isValid() const;
+
+        jsonSpan_t getSpan() const;
+
+        bool hasPart(VideoPart t_part) const;
+
+        std::string getId() const;
+
+        std::string getTitle() const;
+
+        std::string getDescription() const;
+
+        std::string getChannelId() const;
+
+        std::string getChannelTitle() const;
+
+        std::string getPublishedAt() const;
+
+        std::string getDuration() const;
+
+        unsigned long getViewCount() const;
+
+        std::string getString(VideoPart t_part, const char *t_key) const;
+
+        bool getRawString(VideoPart t_part, const char *t_key, const char *&t_data, size_t &t_length) const;
+
+        unsigned long getULong(VideoPart t_part, const char *t_key) const;
+
+        bool getBool(VideoPart t_part, const char *t_key) const;
+
+        nlohmann::json getPart(VideoPart t_part) const;
+
+        nlohmann::json toJson() const;
+
+        std::shared_ptr<YoutubeVideo> materialize() const;
+
+        const std::shared_ptr<const std::string> &getBuffer() const;
+
+    private:
+        jsonSpan_t findField(VideoPart t_part, const char *t_key) const;
+
+        std::shared_ptr<const std::string> m_buffer;
+        jsonSpan_t m_item;
+        jsonSpan_t m_id;
+        std::array<jsonSpan_t, VIDEO_PART_COUNT> m_parts;
+    };
+
+    bool parseLazyVideos(std::shared_ptr<const std::string> t_body, std::vector<LazyVideo> &t_videos);
+} // namespace sane
+
+#endif //SANE_LAZY_VIDEO_HPP
@@ -0,0 +1,279 @@
+#ifndef SANE_PACKED_IDS_HPP
+#define SANE_PACKED_IDS_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+
+#define VIDEO_ID_LENGTH             11      // base64url characters, 64 bits.
+#define CHANNEL_ID_BODY_LENGTH      22      // base64url characters after the prefix, 128 bits.
+#define CHANNEL_ID_LENGTH           24      // Prefix ("UC", "UU", "FL" or "LL") + body.
+#define CHANNEL_ID_BYTES            16      // Size of a packed ChannelId body, e.g. in a BLOB column.
+
+namespace sane {
+    /**
+     * Value of a base64url character, or -1 if it isn't one.
+     */
+    constexpr int base64UrlValue(char t_char) {
+        return (t_char >= 'A' and t_char <= 'Z') ? t_char - 'A' :
+               (t_char >= 'a' and t_char <= 'z') ? t_char - 'a' + 26 :
+               (t_char >= '0' and t_char <= '9') ? t_char - '0' + 52 :
+               t_char == '-' ? 62 :
+               t_char == '_' ? 63 : -1;
+    }
+
+    constexpr char base64UrlChar(unsigned t_value) {
+        return "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_"[t_value & 63];
+    }
+
+    /**
+     * Checks that t_length characters are all base64url and that the last one has no bits set below
+     * t_lastCharZeroBits, i.e. that they decode to a whole number of bits and re-encode to the same string.
+     *
+     * Deliberately has no early out, so it's one straight loop over the characters the compiler can vectorize.
+     */
+    constexpr bool isBase64UrlId(const char *t_id, size_t t_length, int t_lastCharZeroBits) {
+        int invalid = 0;
+
+        for (size_t i = 0; i < t_length; i++) {
+            invalid |= base64UrlValue(t_id[i]) < 0;
+        }
+
+        return t_length > 0 and invalid == 0
+               and (base64UrlValue(t_id[t_length - 1]) & ((1 << t_lastCharZeroBits) - 1)) == 0;
+    }
+
+    /**
+     * Finalizer of splitmix64, spreads every input bit over the whole hash.
+     */
+    constexpr uint64_t mixPackedId(uint64_t t_value) {
+        t_value ^= t_value >> 30;
+        t_value *= 0xbf58476d1ce4e5b9ULL;
+        t_value ^= t_value >> 27;
+        t_value *= 0x94d049bb133111ebULL;
+        t_value ^= t_value >> 31;
+
+        return t_value;
+    }
+
+    /**
+     * A YouTube video ID packed into 64 bits.
+     *
+     * Video IDs are 11 base64url characters: 10 full 6-bit characters plus a last one that only carries 4 bits,
+     * so they convert losslessly to and from a uint64_t (or an SQLite INTEGER column, see toInt64()).
+     *
+     * A default constructed VideoId is all zero bits, i.e. "AAAAAAAAAAA".
+     */
+    class VideoId {
+    public:
+        constexpr VideoId() = default;
+
+        constexpr explicit VideoId(uint64_t t_value) : m_value(t_value) {}
+
+        /**
+         * Packs an ID, which must be valid (see isValid()).
+         *
+         * @param t_id  VIDEO_ID_LENGTH characters.
+         */
+        static constexpr VideoId encode(const char *t_id) {
+            uint64_t value = 0;
+
+            for (int i = 0; i < VIDEO_ID_LENGTH - 1; i++) {
+                value = (value << 6) | (uint64_t)base64UrlValue(t_id[i]);
+            }
+
+            return VideoId((value << 4) | ((uint64_t)base64UrlValue(t_id[VIDEO_ID_LENGTH - 1]) >> 2));
+        }
+
+        /**
+         * Unpacks the ID into VIDEO_ID_LENGTH characters (not NUL terminated).
+         */
+        constexpr void decode(char *t_id) const {
+            t_id[VIDEO_ID_LENGTH - 1] = base64UrlChar((unsigned)(m_value & 0xf) << 2);
+
+            for (int i = 0; i < VIDEO_ID_LENGTH - 1; i++) {
+                t_id[VIDEO_ID_LENGTH - 2 - i] = base64UrlChar((unsigned)(m_value >> (4 + 6 * i)));
+            }
+        }
+
+        static constexpr bool isValid(const char *t_id, size_t t_length) {
+            return t_length == VIDEO_ID_LENGTH and isBase64UrlId(t_id, t_length, 2);
+        }
+
+        static bool isValid(const std::string &t_id);
+
+        static bool tryParse(const std::string &t_id, VideoId &t_videoId);
+
+        static VideoId fromString(const std::string &t_id);
+
+        std::string toString() const;
+
+        constexpr uint64_t getValue() const {
+            return m_value;
+        }
+
+        /** SQLite INTEGER columns are signed, this is a plain bit cast. */
+        constexpr int64_t toInt64() const {
+            return (int64_t)m_value;
+        }
+
+        static constexpr VideoId fromInt64(int64_t t_value) {
+            return VideoId((uint64_t)t_value);
+        }
+
+        constexpr bool operator==(const VideoId &t_other) const {
+            return m_value == t_other.m_value;
+        }
+
+        constexpr bool operator!=(const VideoId &t_other) const {
+            return m_value != t_other.m_value;
+        }
+
+        constexpr bool operator<(const VideoId &t_other) const {
+            return m_value < t_other.m_value;
+        }
+
+    private:
+        uint64_t m_value = 0;
+    };
+
+    /**
+     * Which of a channel's IDs a ChannelId is: they all share the same 22 character body.
+     */
+    enum class ChannelIdTag : uint8_t {
+        Channel = 0,    // UC
+        Uploads,        // UU
+        Favourites,     // FL
+        Likes           // LL
+    };
+
+    /**
+     * A YouTube channel ID, or the ID of one of its uploads/favourites/likes playlists, packed into 128 bits plus
+     * a tag for the prefix.
+     *
+     * Switching between a channel and its playlists (withTag()) only swaps the tag, no string is built.
+     * The body converts to and from CHANNEL_ID_BYTES bytes for storing in an SQLite BLOB column.
+     */
+    class ChannelId {
+    public:
+        constexpr ChannelId() = default;
+
+        constexpr ChannelId(uint64_t t_high, uint64_t t_low, ChannelIdTag t_tag = ChannelIdTag::Channel)
+                : m_high(t_high), m_low(t_low), m_tag(t_tag) {}
+
+        /**
+         * Packs a body, which must be valid (see isValidBody()).
+         *
+         * @param t_body    CHANNEL_ID_BODY_LENGTH characters, i.e. the ID without its prefix.
+         * @param t_tag     Prefix of the ID.
+         */
+        static constexpr ChannelId encode(const char *t_body, ChannelIdTag t_tag = ChannelIdTag::Channel) {
+            uint64_t high = 0;
+            uint64_t low = 0;
+
+            for (int i = 0; i < CHANNEL_ID_BODY_LENGTH - 1; i++) {
+                high = (high << 6) | (low >> 58);
+                low = (low << 6) | (uint64_t)base64UrlValue(t_body[i]);
+            }
+            high = (high << 2) | (low >> 62);
+            low = (low << 2) | ((uint64_t)base64UrlValue(t_body[CHANNEL_ID_BODY_LENGTH - 1]) >> 4);
+
+            return ChannelId(high, low, t_tag);
+        }
+
+        /**
+         * Unpacks the body into CHANNEL_ID_BODY_LENGTH characters (no prefix, not NUL terminated).
+         */
+        constexpr void decode(char *t_body) const {
+            uint64_t high = m_high;
+            uint64_t low = m_low;
+
+            t_body[CHANNEL_ID_BODY_LENGTH - 1] = base64UrlChar((unsigned)(low & 0x3) << 4);
+            low = (low >> 2) | (high << 62);
+            high >>= 2;
+
+            for (int i = CHANNEL_ID_BODY_LENGTH - 2; i >= 0; i--) {
+                t_body[i] = base64UrlChar((unsigned)low);
+                low = (low >> 6) | (high << 58);
+                high >>= 6;
+            }
+        }
+
+        static constexpr bool isValidBody(const char *t_body, size_t t_length) {
+            return t_length == CHANNEL_ID_BODY_LENGTH and isBase64UrlId(t_body, t_length, 4);
+        }
+
+        static bool isValid(const std::string &t_id);
+
+        static bool tryParse(const std::string &t_id, ChannelId &t_channelId);
+
+        static bool tryParseBody(const std::string &t_body, ChannelIdTag t_tag, ChannelId &t_channelId);
+
+        static ChannelId fromString(const std::string &t_id);
+
+        static const char *getPrefix(ChannelIdTag t_tag);
+
+        std::string toString() const;
+
+        std::string toBodyString() const;
+
+        void toBytes(uint8_t *t_bytes) const;
+
+        static ChannelId fromBytes(const uint8_t *t_bytes, ChannelIdTag t_tag = ChannelIdTag::Channel);
+
+        constexpr ChannelId withTag(ChannelIdTag t_tag) const {
+            return ChannelId(m_high, m_low, t_tag);
+        }
+
+        constexpr ChannelIdTag getTag() const {
+            return m_tag;
+        }
+
+        constexpr uint64_t getHigh() const {
+            return m_high;
+        }
+
+        constexpr uint64_t getLow() const {
+            return m_low;
+        }
+
+        constexpr bool operator==(const ChannelId &t_other) const {
+            return m_high == t_other.m_high and m_low == t_other.m_low and m_tag == t_other.m_tag;
+        }
+
+        constexpr bool operator!=(const ChannelId &t_other) const {
+            return !(*this == t_other);
+        }
+
+        constexpr bool operator<(const ChannelId &t_other) const {
+            return m_high != t_other.m_high ? m_high < t_other.m_high :
+                   m_low != t_other.m_low ? m_low < t_other.m_low : m_tag < t_other.m_tag;
+        }
+
+    private:
+        uint64_t m_high = 0;
+        uint64_t m_low = 0;
+        ChannelIdTag m_tag = ChannelIdTag::Channel;
+    };
+} // namespace sane
+
+namespace std {
+    template<>
+    struct hash<sane::VideoId> {
+        size_t operator()(const sane::VideoId &t_id) const {
+            return (size_t)sane::mixPackedId(t_id.getValue());
+        }
+    };
+
+    template<>
+    struct hash<sane::ChannelId> {
+        size_t operator()(const sane::ChannelId &t_id) const {
+            uint64_t low = sane::mixPackedId(t_id.getLow() + (uint64_t)t_id.getTag());
+
+            return (size_t)sane::mixPackedId(t_id.getHigh() ^ low);
+        }
+    };
+} // namespace std
+
+#endif //SANE_PACKED_IDS_HPP
@@ -0,0 +1,84 @@
+#ifndef SANE_STRING_POOL_HPP
+#define SANE_STRING_POOL_HPP
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <ostream>
+#include <cstddef>
+#include <unordered_set>
+
+#define STRING_POOL_SHARDS  16
+
+namespace sane {
+    /**
+     * Handle to a string held by a StringPool.
+     *
+     * Only a pointer: cheap to copy, and two handles from the same pool are equal exactly when their strings are.
+     * A default constructed handle is the empty string.
+     */
+    class InternedString {
+    public:
+        InternedString();
+
+        const std::string &get() const {
+            return *m_string;
+        }
+
+        operator const std::string &() const {
+            return *m_string;
+        }
+
+        bool empty() const {
+            return m_string->empty();
+        }
+
+        bool operator==(const InternedString &t_other) const {
+            return m_string == t_other.m_string;
+        }
+
+        bool operator!=(const InternedString &t_other) const {
+            return m_string != t_other.m_string;
+        }
+
+    private:
+        friend class StringPool;
+
+        explicit InternedString(const std::string *t_string) : m_string(t_string) {}
+
+        const std::string *m_string;
+    };
+
+    std::ostream &operator<<(std::ostream &t_stream, const InternedString &t_string);
+
+    /**
+     * Thread-safe pool of unique strings, for entity fields that take the same few values over and over
+     * (channel IDs and titles, categories, languages, statuses, tags).
+     *
+     * Split into STRING_POOL_SHARDS independently locked hash sets, so parser threads rarely contend.
+     * Strings are never removed, a handle stays valid for as long as the pool lives.
+     */
+    class StringPool {
+    public:
+        InternedString intern(const std::string &t_string);
+
+        size_t size() const;
+
+        size_t getBytes() const;
+
+    private:
+        struct shard_t {
+            mutable std::mutex mutex;
+            std::unordered_set<std::string> strings;
+            size_t bytes = 0;
+        };
+
+        std::array<shard_t, STRING_POOL_SHARDS> m_shards;
+    };
+
+    StringPool &getStringPool();
+
+    InternedString internString(const std::string &t_string);
+} // namespace sane
+
+#endif //SANE_STRING_POOL_HPP
@@ -0,0 +1,89 @@
+#ifndef SANE_THUMBNAILS_HPP
+#define SANE_THUMBNAILS_HPP
+
+#include <map>
+#include <array>
+#include <string>
+#include <cstdint>
+
+#include <entities/common.hpp>
+
+#define THUMBNAIL_SIZE_COUNT                5
+#define YOUTUBE_VIDEO_THUMBNAIL_URL_PREFIX  "https://i.ytimg.com/vi/"
+
+namespace sane {
+    /**
+     * The sizes of a resource's "thumbnails" object, smallest first.
+     */
+    enum class ThumbnailSize : uint8_t {
+        Default,
+        Medium,
+        High,
+        Standard,
+        Maxres
+    };
+
+    const char *getThumbnailKey(ThumbnailSize t_size);
+
+    bool tryParseThumbnailKey(const std::string &t_key, ThumbnailSize &t_size);
+
+    std::string getVideoThumbnailUrl(const std::string &t_videoId, ThumbnailSize t_size);
+
+    /**
+     * The thumbnails of a video or channel: one fixed slot per ThumbnailSize and a bit for each slot that is set.
+     *
+     * Video thumbnail URLs are YOUTUBE_VIDEO_THUMBNAIL_URL_PREFIX + video ID + a file name per size, so when set()
+     * is given the video ID such URLs aren't stored but rebuilt by get(). Anything else (channel thumbnails, live
+     * previews) is kept in one buffer shared by all slots.
+     *
+     * encode() is the compact form for a database column, tryDecode() reads it back.
+     */
+    class Thumbnails {
+    public:
+        bool has(ThumbnailSize t_size) const;
+
+        bool empty() const;
+
+        uint8_t getPresence() const;
+
+        bool isUrlStored(ThumbnailSize t_size) const;
+
+        void set(ThumbnailSize t_size, const std::string &t_url, unsigned int t_width, unsigned int t_height,
+                 const std::string &t_videoId = std::string());
+
+        void erase(ThumbnailSize t_size);
+
+        thumbnail_t get(ThumbnailSize t_size, const std::string &t_videoId = std::string()) const;
+
+        std::string getUrl(ThumbnailSize t_size, const std::string &t_videoId = std::string()) const;
+
+        std::map<std::string, thumbnail_t> toMap(const std::string &t_videoId = std::string()) const;
+
+        std::string encode() const;
+
+        static bool tryDecode(const std::string &t_encoded, Thumbnails &t_thumbnails);
+
+        bool operator==(const Thumbnails &t_other) const;
+
+        bool operator!=(const Thumbnails &t_other) const;
+
+    private:
+        size_t findStoredUrl(ThumbnailSize t_size) const;
+
+        uint8_t m_present = 0;
+
+        // Slots whose URL is in m_urls.
+        uint8_t m_stored = 0;
+
+        std::array<uint16_t, THUMBNAIL_SIZE_COUNT> m_widths{};
+        std::array<uint16_t, THUMBNAIL_SIZE_COUNT> m_heights{};
+
+        // URLs that can't be rebuilt, in slot order, each one NUL terminated.
+        std::string m_urls;
+    };
+
+    Thumbnails getThumbnailsFromJson(const nlohmann::json &t_thumbnails, const std::string &t_videoId,
+                                     Diagnostics &t_diagnostics);
+} // namespace sane
+
+#endif //SANE_THUMBNAILS_HPP
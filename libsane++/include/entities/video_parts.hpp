@@ -0,0 +1,83 @@
+#ifndef SANE_VIDEO_PARTS_HPP
+#define SANE_VIDEO_PARTS_HPP
+
+#include <string>
+#include <cstdint>
+
+#define VIDEO_PART_COUNT    12
+
+namespace sane {
+    /**
+     * The parts of a videos.list() resource (besides id and kind, which are always there).
+     */
+    enum class VideoPart : uint8_t {
+        Snippet,
+        ContentDetails,
+        Statistics,
+        Status,
+        Player,
+        TopicDetails,
+        RecordingDetails,
+        FileDetails,
+        ProcessingDetails,
+        Suggestions,
+        LiveStreamingDetails,
+        Localizations
+    };
+
+    const char *getVideoPartKey(VideoPart t_part);
+
+    /**
+     * Set of video parts, one bit per VideoPart.
+     *
+     * The "part" parameter of a videos.list() request is parsed into one of these once, and the same set then both
+     * builds the request (toString()) and decides which parts the response is parsed for.
+     */
+    class VideoParts {
+    public:
+        constexpr VideoParts() : m_bits(0) {}
+
+        constexpr explicit VideoParts(uint16_t t_bits) : m_bits(t_bits) {}
+
+        static VideoParts parse(const std::string &t_part);
+
+        static constexpr VideoParts all() {
+            return VideoParts((uint16_t)((1u << VIDEO_PART_COUNT) - 1));
+        }
+
+        constexpr bool has(VideoPart t_part) const {
+            return ((m_bits >> (unsigned)t_part) & 1u) != 0;
+        }
+
+        constexpr VideoParts with(VideoPart t_part) const {
+            return VideoParts((uint16_t)(m_bits | (1u << (unsigned)t_part)));
+        }
+
+        constexpr bool empty() const {
+            return m_bits == 0;
+        }
+
+        constexpr uint16_t getBits() const {
+            return m_bits;
+        }
+
+        std::string toString() const;
+
+        constexpr VideoParts operator|(const VideoParts &t_other) const {
+            return VideoParts((uint16_t)(m_bits | t_other.m_bits));
+        }
+
+        constexpr bool operator==(const VideoParts &t_other) const {
+            return m_bits == t_other.m_bits;
+        }
+
+        constexpr bool operator!=(const VideoParts &t_other) const {
+            return m_bits != t_other.m_bits;
+        }
+
+    private:
+        uint16_t m_bits;
+    };
+} // namespace sane
+
+#endif //SANE_VIDEO_PARTS_HPP
@@ -0,0 +1,102 @@
+#ifndef SANE_VIDEO_TABLE_HPP
+#define SANE_VIDEO_TABLE_HPP
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <entities/feed_item.hpp>
+#include <entities/youtube_video.hpp>
+
+namespace sane {
+    /**
+     * Rows picked out by VideoTable's filter kernels, one byte per row (1 = selected).
+     *
+     * A byte rather than a bit per row, so every kernel is a straight, branch-free loop the compiler vectorizes.
+     */
+    typedef std::vector<uint8_t> selection_t;
+
+    /**
+     * Columnar (struct-of-arrays) store of feed videos, for scanning and filtering large, long-lived feeds.
+     *
+     * Every field lives in its own contiguous column, so a filter on e.g. publish date only streams through the
+     * 8 bytes per row it needs. Titles are kept back to back in a single arena and channels are interned.
+     */
+    class VideoTable {
+    public:
+        void reserve(size_t t_rows, size_t t_titleBytes = 0);
+
+        size_t size() const;
+
+        void clear();
+
+        /** Building */
+        uint32_t internChannel(const ChannelId &t_channelId, const std::string &t_channelTitle);
+
+        uint32_t internChannel(const std::string &t_channelId, const std::string &t_channelTitle);
+
+        void append(const VideoId &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel,
+                    const std::string &t_title, uint32_t t_durationSeconds, uint8_t t_flags);
+
+        void append(const std::string &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel,
+                    const std::string &t_title, uint32_t t_durationSeconds, uint8_t t_flags);
+
+        void append(const std::vector<FeedItem> &t_items, const FeedChannelTable &t_channels);
+
+        bool appendResponse(const std::string &t_body);
+
+        void append(const std::list<std::shared_ptr<YoutubeVideo>> &t_videos);
+
+        /** Row access */
+        const VideoId &getVideoId(size_t t_row) const;
+
+        std::string getId(size_t t_row) const;
+
+        int64_t getPublishedAtMs(size_t t_row) const;
+
+        uint32_t getChannel(size_t t_row) const;
+
+        std::string getTitle(size_t t_row) const;
+
+        uint32_t getDurationSeconds(size_t t_row) const;
+
+        uint8_t getFlags(size_t t_row) const;
+
+        const FeedChannelTable &getChannels() const;
+
+        /** Scan/filter kernels, each narrows down a selection */
+        selection_t selectAll() const;
+
+        void filterPublishedBetween(int64_t t_fromMs, int64_t t_toMs, selection_t &t_selection) const;
+
+        void filterChannel(uint32_t t_channel, selection_t &t_selection) const;
+
+        void filterDurationBetween(uint32_t t_minSeconds, uint32_t t_maxSeconds, selection_t &t_selection) const;
+
+        void filterFlags(uint8_t t_required, uint8_t t_excluded, selection_t &t_selection) const;
+
+        static size_t countSelected(const selection_t &t_selection);
+
+        static std::vector<uint32_t> getSelectedRows(const selection_t &t_selection);
+
+        std::vector<uint32_t> sortByPublishedDescending(std::vector<uint32_t> t_rows) const;
+
+    private:
+        std::vector<int64_t> m_publishedAtMs;
+        std::vector<uint32_t> m_channel;
+        std::vector<uint32_t> m_durationSeconds;
+        std::vector<uint8_t> m_flags;
+
+        std::vector<VideoId> m_ids;
+
+        // Row n's title is m_titleArena[m_titleOffsets[n], m_titleOffsets[n + 1]).
+        std::vector<uint32_t> m_titleOffsets{0};
+        std::string m_titleArena;
+
+        FeedChannelTable m_channels;
+    };
+} // namespace sane
+
+#endif //SANE_VIDEO_TABLE_HPP
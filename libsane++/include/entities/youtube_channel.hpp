@@ -3,11 +3,14 @@
 
 #include <map>
 #include <list>
+#include <utility>
 
 // 3rd party libraries.
 #include <nlohmann/json.hpp>
 
 #include <entities/common.hpp>
+#include <entities/packed_ids.hpp>
+#include <entities/thumbnails.hpp>
 
 namespace sane {
     /**
@@ -21,11 +24,16 @@ namespace sane {
         // Create an empty instance, to be populated later.
         explicit YoutubeChannel();
 
-        // Create an instance and feed it values through a JSON.
-        explicit YoutubeChannel(nlohmann::json &t_data) {
+        // Create an instance and feed it values through a copy of a JSON.
+        explicit YoutubeChannel(const nlohmann::json &t_data) {
             addFromJson(t_data);
         }
 
+        // Create an instance from a JSON that is no longer needed, its strings are moved instead of copied.
+        explicit YoutubeChannel(nlohmann::json &&t_data) {
+            addFromJson(std::move(t_data));
+        }
+
         // Create an instance and feed it values through a map of strings.
         explicit YoutubeChannel(std::map<std::string, std::string> &t_map) {
             addFromMap(t_map);
@@ -70,7 +78,9 @@ namespace sane {
                           t_subscribedLocalOverride);
         }
 
-        void addFromJson(nlohmann::json t_json);
+        void addFromJson(const nlohmann::json &t_json);
+
+        void addFromJson(nlohmann::json &&t_json);
 
         void addFromValues(const char* t_id, const char* t_uploadsPlaylist,
                            const char* t_favouritesPlaylist, const char* t_likesPlaylist,
@@ -98,18 +108,18 @@ namespace sane {
 
         void print(int indentationSpacing);
 
-        // Each error/warning map has error message as key and JSON as value.
-        void addError(const std::string &t_errorMsg, nlohmann::json t_json = nlohmann::json::object());
+        // Free-form problems, with the JSON they concern (if any).
+        void addError(const std::string &t_errorMsg, const nlohmann::json &t_json = nlohmann::json());
 
-        void addWarning(const std::string &t_warningMsg, nlohmann::json t_json = nlohmann::json::object());
+        void addWarning(const std::string &t_warningMsg, const nlohmann::json &t_json = nlohmann::json());
 
-        void reportProblems(std::map<std::string, std::string> &t_problems);
+        const Diagnostics &getDiagnostics() const;
 
-        std::list<std::map<std::string, nlohmann::json>> getErrors();
+        size_t getErrorCount() const;
 
         void printErrors(int indent = 0, bool withJson = false, int jsonIndent = 0);
 
-        std::list<std::map<std::string, nlohmann::json>> getWarnings();
+        size_t getWarningCount() const;
 
         void printWarnings(int indent = 0, bool withJson = false, int jsonIndent = 0);
 
@@ -127,35 +137,46 @@ namespace sane {
 
         const std::string getFavouritesPlaylist();
 
+        // NB: The JSON setters move strings out of the JSON they are given.
         const std::string &getId() const;
 
-        void setId(const std::string &t_id);
+        void setId(std::string t_id);
 
-        void setId(nlohmann::json t_id);
+        void setId(nlohmann::json &t_id);
 
         const std::string getChannelId();
 
+        const ChannelId &getPackedId() const;
+
+        ChannelId getUploadsPlaylistId() const;
+
         const std::string &getDescription() const;
 
-        void setDescription(const std::string &t_description);
+        void setDescription(std::string t_description);
 
         void setDescription(nlohmann::json &t_description);
 
         const std::string &getPublishedAt() const;
 
-        void setPublishedAt(const std::string &t_publishedAt);
+        void setPublishedAt(std::string t_publishedAt);
 
         void setPublishedAt(nlohmann::json &t_publishedAt);
 
-        const std::map<std::string, thumbnail_t> &getThumbnails() const;
+        std::map<std::string, thumbnail_t> getThumbnails() const;
+
+        thumbnail_t getThumbnail(ThumbnailSize t_size) const;
+
+        const Thumbnails &getPackedThumbnails() const;
 
         void setThumbnails(const std::map<std::string, thumbnail_t> &t_thumbnails);
 
+        void setThumbnails(Thumbnails t_thumbnails);
+
         void setThumbnails(nlohmann::json &t_thumbnails);
 
         const std::string &getTitle() const;
 
-        void setTitle(const std::string &t_title);
+        void setTitle(std::string t_title);
 
         void setTitle(nlohmann::json &t_title);
 
@@ -185,6 +206,9 @@ namespace sane {
         // NB: Grab the one inside resourceId, the outer one is *yours*.
         std::string m_id;
 
+        // m_id packed (tagged as the channel ID), kept in sync by setId().
+        ChannelId m_packedId;
+
         // Playlists (only need bool as they are supersets of ID)
         bool m_hasFavouritesPlaylist = false;
         bool m_hasUploadsPlaylist = false;
@@ -201,18 +225,15 @@ namespace sane {
         // The value is specified in ISO 8601 (YYYY-MM-DDThh:mm:ss.sZ) format.
         std::string m_publishedAt;
 
-        // A map of thumbnail images associated with the subscription.
-        // Should in most cases contain keys: "default", "high" and "medium".
-        std::map<std::string, thumbnail_t> m_thumbnails;
+        // Thumbnail images associated with the subscription.
+        // Should in most cases have the default, high and medium sizes.
+        Thumbnails m_thumbnails;
 
         // Subscription/Channel title.
         std::string m_title;
 
-        // Track errors that occur
-        std::list<std::map<std::string, nlohmann::json>> m_errors;
-
-        // Track warnings that occur
-        std::list<std::map<std::string, nlohmann::json>> m_warnings;
+        // Track errors and warnings that occur
+        Diagnostics m_diagnostics;
 
         // Indicate whether the operation was aborted
         bool m_aborted = false;
@@ -1,15 +1,17 @@
 #ifndef SANE_YOUTUBE_VIDEO_HPP
 #define SANE_YOUTUBE_VIDEO_HPP
 
-#include <list>
 #include <map>
 #include <vector>
 #include <string>
-#include <list>
+#include <utility>
 
 #include <nlohmann/json.hpp>
 
 #include <entities/common.hpp>
+#include <entities/string_pool.hpp>
+#include <entities/thumbnails.hpp>
+#include <entities/video_parts.hpp>
 
 // TODO: Change a lot of string variables to ints and define some constants instead?
 
@@ -112,7 +114,7 @@ namespace sane {
         // on the video category that the video uploader associates with the video.
         // By default, tag suggestions are relevant for all categories
         // if there are no restricts defined for the keyword.
-        std::list<std::string> categoryRestricts;
+        std::vector<std::string> categoryRestricts;
     };
 
     /**
@@ -140,29 +142,58 @@ namespace sane {
         // Create an empty instance, to be populated later.
         explicit YoutubeVideo();
 
-        // Create an instance and feed it values through a JSON.
-        explicit YoutubeVideo(nlohmann::json &t_data) {
-            addFromJson(t_data);
+        // Create an instance and feed it values through a copy of a JSON.
+        explicit YoutubeVideo(const nlohmann::json &t_data, VideoParts t_parts = VideoParts::all()) {
+            addFromJson(t_data, t_parts);
+        }
+
+        // Create an instance from a JSON that is no longer needed, its strings are moved instead of copied.
+        explicit YoutubeVideo(nlohmann::json &&t_data, VideoParts t_parts = VideoParts::all()) {
+            addFromJson(std::move(t_data), t_parts);
         }
 
 //        void assignValue(nlohmann::json &t_json);
 
-        void addFromJson(nlohmann::json t_json);
+        void addFromJson(const nlohmann::json &t_json, VideoParts t_parts = VideoParts::all());
+
+        void addFromJson(nlohmann::json &&t_json, VideoParts t_parts = VideoParts::all());
+
+        void addSnippetFromJson(nlohmann::json &t_snippet);
+
+        void addContentDetailsFromJson(nlohmann::json &t_contentDetails);
+
+        void addStatusFromJson(nlohmann::json &t_status);
+
+        void addStatisticsFromJson(nlohmann::json &t_statistics);
+
+        void addTopicDetailsFromJson(nlohmann::json &t_topicDetails);
+
+        void addRecordingDetailsFromJson(nlohmann::json &t_recordingDetails);
+
+        void addFileDetailsFromJson(nlohmann::json &t_fileDetails);
+
+        void addProcessingDetailsFromJson(nlohmann::json &t_processingDetails);
+
+        void addSuggestionsFromJson(nlohmann::json &t_suggestions);
+
+        bool hasPart(VideoPart t_part) const;
+
+        VideoParts getParts() const;
 
         void print(int t_indentationSpacing, bool t_printFullInfo=false);
 
-        // Each error/warning map has error message as key and JSON as value.
-        void addError(const std::string &t_errorMsg, nlohmann::json t_json = nlohmann::json::object());
+        // Free-form problems, with the JSON they concern (if any).
+        void addError(const std::string &t_errorMsg, const nlohmann::json &t_json = nlohmann::json());
 
-        void addWarning(const std::string &t_warningMsg, nlohmann::json t_json = nlohmann::json::object());
+        void addWarning(const std::string &t_warningMsg, const nlohmann::json &t_json = nlohmann::json());
 
-        void reportProblems(std::map<std::string, std::string> &t_problems);
+        const Diagnostics &getDiagnostics() const;
 
-        std::list<std::map<std::string, nlohmann::json>> getErrors();
+        size_t getErrorCount() const;
 
         void printErrors(int indent = 0, bool withJson = false, int jsonIndent = 0);
 
-        std::list<std::map<std::string, nlohmann::json>> getWarnings();
+        size_t getWarningCount() const;
 
         void printWarnings(int indent = 0, bool withJson = false, int jsonIndent = 0);
 
@@ -175,12 +206,13 @@ namespace sane {
         bool wasAborted();
 
         // START: Getters & Setters.
+        // NB: The JSON setters (and the add*FromJson part parsers) move strings out of the JSON they are given.
 
         const std::string &getId() const;
 
-        void setId(const std::string &t_id);
+        void setId(std::string t_id);
 
-        void setId(nlohmann::json t_id);
+        void setId(nlohmann::json &t_id);
 
         datetime_t getPublishedAt();
 
@@ -196,20 +228,26 @@ namespace sane {
 
         const std::string &getTitle() const;
 
-        void setTitle(const std::string &t_title);
+        void setTitle(std::string t_title);
 
         void setTitle(nlohmann::json &t_title);
 
         const std::string &getDescription() const;
 
-        void setDescription(const std::string &t_description);
+        void setDescription(std::string t_description);
 
         void setDescription(nlohmann::json &t_description);
 
-        const std::map<std::string, thumbnail_t> &getThumbnails() const;
+        std::map<std::string, thumbnail_t> getThumbnails() const;
+
+        thumbnail_t getThumbnail(ThumbnailSize t_size) const;
+
+        const Thumbnails &getPackedThumbnails() const;
 
         void setThumbnails(const std::map<std::string, thumbnail_t> &t_thumbnails);
 
+        void setThumbnails(Thumbnails t_thumbnails);
+
         void setThumbnails(nlohmann::json &t_thumbnails);
 
         const std::string &getChannelTitle() const;
@@ -218,9 +256,9 @@ namespace sane {
 
         void setChannelTitle(nlohmann::json &t_channelTitle);
 
-        const std::list<std::string> &getTags() const;
+        const std::vector<InternedString> &getTags() const;
 
-        void setTags(const std::list<std::string> &t_tags);
+        void setTags(const std::vector<std::string> &t_tags);
 
         void setTags(nlohmann::json &t_tags);
 
@@ -244,13 +282,13 @@ namespace sane {
 
         const std::string &getLocalizedTitle() const;
 
-        void setLocalizedTitle(const std::string &t_localizedTitle);
+        void setLocalizedTitle(std::string t_localizedTitle);
 
         void setLocalizedTitle(nlohmann::json &t_localizedTitle);
 
         const std::string &getLocalizedDescription() const;
 
-        void setLocalizedDescription(const std::string &t_localizedDescription);
+        void setLocalizedDescription(std::string t_localizedDescription);
 
         void setLocalizedDescription(nlohmann::json &t_localizedDescription);
 
@@ -262,7 +300,7 @@ namespace sane {
 
         const std::string &getDuration() const;
 
-        void setDuration(const std::string &t_duration);
+        void setDuration(std::string t_duration);
 
         void setDuration(nlohmann::json &t_duration);
 
@@ -294,15 +332,15 @@ namespace sane {
 
         void setIsLicensedContent(nlohmann::json &t_isLicensedContent);
 
-        const std::list<std::string> &getRegionRestrictionWhitelist() const;
+        const std::vector<std::string> &getRegionRestrictionWhitelist() const;
 
-        void setRegionRestrictionWhitelist(const std::list<std::string> &t_regionRestrictionWhitelist);
+        void setRegionRestrictionWhitelist(std::vector<std::string> t_regionRestrictionWhitelist);
 
         void setRegionRestrictionWhitelist(nlohmann::json &t_regionRestrictionWhitelist);
 
-        const std::list<std::string> &getRegionRestrictionBlacklist() const;
+        const std::vector<std::string> &getRegionRestrictionBlacklist() const;
 
-        void setRegionRestrictionBlacklist(const std::list<std::string> &t_regionRestrictionBlacklist);
+        void setRegionRestrictionBlacklist(std::vector<std::string> t_regionRestrictionBlacklist);
 
         void setRegionRestrictionBlacklist(nlohmann::json &t_regionRestrictionBlacklist);
 
@@ -330,13 +368,13 @@ namespace sane {
 
         const std::string &getFailureReason() const;
 
-        void setFailureReason(const std::string &t_failureReason);
+        void setFailureReason(std::string t_failureReason);
 
         void setFailureReason(nlohmann::json &t_failureReason);
 
         const std::string &getRejectionReason() const;
 
-        void setRejectionReason(const std::string &t_rejectionReason);
+        void setRejectionReason(std::string t_rejectionReason);
 
         void setRejectionReason(nlohmann::json &t_rejectionReason);
 
@@ -348,7 +386,7 @@ namespace sane {
 
         const std::string &getPublishAt() const;
 
-        void setPublishAt(const std::string &t_publishAt);
+        void setPublishAt(std::string t_publishAt);
 
         void setPublishAt(nlohmann::json &t_publishAt);
 
@@ -396,25 +434,25 @@ namespace sane {
 
         const player_t &getPlayer() const;
 
-        void setPlayer(const player_t &t_player);
+        void setPlayer(player_t t_player);
 
         void setPlayer(nlohmann::json &t_player);
 
-        const std::list<std::string> &getTopicCategories() const;
+        const std::vector<std::string> &getTopicCategories() const;
 
-        void setTopicCategories(const std::list<std::string> &t_topicCategories);
+        void setTopicCategories(std::vector<std::string> t_topicCategories);
 
         void setTopicCategories(nlohmann::json &t_topicCategories);
 
         const std::string &getRecordingDate() const;
 
-        void setRecordingDate(const std::string &t_recordingDate);
+        void setRecordingDate(std::string t_recordingDate);
 
         void setRecordingDate(nlohmann::json &t_recordingDate);
 
         const std::string &getFileName() const;
 
-        void setFileName(const std::string &t_fileName);
+        void setFileName(std::string t_fileName);
 
         void setFileName(nlohmann::json &t_fileName);
 
@@ -426,25 +464,25 @@ namespace sane {
 
         const std::string &getFileType() const;
 
-        void setFileType(const std::string &t_fileType);
+        void setFileType(std::string t_fileType);
 
         void setFileType(nlohmann::json &t_fileType);
 
         const std::string &getContainer() const;
 
-        void setContainer(const std::string &t_container);
+        void setContainer(std::string t_container);
 
         void setContainer(nlohmann::json &t_container);
 
-        const std::list<videoStream_t> &getVideoStreams() const;
+        const std::vector<videoStream_t> &getVideoStreams() const;
 
-        void setVideoStreams(const std::list<videoStream_t> &t_videoStreams);
+        void setVideoStreams(std::vector<videoStream_t> t_videoStreams);
 
         void setVideoStreams(nlohmann::json &t_videoStreams);
 
-        const std::list<audioStream_t> &getAudioStreams() const;
+        const std::vector<audioStream_t> &getAudioStreams() const;
 
-        void setAudioStreams(const std::list<audioStream_t> &t_audioStreams);
+        void setAudioStreams(std::vector<audioStream_t> t_audioStreams);
 
         void setAudioStreams(nlohmann::json &t_audioStreams);
 
@@ -462,97 +500,97 @@ namespace sane {
 
         const std::string &getCreationTime() const;
 
-        void setCreationTime(const std::string &t_creationTime);
+        void setCreationTime(std::string t_creationTime);
 
         void setCreationTime(nlohmann::json &t_creationTime);
 
         const std::string &getProcessingStatus() const;
 
-        void setProcessingStatus(const std::string &t_processingStatus);
+        void setProcessingStatus(std::string t_processingStatus);
 
         void setProcessingStatus(nlohmann::json &t_processingStatus);
 
         const processingProgress_t &getProcessingProgress() const;
 
-        void setProcessingProgress(const processingProgress_t &t_processingProgress);
+        void setProcessingProgress(processingProgress_t t_processingProgress);
 
         void setProcessingProgress(nlohmann::json &t_processingProgress);
 
         const std::string &getProcessingFailureReason() const;
 
-        void setProcessingFailureReason(const std::string &t_processingFailureReason);
+        void setProcessingFailureReason(std::string t_processingFailureReason);
 
         void setProcessingFailureReason(nlohmann::json &t_processingFailureReason);
 
         const std::string &getProcessingIssuesAvailability() const;
 
-        void setProcessingIssuesAvailability(const std::string &t_processingIssuesAvailability);
+        void setProcessingIssuesAvailability(std::string t_processingIssuesAvailability);
 
         void setProcessingIssuesAvailability(nlohmann::json &t_processingIssuesAvailability);
 
         const std::string &getFileDetailsAvailability() const;
 
-        void setFileDetailsAvailability(const std::string &t_fileDetailsAvailability);
+        void setFileDetailsAvailability(std::string t_fileDetailsAvailability);
 
         void setFileDetailsAvailability(nlohmann::json &t_fileDetailsAvailability);
 
         const std::string &getTagSuggestionsAvailability() const;
 
-        void setTagSuggestionsAvailability(const std::string &t_tagSuggestionsAvailability);
+        void setTagSuggestionsAvailability(std::string t_tagSuggestionsAvailability);
 
         void setTagSuggestionsAvailability(nlohmann::json &t_tagSuggestionsAvailability);
 
         const std::string &getEditorSuggestionsAvailability() const;
 
-        void setEditorSuggestionsAvailability(const std::string &t_editorSuggestionsAvailability);
+        void setEditorSuggestionsAvailability(std::string t_editorSuggestionsAvailability);
 
         void setEditorSuggestionsAvailability(nlohmann::json &t_editorSuggestionsAvailability);
 
         const std::string &getThumbnailsAvailability() const;
 
-        void setThumbnailsAvailability(const std::string &t_thumbnailsAvailability);
+        void setThumbnailsAvailability(std::string t_thumbnailsAvailability);
 
         void setThumbnailsAvailability(nlohmann::json &t_thumbnailsAvailability);
 
-        const std::list<std::string> &getProcessingErrors() const;
+        const std::vector<std::string> &getProcessingErrors() const;
 
-        void setProcessingErrors(const std::list<std::string> &t_processingErrors);
+        void setProcessingErrors(std::vector<std::string> t_processingErrors);
 
         void setProcessingErrors(nlohmann::json &t_processingErrors);
 
-        const std::list<std::string> &getProcessingWarnings() const;
+        const std::vector<std::string> &getProcessingWarnings() const;
 
-        void setProcessingWarnings(const std::list<std::string> &t_processingWarnings);
+        void setProcessingWarnings(std::vector<std::string> t_processingWarnings);
 
         void setProcessingWarnings(nlohmann::json &t_processingWarnings);
 
-        const std::list<std::string> &getProcessingHints() const;
+        const std::vector<std::string> &getProcessingHints() const;
 
-        void setProcessingHints(const std::list<std::string> &t_processingHints);
+        void setProcessingHints(std::vector<std::string> t_processingHints);
 
         void setProcessingHints(nlohmann::json &t_processingHints);
 
-        const std::list<tagSuggestion_t> &getTagSuggestions() const;
+        const std::vector<tagSuggestion_t> &getTagSuggestions() const;
 
-        void setTagSuggestions(const std::list<tagSuggestion_t> &t_tagSuggestions);
+        void setTagSuggestions(std::vector<tagSuggestion_t> t_tagSuggestions);
 
         void setTagSuggestions(nlohmann::json &t_tagSuggestions);
 
-        const std::list<std::string> &getEditorSuggestions() const;
+        const std::vector<std::string> &getEditorSuggestions() const;
 
-        void setEditorSuggestions(const std::list<std::string> &t_editorSuggestions);
+        void setEditorSuggestions(std::vector<std::string> t_editorSuggestions);
 
         void setEditorSuggestions(nlohmann::json &t_editorSuggestions);
 
         liveStreamingDetails_t getLiveStreamingDetails();
 
-        void setLiveStreamingDetails(const liveStreamingDetails_t &t_liveStreamingDetails);
+        void setLiveStreamingDetails(liveStreamingDetails_t t_liveStreamingDetails);
 
         void setLiveStreamingDetails(nlohmann::json &t_liveStreamingDetails);
 
         const std::map<std::string, localization_t> &getLocalizations() const;
 
-        void setLocalizations(const std::map<std::string, localization_t> &t_localizations);
+        void setLocalizations(std::map<std::string, localization_t> t_localizations);
 
         void setLocalizations(nlohmann::json &t_localizations);
 
@@ -562,11 +600,8 @@ namespace sane {
         /**
          * Entity Internal.
          */
-        // Track errors that occur
-        std::list<std::map<std::string, nlohmann::json>> m_errors;
-
-        // Track warnings that occur
-        std::list<std::map<std::string, nlohmann::json>> m_warnings;
+        // Track errors and warnings that occur
+        Diagnostics m_diagnostics;
 
         // Indicate whether the operation was aborted
         bool m_aborted = false;
@@ -578,18 +613,7 @@ namespace sane {
         std::string m_id;
 
         // Track which parts/scopes have actually been supplied, in order to know which values actually got set.
-        bool hasPartSnippet = false;
-        bool hasPartContentDetails = false;
-        bool hasPartStatus = false;
-        bool hasPartStatistics = false;
-        bool hasPartPlayer = false;
-        bool hasPartTopicDetails = false;
-        bool hasPartRecordingDetails = false;
-        bool hasPartFileDetails = false;
-        bool hasPartProcessingDetails = false;
-        bool hasPartSuggestions = false;
-        bool hasPartLiveStreamingDetails = false;
-        bool hasPartLocalizations = false;
+        VideoParts m_parts;
 
         /**
          * SNIPPET
@@ -599,33 +623,34 @@ namespace sane {
         // The value is specified in ISO 8601 (YYYY-MM-DDThh:mm:ss.sZ) format.
         datetime_t m_publishedAt;    // TODO: Make it proper datetime type?
 
-        std::string m_channelId;
+        // Fields that repeat across videos (channel, category, languages, statuses, tags) are interned strings.
+        InternedString m_channelId;
 
         std::string m_title;
 
         std::string m_description;
 
-        // Valid keys: "default", "medium", "high", "standard" and "maxres".
-        std::map<std::string, thumbnail_t> m_thumbnails;
+        // The i.ytimg.com URLs aren't stored, they are rebuilt from m_id.
+        Thumbnails m_thumbnails;
 
-        std::string m_channelTitle;
+        InternedString m_channelTitle;
 
         // A list of keyword tags associated with the video. Tags may contain spaces.
         // The property value has a maximum length of 500 characters
-        std::list<std::string> m_tags;
+        std::vector<InternedString> m_tags;
 
-        std::string m_categoryId;
+        InternedString m_categoryId;
 
         // Indicates if the video is an upcoming/active live broadcast.
         // Or it's "none" if the video is not an upcoming/active live broadcast.
         // Valid values: "live", "none" and "upcoming"
-        std::string m_liveBroadcastContent;
+        InternedString m_liveBroadcastContent;
 
         // The language of the text in the video resource's snippet.title and snippet.description properties.
-        std::string m_defaultLanguage;
+        InternedString m_defaultLanguage;
         std::string m_localizedTitle;
         std::string m_localizedDescription;
-        std::string m_defaultAudioLanguage;
+        InternedString m_defaultAudioLanguage;
 
         /**
          * CONTENT DETAILS
@@ -648,10 +673,10 @@ namespace sane {
         bool m_isLicensedContent = false;
 
         // A list of region codes that identify countries where the video is viewable.
-        std::list<std::string> m_regionRestrictionWhitelist;
+        std::vector<std::string> m_regionRestrictionWhitelist;
 
         // A list of region codes that identify countries where the video is blocked
-        std::list<std::string> m_regionRestrictionBlacklist;
+        std::vector<std::string> m_regionRestrictionBlacklist;
 
         // TODO: SKIPPING content ratings for now.
 
@@ -669,7 +694,7 @@ namespace sane {
          * Contains information about the video's uploading, processing, and privacy statuses.
          * */
         // The status of the uploaded video. Valid values: "deleted", "failed", "processed", "rejected" and "uploaded".
-        std::string m_uploadStatus;
+        InternedString m_uploadStatus;
 
         // This value explains why a video failed to upload.
         // This property is only present if the uploadStatus property indicates that the upload failed.
@@ -683,14 +708,14 @@ namespace sane {
         std::string m_rejectionReason;
 
         // Valid values: "private", "public" and "unlisted".
-        std::string m_privacyStatus;
+        InternedString m_privacyStatus;
 
         // The date and time when the video is scheduled to publish.
         // It can be set only if the privacy status of the video is private. The value is specified in ISO 8601.
         std::string m_publishAt;  // TODO: Make it proper datetime type?
 
         // Valid values: "creativeCommon" and "youtube".
-        std::string m_license;
+        InternedString m_license;
 
         // This value indicates whether the video can be embedded on another website.
         bool m_isEmbeddable = false;
@@ -719,7 +744,7 @@ namespace sane {
          * Information about topics associated with the video.
          * */
         // A list of Wikipedia URLs that provide a high-level description of the video's content.
-        std::list<std::string> m_topicCategories;
+        std::vector<std::string> m_topicCategories;
 
         /**
          * RECORDING DETAILS
@@ -741,8 +766,8 @@ namespace sane {
         std::string m_fileType;
         // The uploaded video file's container format.
         std::string m_container;
-        std::list<videoStream_t> m_videoStreams;
-        std::list<audioStream_t> m_audioStreams;
+        std::vector<videoStream_t> m_videoStreams;
+        std::vector<audioStream_t> m_audioStreams;
         // The length of the uploaded video in milliseconds.
         unsigned long m_durationMs{};
         // The uploaded video file's combined (video and audio) bitrate in bits per second.
@@ -802,7 +827,7 @@ namespace sane {
         // These errors indicate that, regardless of the video's current processing status, eventually,
         // that status will almost certainly be failed.
         // Valid values: "archiveFile", "audioFile", "docFile", "imageFile", "notAVideoFile" and "projectFile"
-        std::list<std::string> m_processingErrors;
+        std::vector<std::string> m_processingErrors;
 
         // A list of reasons why YouTube may have difficulty transcoding the uploaded video or that might
         // result in an erroneous transcoding. These warnings are generated before YouTube actually processes
@@ -811,20 +836,20 @@ namespace sane {
         // or a missing audio track.
         // Valid values: "hasEditlist", "inconsistentResolution", "problematicAudioCodec", "problematicVideoCodec",
         //               "unknownAudioCodec", "unknownContainer" and "unknownVideoCodec".
-        std::list<std::string> m_processingWarnings;
+        std::vector<std::string> m_processingWarnings;
 
         // A list of suggestions that may improve YouTube's ability to process the video.
         // Valid values: "nonStreamableMov" and "sendBestQualityVideo".
-        std::list<std::string> m_processingHints;
+        std::vector<std::string> m_processingHints;
 
         // A list of keyword tags that could be added to the video's metadata to increase the likelihood
         // that users will locate your video when searching or browsing on YouTube.
-        std::list<tagSuggestion_t> m_tagSuggestions;
+        std::vector<tagSuggestion_t> m_tagSuggestions;
 
         // A list of video editing operations that might improve the
         // video quality or playback experience of the uploaded video.
         // Valid values: "audioQuietAudioSwap", "videoAutoLevels", "videoCrop" and "videoStabilize".
-        std::list<std::string> m_editorSuggestions;
+        std::vector<std::string> m_editorSuggestions;
 
         /**
          * LIVE STREAMING DETAILS
@@ -2,40 +2,79 @@
 #define SANE_LIST_VIDEOS_THREAD_HPP
 
 #include <string>
-#include <thread>
 #include <map>
+#include <atomic>
+#include <memory>
 #include <entities/youtube_video.hpp>
+#include <entities/video_parts.hpp>
+#include <api_handler/request_context.hpp>
+#include <concurrency/mpsc_queue.hpp>
+#include <concurrency/bounded_queue.hpp>
+#ifdef SANE_ENABLE_COROUTINES
+#include <concurrency/task.hpp>
+#include <api_handler/event_loop.hpp>
+#endif
 
 
 namespace sane {
+    /**
+     * What a ListVideosThread hands back once it is done with its playlist.
+     */
+    struct listVideosResult_t {
+        std::string playlistId;
+        // Average transfer time per successful API request (ms, -1 if none) and whether the API signalled
+        // overload (429/5xx).
+        long latencyMs = -1;
+        bool overloaded = false;
+        // Cut short by the refresh's cancellation or deadline.
+        bool aborted = false;
+    };
+
     class ListVideosThread {
     public:
-        ListVideosThread(const std::string &t_part,
+        ListVideosThread(VideoParts t_parts,
                          const std::map<std::string, std::string> &t_filter,
                          const std::map<std::string, std::string> &t_optParams,
-                         const std::string &t_playlistItemsPart);
+                         const std::string &t_playlistItemsPart,
+                         const requestContext_t &t_context = requestContext_t(),
+                         std::shared_ptr<MPSCQueue<listVideosResult_t>> t_completionQueue = nullptr,
+                         std::shared_ptr<BoundedQueue<std::shared_ptr<const std::string>>> t_bodyQueue = nullptr);
 
         void listVideos();
 
+#ifdef SANE_ENABLE_COROUTINES
+        Task<void> listVideosAsync(EventLoop &t_loop);
+#endif
+
         void run();
 
         nlohmann::json get();
 
         std::string getPlaylist();
 
-        void setThreadId(std::thread::id id);
+        long getLatency();
 
-        std::thread::id getThreadId();
+        bool wasOverloaded();
 
-        bool finished = false;
-        bool started = false;
     private:
         nlohmann::json videosJson;
-        std::thread::id m_threadId;
+        // Parts to request, and the "part" parameter made from them.
+        VideoParts m_parts;
         std::string m_part;
         std::map<std::string, std::string> m_filter;
         std::map<std::string, std::string> m_optParams;
         std::string m_playlistItemsPart;
+        requestContext_t m_context;
+        // Average transfer time per successful API request (ms, -1 if none) and whether the API signalled
+        // overload (429/5xx).
+        long m_latencyMs = -1;
+        bool m_overloaded = false;
+        std::atomic<bool> m_started{false};
+        // Where the result is pushed when done, if anywhere.
+        std::shared_ptr<MPSCQueue<listVideosResult_t>> m_completionQueue;
+        // Where the videos.list() response body is pushed, unparsed, if anywhere (possibly shared with other
+        // fetches of the same videos, or a stale copy while the API is down).
+        std::shared_ptr<BoundedQueue<std::shared_ptr<const std::string>>> m_bodyQueue;
 
     };
 } // namespace sane
@@ -4,10 +4,46 @@
 #include <api_handler/api_handler.hpp>
 #include <entities/youtube_video.hpp>
 #include <entities/youtube_channel.hpp>
+#include <entities/feed_item.hpp>
 #include <types.hpp>
 #include <youtube/toolkit.hpp>
+#include <api_handler/request_context.hpp>
+#ifdef SANE_ENABLE_COROUTINES
+#include <functional>
+#include <concurrency/task.hpp>
+#include <api_handler/event_loop.hpp>
+#endif
+
+#define SUBFEED_DEFAULT_MAX_CONCURRENCY     16
+#define SUBFEED_DEFAULT_PARSE_WORKERS       2
+#define SUBFEED_DEFAULT_BUILD_WORKERS       1
+#define SUBFEED_DEFAULT_PIPELINE_CAPACITY   32      // Items allowed to queue up between two pipeline stages.
 
 namespace sane {
+    /**
+     * Summary of a subscriptions feed refresh.
+     */
+    struct refreshStats_t {
+        size_t playlistsTotal = 0;
+        size_t playlistsCompleted = 0;
+        // Playlists that were never requested because the refresh budget ran out.
+        size_t playlistsSkipped = 0;
+        bool budgetExceeded = false;
+        long elapsedMs = 0;
+        // Concurrency chosen by the adaptive limiter at the end of the refresh, the highest it reached,
+        // and how many times it had to back off.
+        int concurrency = 0;
+        int peakConcurrency = 0;
+        size_t concurrencyDecreases = 0;
+        // Quota units the refresh was expected to cost, what was left of today's budget beforehand (-1 if there
+        // is no daily limit) and playlists left out because they wouldn't fit in it.
+        long projectedQuotaCost = 0;
+        long quotaRemaining = -1;
+        size_t playlistsOverQuota = 0;
+        // Videos dropped from the feed because another playlist already listed them.
+        size_t duplicateVideos = 0;
+    };
+
     struct sortYoutubeVideoDateDescending {
         bool operator ()(const std::shared_ptr<YoutubeVideo> &video1, const std::shared_ptr<YoutubeVideo> &video2) {
             return video1->getPublishedAt().timestampWithMsec > video2->getPublishedAt().timestampWithMsec;
@@ -24,12 +60,63 @@ namespace sane {
             const std::string &t_part,
             const std::map<std::string, std::string> &t_filter,
             const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>(),
-            const std::string &t_playlistItemsPart = "contentDetails");
+            const std::string &t_playlistItemsPart = "contentDetails",
+            const requestContext_t &t_context = requestContext_t(),
+            refreshStats_t *t_stats = nullptr);
+
+    std::vector<FeedItem> listUploadedFeedItems(const std::list<std::string> &t_playlists,
+            const std::map<std::string, std::string> &t_filter,
+            const std::map<std::string, std::string> &t_optParams,
+            const std::string &t_playlistItemsPart,
+            const requestContext_t &t_context,
+            FeedChannelTable &t_channels,
+            refreshStats_t *t_stats = nullptr);
+
+    size_t removeDuplicateVideos(std::list<std::shared_ptr<YoutubeVideo>> &t_videos);
+
+    size_t removeDuplicateVideos(std::vector<FeedItem> &t_items);
 
     // FIXME: list() version, might also need search() if list turns out to be unreliable.
     std::list<std::shared_ptr<YoutubeVideo>> createSubscriptionsFeed(const std::string &t_part,
             const std::map<std::string, std::string> &t_filter,
-            const std::map<std::string, std::string> &t_optParams= std::map<std::string, std::string>());
+            const std::map<std::string, std::string> &t_optParams= std::map<std::string, std::string>(),
+            refreshStats_t *t_stats = nullptr);
+
+    std::vector<FeedItem> createSubscriptionsFeedItems(FeedChannelTable &t_channels,
+            const std::map<std::string, std::string> &t_filter,
+            const std::map<std::string, std::string> &t_optParams = std::map<std::string, std::string>(),
+            refreshStats_t *t_stats = nullptr);
+
+#ifdef SANE_ENABLE_COROUTINES
+    // Progress of a refresh running on an event loop: playlists completed out of the total.
+    typedef std::function<void(size_t t_completed, size_t t_total)> refreshProgressCallback_t;
+
+    typedef std::function<void(std::list<std::shared_ptr<YoutubeVideo>> t_videos,
+                               const refreshStats_t &t_stats)> refreshDoneCallback_t;
+
+    Task<std::list<std::shared_ptr<YoutubeVideo>>> listUploadedVideosAsync(EventLoop &t_loop,
+            std::list<std::string> t_playlists,
+            std::string t_part,
+            std::map<std::string, std::string> t_filter,
+            std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>(),
+            std::string t_playlistItemsPart = "contentDetails",
+            requestContext_t t_context = requestContext_t(),
+            refreshStats_t *t_stats = nullptr,
+            refreshProgressCallback_t t_progress = nullptr);
+
+    Task<std::list<std::shared_ptr<YoutubeVideo>>> createSubscriptionsFeedAsync(EventLoop &t_loop,
+            std::string t_part,
+            std::map<std::string, std::string> t_filter,
+            std::map<std::string, std::string> t_optParams = std::map<std::string, std::string>(),
+            refreshStats_t *t_stats = nullptr,
+            refreshProgressCallback_t t_progress = nullptr);
+
+    void startSubscriptionsFeedRefresh(EventLoop &t_loop, const std::string &t_part,
+            const std::map<std::string, std::string> &t_filter,
+            const std::map<std::string, std::string> &t_optParams,
+            refreshProgressCallback_t t_progress,
+            refreshDoneCallback_t t_done);
+#endif
 }
 #endif //SANE_SUBFEED_HPP
 
@@ -11,6 +11,10 @@
 #include <regex>
 #include <thread>
 #include <ctime>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <memory>
 
 // 3rd party libraries.
 #include <curl/curl.h>
@@ -20,12 +24,342 @@
 
 // Project specific libraries.
 #include <api_handler/api_handler.hpp>
+#include <api_handler/transfer_stats.hpp>
+#include <api_handler/http_context.hpp>
+#include <concurrency/single_flight.hpp>
 #include <db_handler/db_youtube_channels.hpp>
 #include <config_handler/config_handler.hpp>
 
 namespace sane {
     static httplib::Server oauth2server;
 
+    // API responses currently being fetched, shared by every APIHandler in the process.
+    static SingleFlight<sharedResponse_t> inFlightResponses;
+    static SingleFlight<sharedResponseBody_t> inFlightResponseBodies;
+
+    APIHandler::APIHandler() {
+        // Make sure libcURL globals are set up before any request is made, should main() not have done so.
+        HTTPContext::initialize();
+    }
+
+    APIHandler::APIHandler(const requestContext_t &t_context) : APIHandler() {
+        m_context = t_context;
+    }
+
+    APIHandler::~APIHandler() {
+        if (m_curl) {
+            curl_easy_cleanup(m_curl);
+        }
+    }
+
+    void APIHandler::setRequestContext(const requestContext_t &t_context) {
+        m_context = t_context;
+    }
+
+    const requestContext_t &APIHandler::getRequestContext() const {
+        return m_context;
+    }
+
+    /**
+     * How the last request made by this instance failed (after any retries), FailureKind::None on success.
+     *
+     * @return FailureKind
+     */
+    FailureKind APIHandler::getLastFailure() const {
+        return m_lastFailure;
+    }
+
+    /**
+     * Number of rate limited or transient (server/transport) failures seen by this instance, retried or not.
+     *
+     * @return Count.
+     */
+    unsigned long APIHandler::getOverloadSignalCount() const {
+        return m_overloadSignals;
+    }
+
+    /**
+     * Average time the successful (HTTP 200) transfers made by this instance took.
+     *
+     * Only the transfers themselves are timed, not waiting for quota, retry back-off or hedging, so this is a
+     * measure of how quickly the API responds rather than of how long a request took from start to finish.
+     *
+     * @return Milliseconds, or -1 if no successful transfer was timed.
+     */
+    long APIHandler::getAverageTransferMs() const {
+        return m_timedTransfers > 0 ? m_transferMs / (long)m_timedTransfers : -1;
+    }
+
+    /**
+     * CURLOPT_XFERINFOFUNCTION: Called frequently during a transfer, aborts it once the request is cancelled or
+     * its deadline passes (curl_easy_perform then returns CURLE_ABORTED_BY_CALLBACK).
+     *
+     * @param t_clientp Pointer to the requestContext_t of the APIHandler performing the transfer.
+     * @return          Non-zero to abort.
+     */
+    int APIHandler::transferProgressCallback(void *t_clientp, curl_off_t /*t_dltotal*/, curl_off_t /*t_dlnow*/,
+                                             curl_off_t /*t_ultotal*/, curl_off_t /*t_ulnow*/) {
+        return static_cast<const requestContext_t*>(t_clientp)->shouldAbort() ? 1 : 0;
+    }
+
+    /**
+     * Reads the optional "network" config section (timeouts, hedging and retry policy), once per instance.
+     */
+    void APIHandler::loadNetworkSettings() {
+        if (m_networkSettingsLoaded) {
+            return;
+        }
+
+        std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+
+        m_networkSettings.connectTimeoutMs = cfg->getLongInt("network/connect_timeout_ms",
+                                                             NETWORK_DEFAULT_CONNECT_TIMEOUT_MS);
+        m_networkSettings.transferTimeoutMs = cfg->getLongInt("network/transfer_timeout_ms",
+                                                              NETWORK_DEFAULT_TRANSFER_TIMEOUT_MS);
+        m_networkSettings.lowSpeedLimit = cfg->getLongInt("network/low_speed_limit", NETWORK_DEFAULT_LOW_SPEED_LIMIT);
+        m_networkSettings.lowSpeedTime = cfg->getLongInt("network/low_speed_time", NETWORK_DEFAULT_LOW_SPEED_TIME);
+        m_networkSettings.coalesceRequests = cfg->getInt("network/coalesce_requests",
+                                                         NETWORK_DEFAULT_COALESCE_REQUESTS) != 0;
+
+        m_hedgingSettings.enabled = cfg->getInt("network/hedging/enabled", HEDGING_DEFAULT_ENABLED) != 0;
+        m_hedgingSettings.percentile = cfg->getInt("network/hedging/percentile", HEDGING_DEFAULT_PERCENTILE);
+        m_hedgingSettings.minSamples = (size_t)cfg->getInt("network/hedging/min_samples",
+                                                           HEDGING_DEFAULT_MIN_SAMPLES);
+        m_hedgingSettings.minDelayMs = cfg->getLongInt("network/hedging/min_delay_ms", HEDGING_DEFAULT_MIN_DELAY_MS);
+        m_hedgingSettings.quotaBudget = cfg->getLongInt("network/hedging/quota_budget",
+                                                        HEDGING_DEFAULT_QUOTA_BUDGET);
+
+        m_retryPolicy.maxAttempts = cfg->getInt("network/retry/max_attempts", RETRY_DEFAULT_MAX_ATTEMPTS);
+        m_retryPolicy.baseDelayMs = cfg->getLongInt("network/retry/base_delay_ms", RETRY_DEFAULT_BASE_DELAY_MS);
+        m_retryPolicy.maxDelayMs = cfg->getLongInt("network/retry/max_delay_ms", RETRY_DEFAULT_MAX_DELAY_MS);
+
+        m_networkSettingsLoaded = true;
+    }
+
+    /**
+     * Applies connect/transfer timeouts, a low-speed limit and the cancellation hook to an easy handle,
+     * so that a stalled connection can never block its caller indefinitely.
+     *
+     * @param t_curl    libcURL easy handle.
+     */
+    void APIHandler::applyTransportOptions(CURL *t_curl) {
+        loadNetworkSettings();
+
+        // Timeouts are implemented with signals unless this is set, which is not safe in a multi-threaded program.
+        curl_easy_setopt(t_curl, CURLOPT_NOSIGNAL, 1L);
+
+        // The overall timeout is capped at whatever is left of the request's deadline.
+        long timeoutMs = m_networkSettings.transferTimeoutMs;
+        long remainingMs = m_context.remainingMilliseconds();
+        if (remainingMs >= 0 and (timeoutMs <= 0 or remainingMs < timeoutMs)) {
+            // 0 would mean "no timeout" to libcURL.
+            timeoutMs = std::max(remainingMs, 1L);
+        }
+
+        curl_easy_setopt(t_curl, CURLOPT_CONNECTTIMEOUT_MS, m_networkSettings.connectTimeoutMs);
+        curl_easy_setopt(t_curl, CURLOPT_TIMEOUT_MS, timeoutMs);
+        curl_easy_setopt(t_curl, CURLOPT_LOW_SPEED_LIMIT, m_networkSettings.lowSpeedLimit);
+        curl_easy_setopt(t_curl, CURLOPT_LOW_SPEED_TIME, m_networkSettings.lowSpeedTime);
+
+        curl_easy_setopt(t_curl, CURLOPT_XFERINFOFUNCTION, transferProgressCallback);
+        curl_easy_setopt(t_curl, CURLOPT_XFERINFODATA, &m_context);
+        curl_easy_setopt(t_curl, CURLOPT_NOPROGRESS, 0L);
+    }
+
+    /**
+     * Fills in the response code, wire size, Retry-After and duration of a finished transfer.
+     *
+     * @param t_curl        libcURL easy handle that performed the transfer.
+     * @param t_transfer    transferResult_t to update.
+     */
+    void APIHandler::readTransferInfo(CURL *t_curl, transferResult_t &t_transfer) {
+        curl_easy_getinfo(t_curl, CURLINFO_RESPONSE_CODE, &t_transfer.responseCode);
+        curl_easy_getinfo(t_curl, CURLINFO_SIZE_DOWNLOAD_T, &t_transfer.wireBytes);
+        curl_easy_getinfo(t_curl, CURLINFO_RETRY_AFTER, &t_transfer.retryAfterSeconds);
+
+        curl_off_t totalTimeUs = 0;
+        if (curl_easy_getinfo(t_curl, CURLINFO_TOTAL_TIME_T, &totalTimeUs) == CURLE_OK) {
+            t_transfer.transferMs = (long)(totalTimeUs / 1000);
+        }
+    }
+
+    /**
+     * Performs a prepared GET transfer, hedging it if the hedging policy is enabled.
+     *
+     * Hedging only kicks in once enough latency samples exist for the endpoint to know its percentile,
+     * until then (and whenever hedging is disabled) this is a plain blocking curl_easy_perform.
+     *
+     * @param t_curl        Fully configured libcURL easy handle, writing into t_readBuffer.
+     * @param t_url         Request URL, used to look up the endpoint's latency.
+     * @param t_readBuffer  Response body of whichever transfer won.
+     * @return              transferResult_t of the winning transfer.
+     */
+    transferResult_t APIHandler::performRequest(CURL *t_curl, const std::string &t_url, std::string &t_readBuffer) {
+        transferResult_t transfer;
+        const std::string endpoint = getEndpointFromUrl(t_url);
+        auto start = std::chrono::steady_clock::now();
+
+        long hedgeDelayMs = -1;
+        if (m_hedgingSettings.enabled) {
+            long percentileMs = getLatencyPercentile(endpoint, m_hedgingSettings.percentile,
+                                                     m_hedgingSettings.minSamples);
+            if (percentileMs >= 0) {
+                hedgeDelayMs = std::max(percentileMs, m_hedgingSettings.minDelayMs);
+            }
+        }
+
+        if (hedgeDelayMs < 0) {
+            transfer.result = curl_easy_perform(t_curl);
+            readTransferInfo(t_curl, transfer);
+        } else {
+            transfer = performHedgedRequest(t_curl, t_url, t_readBuffer, hedgeDelayMs);
+        }
+
+        // Only successful responses are representative of the endpoint's latency.
+        if (transfer.result == CURLE_OK and transfer.responseCode == 200) {
+            recordLatency(endpoint, (long)std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+        }
+
+        return transfer;
+    }
+
+    /**
+     * Runs a transfer on a private multi handle and, if it hasn't completed within t_hedgeDelayMs,
+     * fires an identical duplicate and keeps whichever one completes first.
+     *
+     * A transfer that fails at the transport level doesn't win as long as the other one may still succeed.
+     *
+     * @param t_curl            Fully configured libcURL easy handle, writing into t_readBuffer.
+     * @param t_url             Request URL, used to look up the hedge's quota cost.
+     * @param t_readBuffer      Response body of whichever transfer won.
+     * @param t_hedgeDelayMs    Time to wait before hedging.
+     * @return                  transferResult_t of the winning transfer.
+     */
+    transferResult_t APIHandler::performHedgedRequest(CURL *t_curl, const std::string &t_url, std::string &t_readBuffer,
+                                                       long t_hedgeDelayMs) {
+        transferResult_t transfer;
+
+        CURLM *multi = curl_multi_init();
+        if (!multi) {
+            transfer.result = curl_easy_perform(t_curl);
+            readTransferInfo(t_curl, transfer);
+            return transfer;
+        }
+
+        CURL *hedge = nullptr;
+        std::string hedgeBuffer;
+        CURL *winner = nullptr;
+        CURLcode winnerResult = CURLE_FAILED_INIT;
+        bool mayHedge = true;
+        int pending = 1;
+        auto start = std::chrono::steady_clock::now();
+
+        curl_multi_add_handle(multi, t_curl);
+
+        while (winner == nullptr and pending > 0) {
+            int running = 0;
+            CURLMcode mc = curl_multi_perform(multi, &running);
+            if (mc != CURLM_OK) {
+                std::cerr << "performHedgedRequest: curl_multi_perform failed: " << curl_multi_strerror(mc)
+                          << std::endl;
+                break;
+            }
+
+            // Harvest finished transfers.
+            CURLMsg *message;
+            int messagesLeft;
+            while ((message = curl_multi_info_read(multi, &messagesLeft))) {
+                if (message->msg != CURLMSG_DONE) {
+                    continue;
+                }
+                pending--;
+
+                if (winner == nullptr and (message->data.result == CURLE_OK or pending == 0)) {
+                    winner = message->easy_handle;
+                    winnerResult = message->data.result;
+                }
+            }
+
+            if (winner != nullptr or pending == 0) {
+                break;
+            }
+
+            long elapsedMs = (long)std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+
+            // Original has been outstanding for longer than the endpoint's usual worst case: hedge it.
+            if (mayHedge and elapsedMs >= t_hedgeDelayMs) {
+                mayHedge = false;
+
+                // A hedge is a real request: it has to fit both the hedging budget and the process-wide quota.
+                long quotaCost = getQuotaCost(t_url);
+                if (!m_context.shouldAbort() and tryAcquireHedge(quotaCost, m_hedgingSettings.quotaBudget)) {
+                    if (tryAcquireQuota(t_url)) {
+                        hedge = curl_easy_duphandle(t_curl);
+                    }
+
+                    if (hedge) {
+                        HTTPContext::attachEasyHandle(hedge);
+                        curl_easy_setopt(hedge, CURLOPT_WRITEDATA, &hedgeBuffer);
+                        curl_multi_add_handle(multi, hedge);
+                        transfer.hedged = true;
+                        pending++;
+
+                        // Get the hedge going right away.
+                        continue;
+                    }
+
+                    // Not sent after all, so it doesn't count against the hedging budget (or the stats).
+                    refundHedge(quotaCost);
+                }
+            }
+
+            int timeoutMs = mayHedge ? (int)std::max(t_hedgeDelayMs - elapsedMs, 1L) : 1000;
+            curl_multi_poll(multi, nullptr, 0, timeoutMs, nullptr);
+        }
+
+        transfer.result = winnerResult;
+        if (winner != nullptr) {
+            readTransferInfo(winner, transfer);
+
+            if (winner == hedge) {
+                t_readBuffer.swap(hedgeBuffer);
+                transfer.hedgeWon = true;
+                recordHedgeWon();
+            }
+        }
+
+        // Removing an unfinished transfer aborts it (and closes its connection).
+        curl_multi_remove_handle(multi, t_curl);
+        if (hedge) {
+            curl_multi_remove_handle(multi, hedge);
+            curl_easy_cleanup(hedge);
+        }
+        curl_multi_cleanup(multi);
+
+        return transfer;
+    }
+
+    /**
+     * Returns this instance's easy handle, creating it on first use.
+     *
+     * The handle is reset between requests, which clears all options but keeps the
+     * live connections, DNS and TLS session caches, so subsequent requests skip the handshake.
+     *
+     * @return  Easy handle attached to the shared HTTPContext, or nullptr on failure.
+     */
+    CURL *APIHandler::getEasyHandle() {
+        if (m_curl) {
+            curl_easy_reset(m_curl);
+            HTTPContext::attachEasyHandle(m_curl);
+        } else {
+            m_curl = HTTPContext::createEasyHandle();
+        }
+
+        return m_curl;
+    }
+
     /**
      * Callback function to be called when receiving the http response from the server.
      *
@@ -44,6 +378,17 @@ namespace sane {
         return t_size * t_nmemb;
     }
 
+    /**
+     * Per-thread random number generator for retry jitter.
+     *
+     * @return
+     */
+    static std::mt19937 &retryRng() {
+        thread_local std::mt19937 rng{std::random_device{}()};
+
+        return rng;
+    }
+
     void urlEncode(std::string &t_stringToEncode) {
         t_stringToEncode = std::regex_replace(t_stringToEncode, std::regex("\\/"), "%2F");
         t_stringToEncode = std::regex_replace(t_stringToEncode, std::regex(":"), "%3A");
@@ -308,15 +653,18 @@ namespace sane {
             tokenUri = cfg->getString("youtube_auth/oauth2/token_uri");
         }
 
-        // Start a libcURL easy session and assign the returned handle.
-        // NB: Implicitly calls curl_global_init, which is *NOT* thread-safe!
-        curl = curl_easy_init();
+        // Start a libcURL easy session attached to the shared DNS/TLS session cache.
+        // Held so that it is cleaned up (and detached from the share) on every way out.
+        std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curlHandle(HTTPContext::createEasyHandle(),
+                                                                       curl_easy_cleanup);
+        curl = curlHandle.get();
         if(curl) {
             CURLcode result;
 
             // Custom headers
-            struct curl_slist *chunk = nullptr;
-            chunk = curl_slist_append(chunk, "Content-type: application/x-www-form-urlencoded");
+            std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> chunk(
+                    curl_slist_append(nullptr, "Content-type: application/x-www-form-urlencoded"),
+                    curl_slist_free_all);
 
             // POST data
             std::string postFields =   "code="            + code
@@ -327,7 +675,8 @@ namespace sane {
 
             curl_easy_setopt(curl, CURLOPT_HTTPAUTH, CURLAUTH_ANY);
             curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, true);
-            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, chunk);
+            applyTransportOptions(curl);
+            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, chunk.get());
             curl_easy_setopt(curl, CURLOPT_URL, tokenUri.c_str());
             curl_easy_setopt(curl, CURLOPT_POSTFIELDS, postFields.c_str());
             curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
@@ -356,7 +705,8 @@ namespace sane {
             // now - unless it was attached to a multi handle while doing the transfers.
             // Don't call this function if you intend to transfer more files,
             // re-using handles is a key to good performance with libcurl
-            curl_easy_cleanup(curl);
+            chunk.reset();
+            curlHandle.reset();
 
             // Convert readBuffer to JSON
             if (responseCode == 200) {
@@ -409,15 +759,18 @@ namespace sane {
             clientSecret = cfg->getString("youtube_auth/oauth2/client_secret");
         }
 
-        // Start a libcURL easy session and assign the returned handle.
-        // NB: Implicitly calls curl_global_init, which is *NOT* thread-safe!
-        curl = curl_easy_init();
+        // Start a libcURL easy session attached to the shared DNS/TLS session cache.
+        // Held so that it is cleaned up (and detached from the share) on every way out.
+        std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curlHandle(HTTPContext::createEasyHandle(),
+                                                                       curl_easy_cleanup);
+        curl = curlHandle.get();
         if(curl) {
             CURLcode result;
 
             // Custom headers
-            struct curl_slist *chunk = nullptr;
-            chunk = curl_slist_append(chunk, "Content-type: application/x-www-form-urlencoded");
+            std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> chunk(
+                    curl_slist_append(nullptr, "Content-type: application/x-www-form-urlencoded"),
+                    curl_slist_free_all);
 
             // POST data
             std::string postFields = "refresh_token="   + refreshToken
@@ -427,7 +780,8 @@ namespace sane {
 
             curl_easy_setopt(curl, CURLOPT_HTTPAUTH, CURLAUTH_ANY);
             curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, true);
-            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, chunk);
+            applyTransportOptions(curl);
+            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, chunk.get());
             curl_easy_setopt(curl, CURLOPT_URL, tokenUri.c_str());
             curl_easy_setopt(curl, CURLOPT_POSTFIELDS, postFields.c_str());
             curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
@@ -455,7 +809,8 @@ namespace sane {
             // now - unless it was attached to a multi handle while doing the transfers.
             // Don't call this function if you intend to transfer more files,
             // re-using handles is a key to good performance with libcurl
-            curl_easy_cleanup(curl);
+            chunk.reset();
+            curlHandle.reset();
 
             // Convert readBuffer to JSON
             if (responseCode == 200) {
@@ -478,16 +833,170 @@ namespace sane {
     }
 
     /**
-     * Gets an OAuth2 YouTube API response via cURL.
+     * Gets an OAuth2 YouTube API response.
      *
      * @param url   A const string of the full API route URL.
      * @return      Response parsed as JSON or - if cURL failed - an explicitly expressed empty object.
      */
     nlohmann::json APIHandler::getOAuth2Response(const std::string &url) {
-        std::string accessToken;
-        std::string refreshToken;
+        return *getSharedOAuth2Response(url);
+    }
+
+    /**
+     * Gets an OAuth2 YouTube API response, sharing the round trip with any identical request already in flight.
+     *
+     * Requests are identical if their normalized URLs are: every request is made with the one configured
+     * account's credentials, so the URL is all that tells them apart.
+     *
+     * @param t_url A const string of the full API route URL.
+     * @return      Immutable response, possibly the very same object handed to other callers.
+     */
+    std::shared_ptr<const nlohmann::json> APIHandler::getSharedOAuth2Response(const std::string &t_url) {
+        loadNetworkSettings();
+
+        const std::string key = normalizeRequestUrl(t_url);
+
+        auto fetch = [&]() {
+            std::shared_ptr<sharedResponse_t> response = std::make_shared<sharedResponse_t>();
+            response->json = std::make_shared<const nlohmann::json>(fetchOAuth2Response(t_url));
+            response->failure = m_lastFailure;
+            response->aborted = response->failure != FailureKind::None and m_context.shouldAbort();
+
+            if (response->failure == FailureKind::None and !response->json->empty()) {
+                // Remember the last good response, in case the endpoint goes down later on.
+                getStaleResponseCache().put(key, response->json);
+            } else if (response->failure == FailureKind::CircuitOpen) {
+                // The endpoint is down, the last good response beats no response at all.
+                std::shared_ptr<const nlohmann::json> stale = getStaleResponseCache().get(key);
+                if (stale != nullptr) {
+                    response->json = stale;
+                }
+            }
 
+            return std::shared_ptr<const sharedResponse_t>(response);
+        };
+
+        std::shared_ptr<const sharedResponse_t> response;
+        if (m_networkSettings.coalesceRequests) {
+            // Another caller's cancellation or deadline is no answer to this one's request.
+            response = inFlightResponses.run(key, fetch, m_context, nullptr,
+                                             [](const sharedResponse_t &t_response) { return t_response.aborted; });
+        } else {
+            response = fetch();
+        }
+
+        if (response == nullptr) {
+            // Cancelled or out of time while waiting on another caller's request.
+            m_lastFailure = FailureKind::Fatal;
+            return std::make_shared<const nlohmann::json>(nlohmann::json::object());
+        }
+        m_lastFailure = response->failure;
+
+        return response->json;
+    }
+
+    /**
+     * Gets an OAuth2 YouTube API response body, unparsed, for callers that parse it elsewhere (e.g. on a separate
+     * pipeline stage).
+     *
+     * Like getSharedOAuth2Response it shares the round trip with any identical request already in flight and,
+     * while the endpoint's circuit is open, falls back to the last good body (if bodies are cached at all, see
+     * getStaleResponseBodyCache).
+     *
+     * @param t_url A const string of the full API route URL.
+     * @return      Immutable response body, empty unless the request succeeded or a stale body was found.
+     */
+    std::shared_ptr<const std::string> APIHandler::getSharedOAuth2ResponseBody(const std::string &t_url) {
+        loadNetworkSettings();
+
+        const std::string key = normalizeRequestUrl(t_url);
+
+        auto fetch = [&]() {
+            std::shared_ptr<sharedResponseBody_t> response = std::make_shared<sharedResponseBody_t>();
+            response->body = std::make_shared<const std::string>(getOAuth2ResponseBody(t_url));
+            response->failure = m_lastFailure;
+            response->aborted = response->failure != FailureKind::None and m_context.shouldAbort();
+
+            if (response->failure == FailureKind::None and !response->body->empty()) {
+                getStaleResponseBodyCache().put(key, response->body);
+            } else if (response->failure == FailureKind::CircuitOpen) {
+                std::shared_ptr<const std::string> stale = getStaleResponseBodyCache().get(key);
+                if (stale != nullptr) {
+                    response->body = stale;
+                }
+            }
+
+            return std::shared_ptr<const sharedResponseBody_t>(response);
+        };
+
+        std::shared_ptr<const sharedResponseBody_t> response;
+        if (m_networkSettings.coalesceRequests) {
+            response = inFlightResponseBodies.run(key, fetch, m_context, nullptr,
+                                                  [](const sharedResponseBody_t &t_response) {
+                                                      return t_response.aborted;
+                                                  });
+        } else {
+            response = fetch();
+        }
+
+        if (response == nullptr) {
+            // Cancelled or out of time while waiting on another caller's request.
+            m_lastFailure = FailureKind::Fatal;
+            return std::make_shared<const std::string>();
+        }
+        m_lastFailure = response->failure;
+
+        return response->body;
+    }
+
+    /**
+     * @return Number of API requests that were answered by an identical request already in flight.
+     */
+    unsigned long APIHandler::getCoalescedRequestCount() {
+        return inFlightResponses.getCoalescedCount() + inFlightResponseBodies.getCoalescedCount();
+    }
+
+    /**
+     * Gets an OAuth2 YouTube API response via cURL and parses it.
+     *
+     * @param url   A const string of the full API route URL.
+     * @return      Response parsed as JSON or - if cURL failed - an explicitly expressed empty object.
+     */
+    nlohmann::json APIHandler::fetchOAuth2Response(const std::string &url) {
+        return parseResponseBody(getOAuth2ResponseBody(url));
+    }
+
+    /**
+     * @param t_body    Response body.
+     * @return          Body parsed as JSON, or an empty object if it is empty or not valid JSON.
+     */
+    nlohmann::json APIHandler::parseResponseBody(const std::string &t_body) {
         nlohmann::json jsonData = nlohmann::json::object();
+
+        // Convert the response body to JSON
+        if (!t_body.empty()) {
+            try {
+                jsonData = nlohmann::json::parse(t_body);
+            } catch (nlohmann::detail::parse_error &exc) {
+                std::cerr << "Skipping APIHandler::getOAuth2Response due to Exception: " << std::string(exc.what())
+                          << jsonData.dump() << std::endl;
+            } catch (const std::exception &exc) {
+                std::cerr << "Skipping APIHandler::getOAuth2Response due to Unexpected Exception: "
+                          << std::string(exc.what()) << jsonData.dump() << "\n" << std::endl;
+            }
+        }
+
+        return jsonData;
+    }
+
+    /**
+     * Looks up the configured OAuth2 access token, refreshing it first if it has expired.
+     *
+     * @return  Access token, or an empty string if there is no usable one.
+     */
+    std::string APIHandler::getAccessToken() {
+        std::string accessToken;
+        std::string refreshToken;
         std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
 
         // Check that access and/or refresh tokens are valid.
@@ -507,7 +1016,7 @@ namespace sane {
             std::cerr << "APIHandler::getOAuth2Response ERROR: Both access and refresh tokens are empty!"
                       << "\n\nDid you forget to authenticate OAuth2?" << std::endl;
 
-            return jsonData;
+            return std::string();
         } else if (refreshToken.empty()) {
             // A missing refresh token may not yet be critical, but could prove troublesome.
             std::cerr << "APIHandler::getOAuth2Response WARNING: refresh token is empty!"
@@ -532,76 +1041,397 @@ namespace sane {
                     accessToken = accessTokenJson["access_token"].get<std::string>();
                 } else {
                     std::cerr << "Invalid access token: not string!\n" << accessTokenJson.dump(4) << std::endl;
-                    return jsonData;
+                    return std::string();
                 }
             } else {
                 std::cerr << "Invalid access token: not in JSON!\n" << accessTokenJson.dump(4) << std::endl;
-                return jsonData;
+                return std::string();
+            }
+        }
+
+        return accessToken;
+    }
+
+    /**
+     * Sets up an easy handle for an authenticated GET request.
+     *
+     * @param t_curl        libcURL easy handle.
+     * @param t_url         Full API route URL.
+     * @param t_headers     Request headers (see makeRequestHeaders), must outlive the transfer.
+     * @param t_readBuffer  Where the response body is written, must outlive the transfer.
+     */
+    void APIHandler::prepareRequest(CURL *t_curl, const std::string &t_url, curl_slist *t_headers,
+                                    std::string *t_readBuffer) {
+        curl_easy_setopt(t_curl, CURLOPT_HTTPAUTH, CURLAUTH_ANY);
+        curl_easy_setopt(t_curl, CURLOPT_SSL_VERIFYPEER, true);
+        applyTransportOptions(t_curl);
+        curl_easy_setopt(t_curl, CURLOPT_HTTPHEADER, t_headers);
+        curl_easy_setopt(t_curl, CURLOPT_URL, t_url.c_str());
+        // An empty string advertises every encoding this libcURL was built with (gzip, brotli, zstd...),
+        // the body is then decompressed on the fly before it reaches writeCallback.
+        curl_easy_setopt(t_curl, CURLOPT_ACCEPT_ENCODING, "");
+        curl_easy_setopt(t_curl, CURLOPT_WRITEFUNCTION, writeCallback);
+        curl_easy_setopt(t_curl, CURLOPT_WRITEDATA, t_readBuffer);
+    }
+
+    /**
+     * @param t_accessToken OAuth2 access token.
+     * @return              Custom headers list, to be freed with curl_slist_free_all.
+     */
+    curl_slist *APIHandler::makeRequestHeaders(const std::string &t_accessToken) {
+        struct curl_slist *chunk = nullptr;
+
+        std::string auth_header = "Authorization: Bearer " + t_accessToken;
+
+        chunk = curl_slist_append(chunk, auth_header.c_str());
+        chunk = curl_slist_append(chunk, "Content-type: application/json");
+
+        return chunk;
+    }
+
+    /**
+     * Books a finished attempt: transfer stats, circuit breaker and overload signals.
+     *
+     * @param t_breaker     The endpoint's circuit breaker, which allowed the attempt.
+     * @param t_url         Request URL.
+     * @param t_transfer    Outcome of the transfer.
+     * @param t_readBuffer  Response body.
+     * @return              How the attempt failed, FailureKind::None if it didn't.
+     */
+    FailureKind APIHandler::recordAttempt(CircuitBreaker &t_breaker, const std::string &t_url,
+                                          const transferResult_t &t_transfer, const std::string &t_readBuffer) {
+        if (t_transfer.result == CURLE_OK) {
+            // Record wire (possibly compressed) vs decoded size for this endpoint.
+            recordTransfer(t_url, (unsigned long long)t_transfer.wireBytes, t_readBuffer.size());
+
+            if (t_transfer.responseCode == 200 and t_transfer.transferMs >= 0) {
+                m_transferMs += t_transfer.transferMs;
+                m_timedTransfers++;
             }
         }
 
+        FailureKind failure = classifyFailure(t_transfer.result, t_transfer.responseCode, t_readBuffer);
+
+        // Outages, overload, spent quota and revoked credentials count against the endpoint,
+        // a request the server merely rejected (e.g. not found) shows that it is up.
+        if (t_transfer.result == CURLE_ABORTED_BY_CALLBACK) {
+            t_breaker.recordAbandoned();
+        } else if (failure == FailureKind::Transient or failure == FailureKind::RateLimited
+                   or failure == FailureKind::QuotaExceeded or t_transfer.responseCode == 401) {
+            t_breaker.recordFailure();
+        } else {
+            t_breaker.recordSuccess();
+        }
+        if (failure == FailureKind::RateLimited or failure == FailureKind::Transient) {
+            // Tells adaptive concurrency control to back off, even if a retry succeeds.
+            m_overloadSignals++;
+        }
+
+        return failure;
+    }
+
+    /**
+     * Decides whether (and when) a failed attempt is retried.
+     *
+     * @param t_url         Request URL.
+     * @param t_transfer    Outcome of the attempt.
+     * @param t_failure     How it failed, set to RateLimited if the server wants to be left alone for too long.
+     * @param t_attempt     Zero-based attempt number.
+     * @return              Milliseconds to wait before the retry, or -1 to give up.
+     */
+    long APIHandler::getRetryDelayMs(const std::string &t_url, const transferResult_t &t_transfer,
+                                     FailureKind &t_failure, int t_attempt) {
+        if (!isRetryable(t_failure) or t_attempt + 1 >= m_retryPolicy.maxAttempts) {
+            return -1;
+        }
+
+        // Honour Retry-After if the server sent one (up to the policy's longest delay), otherwise back off
+        // exponentially with full jitter.
+        long delayMs;
+        if (t_transfer.retryAfterSeconds > 0) {
+            delayMs = computeRetryAfterMs(m_retryPolicy, (long)t_transfer.retryAfterSeconds);
+
+            if (delayMs < 0) {
+                std::cerr << "getOAuth2Response: Server asked to retry in " << t_transfer.retryAfterSeconds
+                          << " s, longer than the maximum retry delay (" << m_retryPolicy.maxDelayMs
+                          << " ms), giving up." << "\n" << "url: " << t_url << std::endl;
+                t_failure = FailureKind::RateLimited;
+
+                return -1;
+            }
+        } else {
+            delayMs = computeBackoffMs(m_retryPolicy, t_attempt, retryRng());
+        }
+
+        std::cerr << "getOAuth2Response: " << failureKindToString(t_failure) << " failure ("
+                  << (t_transfer.result == CURLE_OK ? "HTTP " + std::to_string(t_transfer.responseCode)
+                                                    : std::string(curl_easy_strerror(t_transfer.result)))
+                  << "), retrying in " << delayMs << " ms (attempt " << t_attempt + 2 << "/"
+                  << m_retryPolicy.maxAttempts << ")." << "\n" << "url: " << t_url << std::endl;
+
+        return delayMs;
+    }
+
+    /**
+     * Settles the outcome of a request once it is done retrying: sets m_lastFailure and reports any failure.
+     *
+     * @param t_url             Request URL.
+     * @param t_transfer        Outcome of the last attempt.
+     * @param t_failure         How the last attempt failed.
+     * @param t_circuitOpen     The endpoint's circuit breaker refused the request.
+     * @param t_quotaRefused    The quota refused the request.
+     * @param t_readBuffer      Response body of the last attempt.
+     * @return                  Response body, or an empty string unless the request succeeded (HTTP 200).
+     */
+    std::string APIHandler::finishRequest(const std::string &t_url, const transferResult_t &t_transfer,
+                                          FailureKind t_failure, bool t_circuitOpen, bool t_quotaRefused,
+                                          std::string &t_readBuffer) {
+        m_lastFailure = t_failure;
+
+        if (t_circuitOpen) {
+            // The breaker has already said so, once, when it opened.
+            m_lastFailure = FailureKind::CircuitOpen;
+            return std::string();
+        }
+
+        if (t_quotaRefused) {
+            // Either today's budget is spent (already reported by acquireQuota) or we gave up waiting for it.
+            m_lastFailure = m_context.shouldAbort() ? FailureKind::Fatal : FailureKind::QuotaExceeded;
+            return std::string();
+        }
+
+        if (t_transfer.result != CURLE_OK) {
+            // A cancelled request was aborted on purpose, no need to make noise about it.
+            if (!m_context.isCancelled()) {
+                std::cerr << "getOAuth2Response: cURL easy perform failed with non-zero code: " << t_transfer.result
+                          << " (" << curl_easy_strerror(t_transfer.result) << ")!" << "\n" << "url: " << t_url
+                          << std::endl;
+            }
+            return std::string();
+        }
+
+        // All fine. Proceed as usual.
+        if (t_failure == FailureKind::QuotaExceeded) {
+            std::cerr << "getOAuth2Response: API quota exceeded, not retrying until it resets. "
+                      << "url: " << t_url << std::endl;
+        } else if (t_transfer.responseCode != 200) {
+            // The error reason says it all, fall back to the whole body if there isn't one.
+            std::string reason = getApiErrorReason(t_readBuffer);
+            std::cerr << "getOAuth2Response: API request failed with error " << t_transfer.responseCode << ": "
+                      << (reason.empty() ? t_readBuffer : reason) << "\n" << "url: " << t_url << std::endl;
+        }
+
+        if (t_transfer.responseCode == 200) {
+            return std::move(t_readBuffer);
+        }
+
+        return std::string();
+    }
+
+    /**
+     * Gets an OAuth2 YouTube API response body via cURL, without parsing it.
+     *
+     * This is the bare request (with retries), neither coalesced with identical requests nor served from the
+     * stale response cache: see getSharedOAuth2Response and getSharedOAuth2ResponseBody for that.
+     *
+     * @param url   A const string of the full API route URL.
+     * @return      Response body, or an empty string unless the request succeeded (HTTP 200).
+     */
+    std::string APIHandler::getOAuth2ResponseBody(const std::string &url) {
+        // Don't bother starting a request that has already been cancelled or run out of time.
+        if (m_context.shouldAbort()) {
+            return std::string();
+        }
+
+        std::string accessToken = getAccessToken();
+        if (accessToken.empty()) {
+            return std::string();
+        }
+
         // Proceed with the original cURL request.
         CURL *curl;
         std::string readBuffer;
-        long responseCode;
 
-        // Start a libcURL easy session and assign the returned handle.
-        // NB: Implicitly calls curl_global_init, which is *NOT* thread-safe!
-        curl = curl_easy_init();
-        if(curl) {
-            CURLcode result;
+        // Get this instance's libcURL easy session (attached to the shared DNS/TLS session cache).
+        curl = getEasyHandle();
+        if (!curl) {
+            return std::string();
+        }
 
-            // Custom headers
-            struct curl_slist *chunk = nullptr;
+        // Custom headers
+        struct curl_slist *chunk = makeRequestHeaders(accessToken);
 
-            std::string auth_header = "Authorization: Bearer " + accessToken;
+        prepareRequest(curl, url, chunk, &readBuffer);
 
-            chunk = curl_slist_append(chunk, auth_header.c_str());
-            chunk = curl_slist_append(chunk, "Content-type: application/json");
+        transferResult_t transfer;
+        FailureKind failure = FailureKind::None;
+        bool quotaRefused = false;
+        bool circuitOpen = false;
+        CircuitBreaker &breaker = getCircuitBreaker(getEndpointFromUrl(url));
 
-            curl_easy_setopt(curl, CURLOPT_HTTPAUTH, CURLAUTH_ANY);
-            curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, true);
-            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, chunk);
-            curl_easy_setopt(curl, CURLOPT_URL, url.c_str());
-            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writeCallback);
-            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &readBuffer);
+        // Only this request is retried on failure, not whatever batch of requests it is part of.
+        for (int attempt = 0; ; attempt++) {
+            readBuffer.clear();
 
-            // Perform a blocking file transfer
-            result = curl_easy_perform(curl);
+            // Fail fast while the endpoint is known to be down, rather than wait out another failing round trip.
+            if (!breaker.allowRequest()) {
+                circuitOpen = true;
+                break;
+            }
 
-            if (result == CURLE_OK) {
-                // All fine. Proceed as usual.
-                curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &responseCode);
-                if (responseCode != 200) {
-                    std::cerr << "getOAuth2Response: API request failed with error " << responseCode << ": "
-                              << readBuffer << "\n" << "url: " << url << std::endl;
-                }
-            } else {
-                std::cerr << "getOAuth2Response: cURL easy perform failed with non-zero code: " << result << "!" << std::endl;
-                return jsonData;
+            // Every attempt is charged against the quota, and may have to wait for the token bucket.
+            if (!acquireQuota(url, m_context)) {
+                breaker.recordAbandoned();
+                quotaRefused = true;
+                break;
             }
 
-            // Cleanup call REQUIRED by curl_easy_init, which closes the handle.
-            //
-            // This might close all connections this handle has used and possibly has kept open until
-            // now - unless it was attached to a multi handle while doing the transfers.
-            // Don't call this function if you intend to transfer more files,
-            // re-using handles is a key to good performance with libcurl
-            curl_easy_cleanup(curl);
+            // Perform a blocking file transfer (hedged against slow responses, if enabled).
+            transfer = performRequest(curl, url, readBuffer);
+            failure = recordAttempt(breaker, url, transfer, readBuffer);
 
-            // Convert readBuffer to JSON
-            if (responseCode == 200) {
-                try {
-                    jsonData = nlohmann::json::parse(readBuffer);
-                } catch (nlohmann::detail::parse_error &exc) {
-                    std::cerr << "Skipping APIHandler::getOAuth2Response due to Exception: " << std::string(exc.what())
-                              << jsonData.dump() << std::endl;
-                } catch (const std::exception &exc) {
-                    std::cerr << "Skipping APIHandler::getOAuth2Response due to Unexpected Exception: "
-                              << std::string(exc.what()) << jsonData.dump() << "\n" << std::endl;
+            long delayMs = getRetryDelayMs(url, transfer, failure, attempt);
+            if (delayMs < 0) {
+                break;
+            }
+
+            // Give up if cancelled while waiting, or if the deadline would pass before the retry.
+            if (!m_context.sleepFor(std::chrono::milliseconds(delayMs))) {
+                break;
+            }
+
+            // Time has passed, so the transfer timeout must be re-capped to the remaining deadline.
+            applyTransportOptions(curl);
+        }
+
+        // Custom headers list is no longer needed after the transfer.
+        curl_slist_free_all(chunk);
+
+        // NB: The handle is intentionally not cleaned up here, it is owned by this APIHandler and
+        //     re-used for the next request (see getEasyHandle) to keep its connection alive.
+
+        return finishRequest(url, transfer, failure, circuitOpen, quotaRefused, readBuffer);
+    }
+#ifdef SANE_ENABLE_COROUTINES
+    /**
+     * Coroutine version of getOAuth2ResponseBody: the transfer, quota waits and retry back-off are all awaited on
+     * t_loop instead of blocking the thread.
+     *
+     * Parameters are taken by value, as the coroutine may outlive the caller's arguments.
+     *
+     * @param t_loop    Event loop to run the transfer on.
+     * @param t_url     Full API route URL.
+     * @return          Response body, or an empty string unless the request succeeded (HTTP 200).
+     */
+    Task<std::string> APIHandler::getOAuth2ResponseBodyAsync(EventLoop &t_loop, std::string t_url) {
+        if (m_context.shouldAbort()) {
+            co_return std::string();
+        }
+
+        std::string accessToken = getAccessToken();
+        if (accessToken.empty()) {
+            co_return std::string();
+        }
+
+        // Requests in flight at the same time can't share this instance's easy handle, every one gets its own.
+        std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl(HTTPContext::createEasyHandle(), curl_easy_cleanup);
+        if (!curl) {
+            co_return std::string();
+        }
+
+        std::unique_ptr<curl_slist, decltype(&curl_slist_free_all)> chunk(makeRequestHeaders(accessToken),
+                                                                          curl_slist_free_all);
+        std::string readBuffer;
+
+        prepareRequest(curl.get(), t_url, chunk.get(), &readBuffer);
+
+        transferResult_t transfer;
+        FailureKind failure = FailureKind::None;
+        bool quotaRefused = false;
+        bool circuitOpen = false;
+        const std::string endpoint = getEndpointFromUrl(t_url);
+        CircuitBreaker &breaker = getCircuitBreaker(endpoint);
+
+        for (int attempt = 0; ; attempt++) {
+            readBuffer.clear();
+
+            if (!breaker.allowRequest()) {
+                circuitOpen = true;
+                break;
+            }
+
+            // The token bucket is polled rather than waited on, waiting would hold up the whole loop.
+            bool acquired;
+            while (!(acquired = tryAcquireQuota(t_url))) {
+                long remainingQuota = getRemainingQuota();
+
+                if ((remainingQuota >= 0 and remainingQuota < getQuotaCost(t_url)) or m_context.shouldAbort()) {
+                    break;
                 }
+                co_await t_loop.sleepFor(std::chrono::milliseconds(EVENT_LOOP_QUOTA_POLL_MS));
             }
+            if (!acquired) {
+                breaker.recordAbandoned();
+                quotaRefused = true;
+                break;
+            }
+
+            // Not hedged: the loop already multiplexes every request over the shared connections.
+            auto start = std::chrono::steady_clock::now();
+            transfer = transferResult_t();
+            transfer.result = co_await t_loop.transfer(curl.get());
+            readTransferInfo(curl.get(), transfer);
+
+            if (transfer.result == CURLE_OK and transfer.responseCode == 200) {
+                recordLatency(endpoint, (long)std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - start).count());
+            }
+
+            failure = recordAttempt(breaker, t_url, transfer, readBuffer);
+
+            long delayMs = getRetryDelayMs(t_url, transfer, failure, attempt);
+            if (delayMs < 0) {
+                break;
+            }
+
+            // Give up if cancelled, or if the deadline would pass before the retry.
+            if (m_context.shouldAbort()
+                or (m_context.hasDeadline() and m_context.remainingMilliseconds() <= delayMs)) {
+                break;
+            }
+            co_await t_loop.sleepFor(std::chrono::milliseconds(delayMs));
+
+            // Time has passed, so the transfer timeout must be re-capped to the remaining deadline.
+            applyTransportOptions(curl.get());
         }
-        return jsonData;
+
+        co_return finishRequest(t_url, transfer, failure, circuitOpen, quotaRefused, readBuffer);
+    }
+
+    /**
+     * Coroutine version of getOAuth2Response.
+     *
+     * Not coalesced with identical requests (there is no other thread to share with), but like its blocking
+     * counterpart it is served from the stale response cache while the endpoint's circuit is open.
+     *
+     * @param t_loop    Event loop to run the transfer on.
+     * @param t_url     Full API route URL.
+     * @return          Response parsed as JSON or - if the request failed - an explicitly expressed empty object.
+     */
+    Task<nlohmann::json> APIHandler::getOAuth2ResponseAsync(EventLoop &t_loop, std::string t_url) {
+        nlohmann::json jsonData = parseResponseBody(co_await getOAuth2ResponseBodyAsync(t_loop, t_url));
+        const std::string key = normalizeRequestUrl(t_url);
+
+        if (m_lastFailure == FailureKind::None and !jsonData.empty()) {
+            getStaleResponseCache().put(key, std::make_shared<const nlohmann::json>(jsonData));
+        } else if (m_lastFailure == FailureKind::CircuitOpen) {
+            std::shared_ptr<const nlohmann::json> stale = getStaleResponseCache().get(key);
+            if (stale != nullptr) {
+                jsonData = *stale;
+            }
+        }
+
+        co_return jsonData;
     }
+#endif // SANE_ENABLE_COROUTINES
 } // namespace sane.
@@ -0,0 +1,269 @@
+#include <iostream>
+#include <algorithm>
+
+#include <api_handler/circuit_breaker.hpp>
+#include <config_handler/config_handler.hpp>
+
+namespace sane {
+    static std::mutex circuitBreakersMutex;
+    static std::map<std::string, std::unique_ptr<CircuitBreaker>> circuitBreakers;
+
+    CircuitBreaker::CircuitBreaker(const std::string &t_name, const circuitBreakerSettings_t &t_settings) {
+        m_name = t_name;
+        m_settings = t_settings;
+        m_settings.windowSize = std::max(m_settings.windowSize, (size_t)1);
+        m_settings.halfOpenProbes = std::max(m_settings.halfOpenProbes, 1);
+    }
+
+    /**
+     * Asks whether a request may be sent now.
+     *
+     * Every request that is allowed must be followed by exactly one of recordSuccess, recordFailure
+     * or recordAbandoned.
+     *
+     * @return  true if the request may be sent, false if it should fail fast.
+     */
+    bool CircuitBreaker::allowRequest() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_settings.enabled) {
+            return true;
+        }
+
+        if (m_state == CircuitState::Open and std::chrono::steady_clock::now() >= m_openUntil) {
+            m_state = CircuitState::HalfOpen;
+            m_probesInFlight = 0;
+        }
+
+        if (m_state == CircuitState::Closed) {
+            return true;
+        }
+
+        if (m_state == CircuitState::HalfOpen and m_probesInFlight < m_settings.halfOpenProbes) {
+            m_probesInFlight++;
+            return true;
+        }
+
+        m_shortCircuits++;
+
+        return false;
+    }
+
+    void CircuitBreaker::recordSuccess() {
+        recordOutcome(false);
+    }
+
+    void CircuitBreaker::recordFailure() {
+        recordOutcome(true);
+    }
+
+    /**
+     * The request was allowed but never got an answer that says anything about the endpoint (e.g. it was cancelled).
+     */
+    void CircuitBreaker::recordAbandoned() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_state == CircuitState::HalfOpen and m_probesInFlight > 0) {
+            m_probesInFlight--;
+        }
+    }
+
+    /**
+     * Opens the circuit, caller must hold m_mutex.
+     */
+    void CircuitBreaker::open() {
+        m_state = CircuitState::Open;
+        m_openUntil = std::chrono::steady_clock::now() + std::chrono::milliseconds(m_settings.openMs);
+        m_probesInFlight = 0;
+
+        std::cerr << "CircuitBreaker: " << m_name << " is failing, failing fast for the next " << m_settings.openMs
+                  << " ms." << std::endl;
+    }
+
+    void CircuitBreaker::recordOutcome(bool t_failed) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (!m_settings.enabled) {
+            return;
+        }
+
+        if (m_state == CircuitState::HalfOpen) {
+            if (t_failed) {
+                // Not recovered yet.
+                open();
+            } else {
+                // Recovered: start over with a clean slate.
+                m_state = CircuitState::Closed;
+                m_outcomes.clear();
+                m_nextOutcome = 0;
+
+                std::cerr << "CircuitBreaker: " << m_name << " has recovered." << std::endl;
+            }
+            return;
+        }
+
+        if (m_state == CircuitState::Open) {
+            // A straggler sent before the circuit opened, it has already been accounted for.
+            return;
+        }
+
+        if (m_outcomes.size() < m_settings.windowSize) {
+            m_outcomes.push_back(t_failed);
+        } else {
+            m_outcomes[m_nextOutcome] = t_failed;
+        }
+        m_nextOutcome = (m_nextOutcome + 1) % m_settings.windowSize;
+
+        if (t_failed and m_outcomes.size() >= m_settings.minRequests) {
+            auto failures = (size_t)std::count(m_outcomes.begin(), m_outcomes.end(), true);
+
+            if (failures * 100 >= m_outcomes.size() * (size_t)m_settings.failureRate) {
+                open();
+            }
+        }
+    }
+
+    CircuitState CircuitBreaker::getState() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_state;
+    }
+
+    /**
+     * @return Number of requests that were failed fast instead of being sent.
+     */
+    unsigned long CircuitBreaker::getShortCircuitCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        return m_shortCircuits;
+    }
+
+    const char *circuitStateToString(CircuitState t_state) {
+        switch (t_state) {
+            case CircuitState::Closed:
+                return "closed";
+            case CircuitState::Open:
+                return "open";
+            case CircuitState::HalfOpen:
+                return "half-open";
+        }
+
+        return "unknown";
+    }
+
+    /**
+     * Reads the circuit breaker settings from config, once.
+     *
+     * @return Settings, with defaults for anything that isn't configured.
+     */
+    circuitBreakerSettings_t getCircuitBreakerSettings() {
+        static std::once_flag loaded;
+        static circuitBreakerSettings_t settings;
+
+        std::call_once(loaded, []() {
+            std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+            const std::string section = "network/circuit_breaker/";
+
+            settings.enabled = cfg->getInt(section + "enabled", CIRCUIT_BREAKER_DEFAULT_ENABLED) != 0;
+            settings.windowSize = (size_t)cfg->getInt(section + "window_size", CIRCUIT_BREAKER_DEFAULT_WINDOW_SIZE);
+            settings.minRequests = (size_t)cfg->getInt(section + "min_requests",
+                                                       CIRCUIT_BREAKER_DEFAULT_MIN_REQUESTS);
+            settings.failureRate = cfg->getInt(section + "failure_rate", CIRCUIT_BREAKER_DEFAULT_FAILURE_RATE);
+            settings.openMs = cfg->getLongInt(section + "open_ms", CIRCUIT_BREAKER_DEFAULT_OPEN_MS);
+            settings.halfOpenProbes = cfg->getInt(section + "half_open_probes",
+                                                  CIRCUIT_BREAKER_DEFAULT_HALF_OPEN_PROBES);
+            settings.responseCacheMaxBytes = (size_t)cfg->getLongInt(section + "response_cache_max_bytes",
+                                                                     RESPONSE_CACHE_DEFAULT_MAX_BYTES);
+            settings.cacheResponseBodies = cfg->getInt(section + "cache_response_bodies",
+                                                       RESPONSE_CACHE_DEFAULT_CACHE_BODIES) != 0;
+        });
+
+        return settings;
+    }
+
+    /**
+     * Returns the process-wide circuit breaker of an endpoint, creating it on first use.
+     *
+     * @param t_endpoint    Endpoint URL (no query string).
+     * @return              Circuit breaker, valid for the rest of the process' lifetime.
+     */
+    CircuitBreaker &getCircuitBreaker(const std::string &t_endpoint) {
+        circuitBreakerSettings_t settings = getCircuitBreakerSettings();
+        std::lock_guard<std::mutex> lock(circuitBreakersMutex);
+
+        std::unique_ptr<CircuitBreaker> &breaker = circuitBreakers[t_endpoint];
+        if (breaker == nullptr) {
+            breaker = std::make_unique<CircuitBreaker>(t_endpoint, settings);
+        }
+
+        return *breaker;
+    }
+
+    std::map<std::string, CircuitState> getCircuitStates() {
+        std::map<std::string, CircuitState> states;
+        std::lock_guard<std::mutex> lock(circuitBreakersMutex);
+
+        for (const auto &breaker : circuitBreakers) {
+            states[breaker.first] = breaker.second->getState();
+        }
+
+        return states;
+    }
+
+    /**
+     * Approximates the memory held by a parsed response: its strings plus a JSON node for every value.
+     *
+     * @param t_response    Parsed response.
+     * @return              Size in bytes.
+     */
+    size_t getResponseSize(const nlohmann::json &t_response) {
+        size_t bytes = sizeof(nlohmann::json);
+
+        if (t_response.is_string()) {
+            bytes += t_response.get_ref<const std::string &>().size();
+        } else if (t_response.is_object()) {
+            for (auto it = t_response.begin(); it != t_response.end(); ++it) {
+                bytes += it.key().size() + getResponseSize(it.value());
+            }
+        } else if (t_response.is_array()) {
+            for (const auto &value : t_response) {
+                bytes += getResponseSize(value);
+            }
+        }
+
+        return bytes;
+    }
+
+    /**
+     * @param t_response    Raw response body.
+     * @return              Size in bytes.
+     */
+    size_t getResponseSize(const std::string &t_response) {
+        return sizeof(std::string) + t_response.size();
+    }
+
+    /**
+     * The process-wide cache of last good responses, served while a circuit is open.
+     */
+    ResponseCache &getStaleResponseCache() {
+        static circuitBreakerSettings_t settings = getCircuitBreakerSettings();
+        static ResponseCache cache(settings.enabled ? RESPONSE_CACHE_DEFAULT_MAX_ENTRIES : 0,
+                                   settings.responseCacheMaxBytes);
+
+        return cache;
+    }
+
+    /**
+     * Like getStaleResponseCache, for callers that take the response body unparsed.
+     *
+     * Off unless "cache_response_bodies" is set: bodies are large (a videos.list() page runs to ~100 KB) and the
+     * one-shot CLI never gets to serve them, only a long-running process does.
+     */
+    ResponseBodyCache &getStaleResponseBodyCache() {
+        static circuitBreakerSettings_t settings = getCircuitBreakerSettings();
+        static ResponseBodyCache cache(settings.enabled and settings.cacheResponseBodies
+                                       ? RESPONSE_CACHE_DEFAULT_MAX_ENTRIES : 0, settings.responseCacheMaxBytes);
+
+        return cache;
+    }
+} // namespace sane
@@ -2,6 +2,9 @@
 #include <iostream>
 #include <string>
 #include <list>
+#include <mutex>
+#include <vector>
+#include <algorithm>
 
 // 3rd party libraries.
 #include <curl/curl.h>
@@ -11,6 +14,8 @@
 #include <api_handler/api_handler.hpp>
 #include <db_handler/db_youtube_channels.hpp>
 #include <youtube/toolkit.hpp>
+#include <config_handler/config_handler.hpp>
+#include <concurrency/work_stealing_scheduler.hpp>
 
 namespace sane {
     void APIHandler::printReport(int t_warningsCount, int t_errorsCount) {
@@ -32,8 +37,8 @@ namespace sane {
     }
 
     void APIHandler::printReport(std::shared_ptr<YoutubeChannel> &t_channel) {
-        int warningsCount = t_channel->getWarnings().size();
-        int errorsCount = t_channel->getErrors().size();
+        int warningsCount = t_channel->getWarningCount();
+        int errorsCount = t_channel->getErrorCount();
 
         printReport(warningsCount, errorsCount);
     }
@@ -49,56 +54,54 @@ namespace sane {
         bool hasNextPage = true;
         int totalResults = 0;
         int counter = 1;
+        // Guards the above while channel tasks are running.
+        std::mutex resultsMutex;
 
         filter["mine"] = "true";
         optParams["maxResults"] = "50";
 
+        // Channels are looked up one request each, on a work-stealing scheduler while the next page is retrieved.
+        std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+        WorkStealingScheduler scheduler((size_t)std::max(cfg->getInt("threading/bulk_workers",
+                                                                     SCHEDULER_DEFAULT_WORKERS), 1));
+
         // Iterate the pages in the response.
         while (hasNextPage) {
             nlohmann::json subscriptionsPageJson = youtubeListSubscriptions(part, filter, optParams);
 
             if (hasItems(subscriptionsPageJson)) {
+                {
+                    std::lock_guard<std::mutex> lock(resultsMutex);
+                    totalResults = subscriptionsPageJson["pageInfo"]["totalResults"].get<int>();
+                }
+
                 // Iterate the subscription resource items on the page
                 for (const auto &subscription : subscriptionsPageJson["items"]) {
-                    std::map<std::string, std::string> channelFilter;
-                    std::string progressPercentString;
                     std::string subscriptionTitle = subscription["snippet"]["title"].get<std::string>();
+                    std::string channelId = subscription["snippet"]["resourceId"]["channelId"].get<std::string>();
 
-                    totalResults = subscriptionsPageJson["pageInfo"]["totalResults"].get<int>();
+                    scheduler.submit([this, subscriptionTitle, channelId, &channels, &warningsCount, &errorsCount,
+                                      &totalResults, &counter, &resultsMutex]() {
+                        std::map<std::string, std::string> channelFilter;
+                        channelFilter["id"] = channelId;
+
+                        // Get a proper Channel resource from the rudimentary Subscription resource
+                        // (APIHandler isn't thread-safe, so every task gets its own).
+                        APIHandler api(m_context);
+                        nlohmann::json channelJson = api.youtubeListChannels("id,snippet,contentDetails",
+                                                                             channelFilter);
+                        std::shared_ptr<YoutubeChannel> channel;
+
+                        if (hasItems(channelJson)) {
+                            channel = std::make_shared<YoutubeChannel>(channelJson["items"][0]);
+                        }
+
+                        std::lock_guard<std::mutex> lock(resultsMutex);
 
-                    // Define the current progress as a whole string line
-                    std::string progressLine = std::to_string(counter) + "/" + std::to_string(totalResults);
-                    float progressPercent = (float)counter / totalResults * 100;
-
-                    if (counter < totalResults) {
-                        progressPercentString = std::to_string(progressPercent).substr(0, 4);
-                    } else {
-                        // Handle "100." case, where there's no decimals, only the decimal point.
-                        progressPercentString = std::to_string(progressPercent).substr(0, 3);
-                    }
-
-
-                    // Return to start of line and overwrite with progressLine (works cos it never shrinks in length)
-                    try {
-                        std::cout << "\r" << "Retrieving " << "subscriptions... "
-                                  << progressPercentString << "% " << "(" << progressLine << "): "
-                                  << subscriptionTitle
-                                  << std::string(60 - subscriptionTitle.length(), ' ')
-                                  << std::flush;
-                    } catch (const std::exception &exc) {
-                        std::cerr << "APIHandler::getSubscriptionsEntities unhandled exception on '"
-                                  << subscriptionTitle <<  "': " << std::string(exc.what()) << std::endl;
-                    }
-                    channelFilter["id"] = subscription["snippet"]["resourceId"]["channelId"].get<std::string>();
-
-                    // Get a proper Channel resource from the rudimentary Subscription resource.
-                    nlohmann::json channelJson = youtubeListChannels("id,snippet,contentDetails", channelFilter);
-
-                    if (hasItems(channelJson)) {
-                         std::shared_ptr<YoutubeChannel> channel;
-                         channel = std::make_shared<YoutubeChannel>(channelJson["items"][0]);
-
-                        if (channel->wasAborted()) {
+                        if (channel == nullptr) {
+                            std::cerr << "Channels.list() resource had no items!\n" << channelJson.dump(4)
+                                      << std::endl;
+                        } else if (channel->wasAborted()) {
                             // Explicitly delete the broken channel object now instead of waiting for smart ptr deallocation.
                             channel.reset();
                             std::cerr << "ERROR: Creation of the following channel was aborted:\n"
@@ -106,18 +109,38 @@ namespace sane {
                                       << std::endl;
                         } else {
                             // Update total warnings and errors counter.
-                            warningsCount += channel->getWarnings().size();
-                            errorsCount += channel->getErrors().size();
+                            warningsCount += channel->getWarningCount();
+                            errorsCount += channel->getErrorCount();
 
                             // Add the channel entity to the list.
                             channels.push_back(channel);
                         }
 
-                    } else {
-                        std::cerr << "Channels.list() resource had no items!\n" << subscriptionsPageJson.dump(4)
-                                  << std::endl;
-                    }
-                    counter++;
+                        // Define the current progress as a whole string line
+                        std::string progressPercentString;
+                        std::string progressLine = std::to_string(counter) + "/" + std::to_string(totalResults);
+                        float progressPercent = (float)counter / totalResults * 100;
+
+                        if (counter < totalResults) {
+                            progressPercentString = std::to_string(progressPercent).substr(0, 4);
+                        } else {
+                            // Handle "100." case, where there's no decimals, only the decimal point.
+                            progressPercentString = std::to_string(progressPercent).substr(0, 3);
+                        }
+
+                        // Return to start of line and overwrite with progressLine (works cos it never shrinks in length)
+                        try {
+                            std::cout << "\r" << "Retrieving " << "subscriptions... "
+                                      << progressPercentString << "% " << "(" << progressLine << "): "
+                                      << subscriptionTitle
+                                      << std::string(60 - subscriptionTitle.length(), ' ')
+                                      << std::flush;
+                        } catch (const std::exception &exc) {
+                            std::cerr << "APIHandler::getSubscriptionsEntities unhandled exception on '"
+                                      << subscriptionTitle <<  "': " << std::string(exc.what()) << std::endl;
+                        }
+                        counter++;
+                    });
                 } // for subscription
             } else {
                 std::cerr << "Subscriptions.list() resource page had no items!\n" << subscriptionsPageJson.dump(4)
@@ -136,22 +159,109 @@ namespace sane {
                 hasNextPage = false;
             }
         } // while (hasNextPage)
+        // Wait for the last channels to be looked up.
+        scheduler.wait();
+
         // Newline after one-line progressbar.
         std::cout << std::endl;
 
-        printReport(warningsCount, errorsCount);
+        storeSubscriptionsEntities(channels, warningsCount, errorsCount, clearProblems);
+    }
 
-        if (clearProblems) {
+    /**
+     * Reports on and stores the channels retrieved by getSubscriptionsEntities.
+     */
+    void APIHandler::storeSubscriptionsEntities(std::list<std::shared_ptr<YoutubeChannel>> &t_channels,
+                                                size_t t_warningsCount, size_t t_errorsCount, bool t_clearProblems) {
+        printReport((int)t_warningsCount, (int)t_errorsCount);
+
+        if (t_clearProblems) {
             // Clear the warnings and errors in the channel objects to save resources.
-            for (auto &channel : channels) {
+            for (auto &channel : t_channels) {
                 channel->clearErrorsAndWarnings();
             }
         }
 
         // Store to Database
         std::cout << "Storing to database..." << std::endl;
-        addChannelsToDB(channels, NO_ERROR_LOG);
+        addChannelsToDB(t_channels, NO_ERROR_LOG);
         std::cout << "Storing to database successful!" << std::endl;
     }
 
+#ifdef SANE_ENABLE_COROUTINES
+    /**
+     * Coroutine version of getSubscriptionsEntities: pages through the subscriptions and looks up every page's
+     * channels concurrently, all on t_loop.
+     *
+     * @param t_loop            Event loop to run the requests on.
+     * @param t_clearProblems   Clear the channels' warnings and errors once reported.
+     */
+    Task<void> APIHandler::getSubscriptionsEntitiesAsync(EventLoop &t_loop, bool t_clearProblems) {
+        std::list<std::shared_ptr<YoutubeChannel>> channels;
+        std::map<std::string, std::string> filter;
+        std::map<std::string, std::string> optParams;
+        size_t warningsCount = 0;
+        size_t errorsCount = 0;
+        bool hasNextPage = true;
+
+        filter["mine"] = "true";
+        optParams["maxResults"] = "50";
+
+        while (hasNextPage) {
+            // snippet is required because 'id' part is the ID of the subscription, not the channel.
+            nlohmann::json subscriptionsPageJson = co_await youtubeListSubscriptionsAsync(t_loop, "snippet", filter,
+                                                                                         optParams);
+
+            if (!hasItems(subscriptionsPageJson)) {
+                std::cerr << "Subscriptions.list() resource page had no items!\n" << subscriptionsPageJson.dump(4)
+                          << std::endl;
+                break;
+            }
+
+            // Get a proper Channel resource for every rudimentary Subscription resource on the page, all at once.
+            std::vector<Task<nlohmann::json>> lookups;
+            for (const auto &subscription : subscriptionsPageJson["items"]) {
+                std::map<std::string, std::string> channelFilter;
+                channelFilter["id"] = subscription["snippet"]["resourceId"]["channelId"].get<std::string>();
+
+                lookups.push_back(youtubeListChannelsAsync(t_loop, "id,snippet,contentDetails", channelFilter));
+            }
+
+            for (auto &channelJson : co_await whenAll(std::move(lookups))) {
+                if (!hasItems(channelJson)) {
+                    std::cerr << "Channels.list() resource had no items!\n" << channelJson.dump(4) << std::endl;
+                    continue;
+                }
+
+                std::shared_ptr<YoutubeChannel> channel = std::make_shared<YoutubeChannel>(channelJson["items"][0]);
+
+                if (channel->wasAborted()) {
+                    std::cerr << "ERROR: Creation of the following channel was aborted:\n" << channelJson.dump(4)
+                              << std::endl;
+                } else {
+                    warningsCount += channel->getWarningCount();
+                    errorsCount += channel->getErrorCount();
+                    channels.push_back(channel);
+                }
+            }
+
+            std::cout << "\r" << "Retrieving " << "subscriptions... (" << channels.size() << "/"
+                      << subscriptionsPageJson["pageInfo"]["totalResults"].get<int>() << ")" << std::flush;
+
+            // Traverse to next page
+            if (subscriptionsPageJson.find("nextPageToken") != subscriptionsPageJson.end()
+                and subscriptionsPageJson["nextPageToken"].is_string()
+                and !subscriptionsPageJson["nextPageToken"].empty()) {
+                optParams["pageToken"] = subscriptionsPageJson["nextPageToken"].get<std::string>();
+            } else {
+                hasNextPage = false;
+            }
+        }
+        // Newline after one-line progressbar.
+        std::cout << std::endl;
+
+        storeSubscriptionsEntities(channels, warningsCount, errorsCount, t_clearProblems);
+    }
+#endif
+
 } // namespace sane
\ No newline at end of file
@@ -0,0 +1,489 @@
+#ifdef SANE_ENABLE_COROUTINES
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <api_handler/event_loop.hpp>
+#include <api_handler/http_context.hpp>
+
+namespace sane {
+    bool EventLoop::transferAwaiter::await_suspend(std::coroutine_handle<> t_handle) {
+        CURLMcode mc = curl_multi_add_handle(loop.m_multi, curl);
+
+        if (mc != CURLM_OK) {
+            std::cerr << "EventLoop: curl_multi_add_handle failed: " << curl_multi_strerror(mc) << std::endl;
+
+            // Don't suspend, the coroutine carries on with the failure right away.
+            result = CURLE_FAILED_INIT;
+            return false;
+        }
+
+        handle = t_handle;
+        loop.m_transfers[curl] = this;
+        loop.m_peakTransfers = std::max(loop.m_peakTransfers, loop.m_transfers.size());
+
+        return true;
+    }
+
+    /**
+     * Only does anything if the coroutine is destroyed while the transfer is still on the loop.
+     */
+    EventLoop::transferAwaiter::~transferAwaiter() {
+        auto transfer = loop.m_transfers.find(curl);
+        if (transfer == loop.m_transfers.end() or transfer->second != this) {
+            return;
+        }
+
+        // Before the caller's clean-up of the easy handle, which must not be in a multi handle by then.
+        if (!completed) {
+            curl_multi_remove_handle(loop.m_multi, curl);
+        }
+        loop.m_transfers.erase(transfer);
+    }
+
+    void EventLoop::sleepAwaiter::await_suspend(std::coroutine_handle<> t_handle) {
+        handle = t_handle;
+        loop.m_timers.emplace(wakeAt, this);
+    }
+
+    /**
+     * Only does anything if the coroutine is destroyed while still asleep.
+     */
+    EventLoop::sleepAwaiter::~sleepAwaiter() {
+        if (!handle) {
+            return;
+        }
+
+        auto timers = loop.m_timers.equal_range(wakeAt);
+        for (auto timer = timers.first; timer != timers.second; timer++) {
+            if (timer->second == this) {
+                loop.m_timers.erase(timer);
+                break;
+            }
+        }
+    }
+
+    EventLoop::EventLoop() {
+        HTTPContext::initialize();
+
+        m_multi = curl_multi_init();
+        if (!m_multi) {
+            std::cerr << "EventLoop ERROR: curl_multi_init failed!" << std::endl;
+        } else {
+            curl_multi_setopt(m_multi, CURLMOPT_SOCKETFUNCTION, socketCallback);
+            curl_multi_setopt(m_multi, CURLMOPT_SOCKETDATA, this);
+            curl_multi_setopt(m_multi, CURLMOPT_TIMERFUNCTION, timerCallback);
+            curl_multi_setopt(m_multi, CURLMOPT_TIMERDATA, this);
+        }
+
+        if (pipe(m_wakeupPipe) != 0) {
+            std::cerr << "EventLoop ERROR: Unable to create wakeup pipe, wakeup() won't interrupt the loop!"
+                      << std::endl;
+            m_wakeupPipe[0] = m_wakeupPipe[1] = -1;
+        } else {
+            for (int fd : m_wakeupPipe) {
+                fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+                fcntl(fd, F_SETFD, FD_CLOEXEC);
+            }
+        }
+    }
+
+    /**
+     * Destroys every spawned task that hasn't finished (along with whatever it was awaiting).
+     */
+    EventLoop::~EventLoop() {
+        // The host is tearing down too, don't tell it about sockets going away.
+        m_watchCallback = nullptr;
+
+        for (const auto &transfer : m_transfers) {
+            curl_multi_remove_handle(m_multi, transfer.first);
+        }
+        m_transfers.clear();
+        m_timers.clear();
+        m_spawned.clear();
+
+        if (m_multi) {
+            curl_multi_cleanup(m_multi);
+        }
+
+        for (int fd : m_wakeupPipe) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+    }
+
+    /**
+     * co_await loop.transfer(curl) performs a configured easy handle's transfer without blocking the loop.
+     *
+     * @param t_curl    Fully configured libcURL easy handle, owned by the caller.
+     * @return          Awaitable resulting in the transfer's CURLcode.
+     */
+    EventLoop::transferAwaiter EventLoop::transfer(CURL *t_curl) {
+        return transferAwaiter{*this, t_curl, CURLE_OK, nullptr};
+    }
+
+    /**
+     * co_await loop.sleepFor(duration) suspends the coroutine without blocking the loop.
+     */
+    EventLoop::sleepAwaiter EventLoop::sleepFor(std::chrono::milliseconds t_duration) {
+        return sleepAwaiter{*this, std::chrono::steady_clock::now() + t_duration, nullptr};
+    }
+
+    /**
+     * Starts a top-level task, it runs up to its first suspension point right away.
+     *
+     * @param t_task    Task, exceptions escaping it are reported once it is done.
+     */
+    void EventLoop::spawn(Task<void> t_task) {
+        m_spawned.push_back(std::move(t_task));
+        m_spawned.back().start();
+    }
+
+    /**
+     * Runs the loop until every spawned task, transfer and timer is done.
+     */
+    void EventLoop::run() {
+        reapSpawned();
+
+        while (hasPendingWork()) {
+            runOnce();
+        }
+    }
+
+    /**
+     * Interrupts the loop's wait, e.g. after cancelling a request context from another thread.
+     *
+     * The only member function that may be called from any thread.
+     */
+    void EventLoop::wakeup() {
+        if (m_wakeupPipe[1] >= 0) {
+            char byte = 1;
+            // A full pipe already has a wake-up pending.
+            (void)!write(m_wakeupPipe[1], &byte, 1);
+        }
+    }
+
+    /**
+     * @return  Every descriptor a host loop has to watch right now, including the one wakeup() signals on.
+     */
+    std::vector<pollDescriptor_t> EventLoop::getPollDescriptors() const {
+        std::vector<pollDescriptor_t> descriptors;
+        descriptors.reserve(m_sockets.size() + 1);
+
+        if (m_wakeupPipe[0] >= 0) {
+            descriptors.push_back({m_wakeupPipe[0], EVENT_LOOP_POLL_IN});
+        }
+        for (const auto &socket : m_sockets) {
+            descriptors.push_back({(int)socket.first, socket.second});
+        }
+
+        return descriptors;
+    }
+
+    /**
+     * Keeps a host loop up to date with the descriptors to watch (e.g. one QSocketNotifier per descriptor).
+     *
+     * The callback is called right away for every current descriptor, and from then on from within
+     * processEvents() and awaiting a transfer. It must not call processEvents() itself.
+     *
+     * @param t_callback    Callback, nullptr to stop.
+     */
+    void EventLoop::setWatchCallback(watchCallback_t t_callback) {
+        m_watchCallback = std::move(t_callback);
+
+        if (m_watchCallback) {
+            for (const pollDescriptor_t &descriptor : getPollDescriptors()) {
+                m_watchCallback(descriptor.fd, descriptor.events);
+            }
+        }
+    }
+
+    /**
+     * @return  Milliseconds until processEvents() is due even if no descriptor has activity, 0 if it is due
+     *          already and -1 if nothing is scheduled.
+     */
+    long EventLoop::getTimeoutMs() const {
+        auto now = std::chrono::steady_clock::now();
+        std::optional<std::chrono::steady_clock::time_point> dueAt = m_curlTimeoutAt;
+
+        if (!m_transfers.empty()) {
+            dueAt = dueAt ? std::min(*dueAt, m_nextHousekeeping) : m_nextHousekeeping;
+        }
+        if (!m_timers.empty()) {
+            dueAt = dueAt ? std::min(*dueAt, m_timers.begin()->first) : m_timers.begin()->first;
+        }
+
+        if (!dueAt) {
+            return -1;
+        }
+
+        // Rounded up, so a host sleeping the full timeout doesn't wake up just short of it.
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(*dueAt - now);
+
+        return std::max((long)remaining.count(), 0L);
+    }
+
+    /**
+     * Handles activity on a descriptor, resuming whatever it completed.
+     *
+     * @param t_fd      Descriptor from getPollDescriptors() (or the watch callback).
+     * @param t_events  EVENT_LOOP_POLL_* events it has, 0 if unknown (e.g. an error condition).
+     */
+    void EventLoop::processEvents(int t_fd, int t_events) {
+        if (t_fd == m_wakeupPipe[0]) {
+            char buffer[64];
+            while (read(m_wakeupPipe[0], buffer, sizeof(buffer)) > 0) {}
+        } else if (m_sockets.count((curl_socket_t)t_fd) > 0) {
+            int eventBitmask = 0;
+            if (t_events & EVENT_LOOP_POLL_IN) {
+                eventBitmask |= CURL_CSELECT_IN;
+            }
+            if (t_events & EVENT_LOOP_POLL_OUT) {
+                eventBitmask |= CURL_CSELECT_OUT;
+            }
+
+            socketAction((curl_socket_t)t_fd, eventBitmask);
+        }
+
+        reapSpawned();
+    }
+
+    /**
+     * Handles whatever is due: libcURL timeouts, sleeping coroutines and housekeeping.
+     *
+     * Safe to call at any time, a host loop calls it at least once getTimeoutMs() has passed.
+     */
+    void EventLoop::processEvents() {
+        auto now = std::chrono::steady_clock::now();
+
+        if (m_curlTimeoutAt and *m_curlTimeoutAt <= now) {
+            m_curlTimeoutAt.reset();
+            socketAction(CURL_SOCKET_TIMEOUT, 0);
+        }
+
+        if (!m_transfers.empty() and m_nextHousekeeping <= now) {
+            m_nextHousekeeping = now + std::chrono::milliseconds(EVENT_LOOP_MAX_POLL_MS);
+
+            // Drives every transfer once, so progress callbacks get to abort cancelled ones.
+            std::vector<curl_socket_t> sockets;
+            for (const auto &socket : m_sockets) {
+                sockets.push_back(socket.first);
+            }
+            for (curl_socket_t socket : sockets) {
+                if (m_sockets.count(socket) > 0) {
+                    socketAction(socket, 0);
+                }
+            }
+        }
+
+        resumeDueTimers();
+        reapSpawned();
+    }
+
+    /**
+     * @return  Whether any spawned task, transfer or timer is still outstanding.
+     */
+    bool EventLoop::hasPendingWork() const {
+        return !m_spawned.empty() or !m_transfers.empty() or !m_timers.empty();
+    }
+
+    size_t EventLoop::getActiveTransferCount() const {
+        return m_transfers.size();
+    }
+
+    /**
+     * @return  The most transfers that have been in flight at once since the last resetPeakTransferCount().
+     */
+    size_t EventLoop::getPeakTransferCount() const {
+        return m_peakTransfers;
+    }
+
+    /**
+     * Starts tracking the peak over from the transfers in flight right now.
+     */
+    void EventLoop::resetPeakTransferCount() {
+        m_peakTransfers = m_transfers.size();
+    }
+
+    size_t EventLoop::getPendingTaskCount() const {
+        return m_spawned.size();
+    }
+
+    /**
+     * libcURL telling us which socket to watch for what (CURLMOPT_SOCKETFUNCTION).
+     */
+    int EventLoop::socketCallback(CURL *t_curl, curl_socket_t t_socket, int t_what, void *t_userp,
+                                  void *t_socketp) {
+        (void)t_curl;
+        (void)t_socketp;
+        auto *loop = static_cast<EventLoop*>(t_userp);
+        int events = 0;
+
+        if (t_what == CURL_POLL_IN or t_what == CURL_POLL_INOUT) {
+            events |= EVENT_LOOP_POLL_IN;
+        }
+        if (t_what == CURL_POLL_OUT or t_what == CURL_POLL_INOUT) {
+            events |= EVENT_LOOP_POLL_OUT;
+        }
+
+        if (t_what == CURL_POLL_REMOVE) {
+            loop->m_sockets.erase(t_socket);
+        } else {
+            loop->m_sockets[t_socket] = events;
+        }
+
+        if (loop->m_watchCallback) {
+            loop->m_watchCallback((int)t_socket, events);
+        }
+
+        return 0;
+    }
+
+    /**
+     * libcURL telling us when it next wants CURL_SOCKET_TIMEOUT handled (CURLMOPT_TIMERFUNCTION).
+     */
+    int EventLoop::timerCallback(CURLM *t_multi, long t_timeoutMs, void *t_userp) {
+        (void)t_multi;
+        auto *loop = static_cast<EventLoop*>(t_userp);
+
+        if (t_timeoutMs < 0) {
+            loop->m_curlTimeoutAt.reset();
+        } else {
+            loop->m_curlTimeoutAt = std::chrono::steady_clock::now() + std::chrono::milliseconds(t_timeoutMs);
+        }
+
+        return 0;
+    }
+
+    /**
+     * One round of the built-in host loop: wait for activity or a timeout, then process it.
+     */
+    void EventLoop::runOnce() {
+        std::vector<pollDescriptor_t> descriptors = getPollDescriptors();
+        std::vector<pollfd> pollFds;
+        pollFds.reserve(descriptors.size());
+
+        for (const pollDescriptor_t &descriptor : descriptors) {
+            short events = 0;
+            if (descriptor.events & EVENT_LOOP_POLL_IN) {
+                events |= POLLIN;
+            }
+            if (descriptor.events & EVENT_LOOP_POLL_OUT) {
+                events |= POLLOUT;
+            }
+            pollFds.push_back({descriptor.fd, events, 0});
+        }
+
+        long timeoutMs = getTimeoutMs();
+        if (timeoutMs < 0 or timeoutMs > EVENT_LOOP_MAX_POLL_MS) {
+            timeoutMs = EVENT_LOOP_MAX_POLL_MS;
+        }
+
+        if (poll(pollFds.data(), pollFds.size(), (int)timeoutMs) > 0) {
+            for (const pollfd &pollFd : pollFds) {
+                if (pollFd.revents == 0) {
+                    continue;
+                }
+
+                int events = 0;
+                if (pollFd.revents & (POLLIN | POLLHUP | POLLERR)) {
+                    events |= EVENT_LOOP_POLL_IN;
+                }
+                if (pollFd.revents & POLLOUT) {
+                    events |= EVENT_LOOP_POLL_OUT;
+                }
+                processEvents(pollFd.fd, events);
+            }
+        }
+
+        processEvents();
+    }
+
+    /**
+     * Lets libcURL act on a socket (or its timeouts), then resumes the coroutines whose transfers are done.
+     */
+    void EventLoop::socketAction(curl_socket_t t_socket, int t_eventBitmask) {
+        std::vector<CURL*> ready;
+        int running = 0;
+
+        CURLMcode mc = curl_multi_socket_action(m_multi, t_socket, t_eventBitmask, &running);
+        if (mc != CURLM_OK) {
+            std::cerr << "EventLoop: curl_multi_socket_action failed: " << curl_multi_strerror(mc) << std::endl;
+        }
+
+        CURLMsg *message;
+        int messagesLeft;
+        while ((message = curl_multi_info_read(m_multi, &messagesLeft))) {
+            if (message->msg != CURLMSG_DONE) {
+                continue;
+            }
+
+            // Copied before removing the handle, which invalidates the message.
+            CURL *easy = message->easy_handle;
+            CURLcode result = message->data.result;
+            auto transfer = m_transfers.find(easy);
+            curl_multi_remove_handle(m_multi, easy);
+
+            if (transfer != m_transfers.end()) {
+                transfer->second->result = result;
+                transfer->second->completed = true;
+                ready.push_back(easy);
+            }
+        }
+
+        // Resumed coroutines may start new transfers and timers, libcURL asks for those to be handled in time.
+        // They may also destroy other coroutines, so every transfer is looked up again right before resuming.
+        for (CURL *easy : ready) {
+            auto transfer = m_transfers.find(easy);
+            if (transfer == m_transfers.end() or !transfer->second->completed) {
+                continue;
+            }
+
+            std::coroutine_handle<> handle = transfer->second->handle;
+            m_transfers.erase(transfer);
+            handle.resume();
+        }
+    }
+
+    /**
+     * Resumes the sleeping coroutines that are due.
+     */
+    void EventLoop::resumeDueTimers() {
+        auto now = std::chrono::steady_clock::now();
+
+        // One at a time, a resumed coroutine may destroy (and so unschedule) other sleeping ones. Timers it
+        // schedules are due after now, so this ends.
+        while (!m_timers.empty() and m_timers.begin()->first <= now) {
+            std::coroutine_handle<> handle = m_timers.begin()->second->handle;
+            m_timers.erase(m_timers.begin());
+            handle.resume();
+        }
+    }
+
+    /**
+     * Drops spawned tasks that are done, reporting the ones that failed.
+     */
+    void EventLoop::reapSpawned() {
+        for (auto task = m_spawned.begin(); task != m_spawned.end(); ) {
+            if (!task->done()) {
+                task++;
+                continue;
+            }
+
+            try {
+                task->result();
+            } catch (const std::exception &exc) {
+                std::cerr << "EventLoop: Unhandled exception in task: " << std::string(exc.what()) << std::endl;
+            }
+            task = m_spawned.erase(task);
+        }
+    }
+} // namespace sane
+
+#endif // SANE_ENABLE_COROUTINES
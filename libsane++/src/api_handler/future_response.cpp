@@ -0,0 +1,198 @@
+// Standard libraries.
+#include <string>
+#include <map>
+#include <memory>
+#include <algorithm>
+
+// 3rd party libraries.
+#include <nlohmann/json.hpp>
+
+// Project specific libraries.
+#include <api_handler/api_handler.hpp>
+#include <config_handler/config_handler.hpp>
+#include <concurrency/futures.hpp>
+
+namespace sane {
+    /**
+     * Executor shared by every future-based request, started on first use.
+     *
+     * Sized by threading/bulk_workers, which puts an upper bound on how many requests are in flight at once.
+     *
+     * @return  The process wide executor.
+     */
+    WorkStealingScheduler &getApiExecutor() {
+        static WorkStealingScheduler executor([]() {
+            std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+
+            return (size_t)std::max(cfg->getInt("threading/bulk_workers", SCHEDULER_DEFAULT_WORKERS), 1);
+        }());
+
+        return executor;
+    }
+
+    /**
+     * Runs a request on the shared executor.
+     *
+     * The request is made by an APIHandler of its own (easy handles aren't thread-safe), bound to this instance's
+     * request context so cancelling it cancels the request.
+     *
+     * @param t_request Function making the request(s) through the handler it is given.
+     * @return          Future of the response.
+     */
+    std::future<nlohmann::json> APIHandler::submitRequest(std::function<nlohmann::json(APIHandler &)> t_request) {
+        requestContext_t context = m_context;
+
+        return submitFuture(getApiExecutor(), [context, t_request]() {
+            APIHandler api(context);
+
+            return t_request(api);
+        });
+    }
+
+    /**
+     * Runs a request on the shared executor and hands the response to a continuation.
+     *
+     * @param t_request         Function making the request(s) through the handler it is given.
+     * @param t_continuation    Called with the response, on the executor thread that made the request.
+     */
+    void APIHandler::submitRequest(std::function<nlohmann::json(APIHandler &)> t_request,
+                                   std::function<void(nlohmann::json)> t_continuation) {
+        requestContext_t context = m_context;
+
+        getApiExecutor().submit([context, t_request, t_continuation]() {
+            APIHandler api(context);
+
+            t_continuation(t_request(api));
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListActivitiesFuture(const std::string &t_part,
+                                                                        const std::map<std::string, std::string> &t_filter,
+                                                                        const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListActivities(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListCaptionsFuture(const std::string &t_part,
+                                                                      const std::string &t_videoId,
+                                                                      const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_videoId, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListCaptions(t_part, t_videoId, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListChannelsFuture(const std::string &t_part,
+                                                                      const std::map<std::string, std::string> &t_filter,
+                                                                      const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListChannels(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListChannelSectionsFuture(const std::string &t_part,
+                                                                             const std::map<std::string, std::string> &t_filter,
+                                                                             const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListChannelSections(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListCommentsFuture(const std::string &t_part,
+                                                                      const std::map<std::string, std::string> &t_filter,
+                                                                      const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListComments(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListCommentThreadsFuture(const std::string &t_part,
+                                                                            const std::map<std::string, std::string> &t_filter,
+                                                                            const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListCommentThreads(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListGuideCategoriesFuture(const std::string &t_part,
+                                                                             const std::map<std::string, std::string> &t_filter,
+                                                                             const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListGuideCategories(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListI18nLanguagesFuture(const std::string &t_part,
+                                                                           const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListI18nLanguages(t_part, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListI18nRegionsFuture(const std::string &t_part,
+                                                                         const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListI18nRegions(t_part, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListPlaylistItemsFuture(const std::string &t_part,
+                                                                           const std::map<std::string, std::string> &t_filter,
+                                                                           const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListPlaylistItems(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListPlaylistsFuture(const std::string &t_part,
+                                                                       const std::map<std::string, std::string> &t_filter,
+                                                                       const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListPlaylists(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListSubscriptionsFuture(const std::string &t_part,
+                                                                           const std::map<std::string, std::string> &t_filter,
+                                                                           const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListSubscriptions(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListVideoAbuseReportReasonsFuture(const std::string &t_part,
+                                                                                     const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListVideoAbuseReportReasons(t_part, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListVideoCategoriesFuture(const std::string &t_part,
+                                                                             const std::map<std::string, std::string> &t_filter,
+                                                                             const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListVideoCategories(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeListVideosFuture(const std::string &t_part,
+                                                                    const std::map<std::string, std::string> &t_filter,
+                                                                    const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_part, t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeListVideos(t_part, t_filter, t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeSearchFuture(const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_optParams](APIHandler &t_api) {
+            return t_api.youtubeSearch(t_optParams);
+        });
+    }
+
+    std::future<nlohmann::json> APIHandler::youtubeSearchFilteredFuture(const std::map<std::string, std::string> &t_filter,
+                                                                        const std::map<std::string, std::string> &t_optParams) {
+        return submitRequest([t_filter, t_optParams](APIHandler &t_api) {
+            return t_api.youtubeSearchFiltered(t_filter, t_optParams);
+        });
+    }
+} // namespace sane
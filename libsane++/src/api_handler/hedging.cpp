@@ -0,0 +1,149 @@
+#include <mutex>
+#include <vector>
+#include <algorithm>
+
+#include <api_handler/hedging.hpp>
+
+namespace sane {
+    /**
+     * Fixed size ring buffer of the most recent latencies seen for an endpoint.
+     */
+    struct latencyWindow_t {
+        std::vector<long> samples;
+        size_t next = 0;
+    };
+
+    static std::mutex latencyMutex;
+    static std::map<std::string, latencyWindow_t> latencyWindows;
+    static hedgingStats_t hedgingStats;
+
+    /**
+     * Computes a percentile (nearest-rank) of a set of samples.
+     *
+     * @param t_samples     Samples, copied since nth_element reorders them.
+     * @param t_percentile  Percentile in the range [1, 100].
+     * @return              Percentile value, or -1 if there are no samples.
+     */
+    static long percentileOf(std::vector<long> t_samples, int t_percentile) {
+        if (t_samples.empty()) {
+            return -1;
+        }
+
+        t_percentile = std::min(std::max(t_percentile, 1), 100);
+        size_t rank = (t_samples.size() * (size_t)t_percentile + 99) / 100;
+        auto nth = t_samples.begin() + (long)(rank - 1);
+
+        std::nth_element(t_samples.begin(), nth, t_samples.end());
+
+        return *nth;
+    }
+
+    /**
+     * Records how long a successful request to an endpoint took.
+     *
+     * @param t_endpoint        Endpoint URL (no query string).
+     * @param t_milliseconds    Time from the request being sent until it completed.
+     */
+    void recordLatency(const std::string &t_endpoint, long t_milliseconds) {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        latencyWindow_t &window = latencyWindows[t_endpoint];
+        if (window.samples.size() < LATENCY_WINDOW_SIZE) {
+            window.samples.push_back(t_milliseconds);
+        } else {
+            window.samples[window.next] = t_milliseconds;
+        }
+        window.next = (window.next + 1) % LATENCY_WINDOW_SIZE;
+    }
+
+    /**
+     * Returns the observed latency percentile for an endpoint.
+     *
+     * @param t_endpoint    Endpoint URL (no query string).
+     * @param t_percentile  Percentile in the range [1, 100].
+     * @param t_minSamples  Minimum number of samples required for the result to be meaningful.
+     * @return              Latency in milliseconds, or -1 if too few samples have been recorded.
+     */
+    long getLatencyPercentile(const std::string &t_endpoint, int t_percentile, size_t t_minSamples) {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        auto windowIter = latencyWindows.find(t_endpoint);
+        if (windowIter == latencyWindows.end() or windowIter->second.samples.size() < std::max(t_minSamples,
+                                                                                              (size_t)1)) {
+            return -1;
+        }
+
+        return percentileOf(windowIter->second.samples, t_percentile);
+    }
+
+    /**
+     * Returns the observed latency percentile for every endpoint seen so far.
+     *
+     * @param t_percentile  Percentile in the range [1, 100].
+     * @return              Map of <endpoint URL, latency in milliseconds>.
+     */
+    std::map<std::string, long> getLatencyPercentiles(int t_percentile) {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        std::map<std::string, long> percentiles;
+        for (const auto &window : latencyWindows) {
+            percentiles[window.first] = percentileOf(window.second.samples, t_percentile);
+        }
+
+        return percentiles;
+    }
+
+    /**
+     * Reserves quota for a hedge (duplicate) request, if the hedging budget allows it.
+     *
+     * @param t_quotaCost   Quota cost of the request that would be duplicated.
+     * @param t_quotaBudget Total quota units that may be spent on hedges.
+     * @return              true if the hedge may be sent.
+     */
+    bool tryAcquireHedge(long t_quotaCost, long t_quotaBudget) {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        if (hedgingStats.quotaSpent + t_quotaCost > t_quotaBudget) {
+            return false;
+        }
+
+        hedgingStats.quotaSpent += t_quotaCost;
+        hedgingStats.hedgesIssued++;
+
+        return true;
+    }
+
+    /**
+     * Gives back a hedge reserved with tryAcquireHedge that wasn't sent after all.
+     *
+     * @param t_quotaCost   Quota cost it was reserved with.
+     */
+    void refundHedge(long t_quotaCost) {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        hedgingStats.quotaSpent -= t_quotaCost;
+        hedgingStats.hedgesIssued--;
+    }
+
+    /**
+     * Records that a hedge request answered before the original.
+     */
+    void recordHedgeWon() {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        hedgingStats.hedgesWon++;
+    }
+
+    hedgingStats_t getHedgingStats() {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        return hedgingStats;
+    }
+
+    void resetLatencyTracking() {
+        std::lock_guard<std::mutex> lock(latencyMutex);
+
+        latencyWindows.clear();
+        hedgingStats = hedgingStats_t();
+    }
+} // namespace sane
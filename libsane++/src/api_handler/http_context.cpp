@@ -0,0 +1,117 @@
+#include <iostream>
+
+#include <api_handler/http_context.hpp>
+
+namespace sane {
+    CURLSH *HTTPContext::m_share = nullptr;
+    std::mutex HTTPContext::m_initMutex;
+    std::mutex HTTPContext::m_locks[CURL_LOCK_DATA_LAST];
+    bool HTTPContext::m_initialized = false;
+
+    /**
+     * Initializes libcURL globally and sets up the shared DNS/TLS session cache.
+     *
+     * Should be called once at startup before any threads are spawned, but is safe to call repeatedly
+     * (subsequent calls are no-ops), which is how the easy handle factory guarantees initialization.
+     *
+     * NB: The connection cache is deliberately not shared, libcURL does not support sharing connections
+     *     between concurrently running threads. Connection reuse is done per APIHandler instead.
+     */
+    void HTTPContext::initialize() {
+        std::lock_guard<std::mutex> lock(m_initMutex);
+
+        if (m_initialized) {
+            return;
+        }
+
+        CURLcode rc = curl_global_init(CURL_GLOBAL_DEFAULT);
+        if (rc != CURLE_OK) {
+            std::cerr << "HTTPContext::initialize ERROR: curl_global_init failed: " << curl_easy_strerror(rc)
+                      << std::endl;
+            return;
+        }
+
+        m_share = curl_share_init();
+        if (m_share) {
+            curl_share_setopt(m_share, CURLSHOPT_LOCKFUNC, lockCallback);
+            curl_share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, unlockCallback);
+            curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+            curl_share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        } else {
+            std::cerr << "HTTPContext::initialize WARNING: curl_share_init failed, DNS and TLS sessions "
+                         "will not be shared between handles." << std::endl;
+        }
+
+        m_initialized = true;
+    }
+
+    /**
+     * Tears down the share object and libcURL globals.
+     *
+     * Must only be called once every easy handle created through this context has been cleaned up.
+     */
+    void HTTPContext::cleanup() {
+        std::lock_guard<std::mutex> lock(m_initMutex);
+
+        if (!m_initialized) {
+            return;
+        }
+
+        if (m_share) {
+            CURLSHcode rc = curl_share_cleanup(m_share);
+            if (rc != CURLSHE_OK) {
+                std::cerr << "HTTPContext::cleanup WARNING: curl_share_cleanup failed: " << curl_share_strerror(rc)
+                          << std::endl;
+            }
+            m_share = nullptr;
+        }
+
+        curl_global_cleanup();
+        m_initialized = false;
+    }
+
+    CURLSH *HTTPContext::getShareHandle() {
+        initialize();
+
+        return m_share;
+    }
+
+    /**
+     * Creates a new libcURL easy handle attached to the shared context.
+     *
+     * @return  Easy handle (caller owns it and must curl_easy_cleanup it) or nullptr on failure.
+     */
+    CURL *HTTPContext::createEasyHandle() {
+        initialize();
+
+        CURL *curl = curl_easy_init();
+        if (curl) {
+            attachEasyHandle(curl);
+        }
+
+        return curl;
+    }
+
+    /**
+     * (Re-)attaches an easy handle to the share object, e.g. after curl_easy_reset().
+     *
+     * @param t_curl    libcURL easy handle.
+     */
+    void HTTPContext::attachEasyHandle(CURL *t_curl) {
+        if (m_share) {
+            curl_easy_setopt(t_curl, CURLOPT_SHARE, m_share);
+        }
+    }
+
+    /**
+     * CURLSHOPT_LOCKFUNC: one mutex per shared data type, so DNS lookups don't wait on TLS session updates.
+     */
+    void HTTPContext::lockCallback(CURL */*t_handle*/, curl_lock_data t_data, curl_lock_access /*t_access*/,
+                                   void */*t_userptr*/) {
+        m_locks[t_data].lock();
+    }
+
+    void HTTPContext::unlockCallback(CURL */*t_handle*/, curl_lock_data t_data, void */*t_userptr*/) {
+        m_locks[t_data].unlock();
+    }
+} // namespace sane
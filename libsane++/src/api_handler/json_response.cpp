@@ -2,6 +2,8 @@
 #include <iostream>
 #include <string>
 #include <list>
+#include <vector>
+#include <algorithm>
 
 // 3rd party libraries.
 #include <nlohmann/json.hpp>
@@ -43,6 +45,48 @@ namespace sane {
         return compiledString;
     }
 
+    /**
+     * Puts an URL's query parameters in a canonical (sorted) order.
+     *
+     * Parameters come from std::maps, but may be split across several of them (filter and optional parameters),
+     * so the same request may be compiled into differently ordered URLs.
+     *
+     * @param t_url Full request URL.
+     * @return      URL with its query parameters sorted by name (parameters with the same name keep their order).
+     */
+    std::string APIHandler::normalizeRequestUrl(const std::string &t_url) {
+        size_t queryStart = t_url.find('?');
+        if (queryStart == std::string::npos) {
+            return t_url;
+        }
+
+        std::vector<std::string> parameters;
+        size_t start = queryStart + 1;
+        while (start <= t_url.size()) {
+            size_t end = t_url.find('&', start);
+            if (end == std::string::npos) {
+                end = t_url.size();
+            }
+            if (end > start) {
+                parameters.push_back(t_url.substr(start, end - start));
+            }
+            start = end + 1;
+        }
+
+        std::stable_sort(parameters.begin(), parameters.end(), [](const std::string &a, const std::string &b) {
+            return a.substr(0, a.find('=')) < b.substr(0, b.find('='));
+        });
+
+        std::string normalized = t_url.substr(0, queryStart);
+        std::string separator = "?";
+        for (const auto &parameter : parameters) {
+            normalized += separator + parameter;
+            separator = "&";
+        }
+
+        return normalized;
+    }
+
     /**
      * Takes a list of variable values and compiles them into a HTTP string.
      *
@@ -414,4 +458,82 @@ namespace sane {
 
         return jsonData;
     }
+
+    /**
+     * Like youtubeListVideos, but returns the raw response body for the caller to parse.
+     */
+    std::shared_ptr<const std::string> APIHandler::youtubeListVideosBody(const std::string &t_part,
+                                                                         const std::map<std::string, std::string> &t_filter,
+                                                                         const std::map<std::string, std::string> &t_optParams) {
+        // Setup
+        std::list<std::map<std::string, std::string>> varMaps;
+        std::string compiledVariables;
+
+        // 'part' is a required first part of a YouTube API HTTP string.
+        compiledVariables += "?part=" + t_part;
+
+        // Append filter and optional parameters.
+        varMaps.push_back(t_filter);
+        varMaps.push_back(t_optParams);
+        compiledVariables += compileUrlVariables(varMaps);
+
+        return getSharedOAuth2ResponseBody(YOUTUBE_API_VIDEOS + compiledVariables);
+    }
+#ifdef SANE_ENABLE_COROUTINES
+    /**
+     * Awaitable list() request against any YouTube API endpoint.
+     *
+     * @param t_loop        Event loop to run the request on.
+     * @param t_endpoint    Endpoint URL, e.g. YOUTUBE_API_VIDEOS.
+     * @param t_part        Part(s) to request.
+     * @param t_filter      Filter.
+     * @param t_optParams   Optional parameters.
+     * @return              Response parsed as JSON, an empty object if the request failed.
+     */
+    Task<nlohmann::json> APIHandler::youtubeListAsync(EventLoop &t_loop, std::string t_endpoint, std::string t_part,
+                                                      std::map<std::string, std::string> t_filter,
+                                                      std::map<std::string, std::string> t_optParams) {
+        // Setup
+        std::list<std::map<std::string, std::string>> varMaps;
+        std::string compiledVariables;
+
+        // 'part' is a required first part of a YouTube API HTTP string.
+        compiledVariables += "?part=" + t_part;
+
+        // Append filter and optional parameters.
+        varMaps.push_back(t_filter);
+        varMaps.push_back(t_optParams);
+        compiledVariables += compileUrlVariables(varMaps);
+
+        co_return co_await getOAuth2ResponseAsync(t_loop, t_endpoint + compiledVariables);
+    }
+
+    Task<nlohmann::json> APIHandler::youtubeListChannelsAsync(EventLoop &t_loop, std::string t_part,
+                                                              std::map<std::string, std::string> t_filter,
+                                                              std::map<std::string, std::string> t_optParams) {
+        return youtubeListAsync(t_loop, YOUTUBE_API_CHANNELS, std::move(t_part), std::move(t_filter),
+                                std::move(t_optParams));
+    }
+
+    Task<nlohmann::json> APIHandler::youtubeListPlaylistItemsAsync(EventLoop &t_loop, std::string t_part,
+                                                                   std::map<std::string, std::string> t_filter,
+                                                                   std::map<std::string, std::string> t_optParams) {
+        return youtubeListAsync(t_loop, YOUTUBE_API_PLAYLIST_ITEMS, std::move(t_part), std::move(t_filter),
+                                std::move(t_optParams));
+    }
+
+    Task<nlohmann::json> APIHandler::youtubeListSubscriptionsAsync(EventLoop &t_loop, std::string t_part,
+                                                                   std::map<std::string, std::string> t_filter,
+                                                                   std::map<std::string, std::string> t_optParams) {
+        return youtubeListAsync(t_loop, YOUTUBE_API_SUBSCRIPTIONS, std::move(t_part), std::move(t_filter),
+                                std::move(t_optParams));
+    }
+
+    Task<nlohmann::json> APIHandler::youtubeListVideosAsync(EventLoop &t_loop, std::string t_part,
+                                                            std::map<std::string, std::string> t_filter,
+                                                            std::map<std::string, std::string> t_optParams) {
+        return youtubeListAsync(t_loop, YOUTUBE_API_VIDEOS, std::move(t_part), std::move(t_filter),
+                                std::move(t_optParams));
+    }
+#endif // SANE_ENABLE_COROUTINES
 } // namespace sane
\ No newline at end of file
@@ -0,0 +1,422 @@
+#include <iostream>
+#include <list>
+#include <atomic>
+#include <algorithm>
+
+#include <api_handler/quota.hpp>
+#include <config_handler/config_handler.hpp>
+#include <db_handler/db_quota_ledger.hpp>
+
+namespace sane {
+    /**
+     * Quota units charged for a single read (list/get) call, per API resource.
+     *
+     * Anything not listed here costs 1 unit, see https://developers.google.com/youtube/v3/determine_quota_cost
+     */
+    static const std::map<std::string, long> quotaCosts = {
+            {"captions",                        50},
+            {"search",                          100},
+            {"channelBanners/insert",           50},
+            {"comments/markAsSpam",             50},
+            {"comments/setModerationStatus",    50},
+            {"videos/rate",                     50},
+            {"videos/reportAbuse",              50},
+    };
+
+    /**
+     * Units and requests charged to an endpoint, but not yet written to the ledger in the DB.
+     */
+    struct ledgerEntry_t {
+        long units{};
+        long requests{};
+    };
+
+    static std::mutex ledgerMutex;
+    static std::string ledgerDay;
+    static std::map<std::string, long> usageToday;
+    static std::map<std::string, std::map<std::string, ledgerEntry_t>> pendingUsage;
+
+    QuotaBucket::QuotaBucket(double t_capacity, double t_refillPerSecond) {
+        m_capacity = t_capacity;
+        m_refillPerSecond = t_refillPerSecond;
+        m_tokens = t_capacity;
+        m_lastRefill = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * Adds the tokens accumulated since the last refill, caller must hold m_mutex.
+     */
+    void QuotaBucket::refill() {
+        auto now = std::chrono::steady_clock::now();
+        double elapsedSeconds = std::chrono::duration<double>(now - m_lastRefill).count();
+
+        m_tokens = std::min(m_capacity, m_tokens + elapsedSeconds * m_refillPerSecond);
+        m_lastRefill = now;
+    }
+
+    /**
+     * Takes units out of the bucket if they are available right now.
+     *
+     * @param t_units   Quota units to take.
+     * @return          true if the units were taken.
+     */
+    bool QuotaBucket::tryAcquire(long t_units) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_refillPerSecond <= 0) {
+            return true;
+        }
+
+        refill();
+
+        // A cost larger than the bucket can ever hold is let through once the bucket is full, putting it in debt.
+        if (m_tokens < std::min((double)t_units, m_capacity)) {
+            return false;
+        }
+        m_tokens -= (double)t_units;
+
+        return true;
+    }
+
+    /**
+     * Takes units out of the bucket, waiting for them to be refilled if need be.
+     *
+     * @param t_units   Quota units to take.
+     * @param t_context Gives up waiting if cancelled, or if the units won't be available before the deadline.
+     * @return          true if the units were taken.
+     */
+    bool QuotaBucket::acquire(long t_units, const requestContext_t &t_context) {
+        while (!tryAcquire(t_units)) {
+            long waitMs;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                refill();
+                double missing = std::min((double)t_units, m_capacity) - m_tokens;
+                waitMs = std::max(1L, (long)(missing / m_refillPerSecond * 1000.0 + 0.5));
+            }
+
+            if (!t_context.sleepFor(std::chrono::milliseconds(waitMs))) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    double QuotaBucket::getAvailable() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        refill();
+
+        return m_tokens;
+    }
+
+    /**
+     * Extracts the API resource an URL refers to.
+     *
+     * @param t_url Full request URL.
+     * @return      E.g. "playlistItems" or "videos/rate", empty if it is not a YouTube Data API URL.
+     */
+    std::string getQuotaEndpoint(const std::string &t_url) {
+        const std::string apiRoot = "/youtube/v3/";
+
+        size_t start = t_url.find(apiRoot);
+        if (start == std::string::npos) {
+            return std::string();
+        }
+        start += apiRoot.size();
+
+        return t_url.substr(start, t_url.find('?', start) - start);
+    }
+
+    /**
+     * Looks up how many quota units a (GET) request to an URL costs.
+     *
+     * @param t_url Full request URL (or just the endpoint).
+     * @return      Quota units, 0 for URLs outside of the YouTube Data API.
+     */
+    long getQuotaCost(const std::string &t_url) {
+        std::string endpoint = getQuotaEndpoint(t_url);
+
+        if (endpoint.empty()) {
+            return 0;
+        }
+
+        auto cost = quotaCosts.find(endpoint);
+
+        return cost != quotaCosts.end() ? cost->second : 1;
+    }
+
+    /**
+     * Returns the quota day a point in time belongs to.
+     *
+     * @param t_time    Seconds since epoch.
+     * @return          Date on "YYYY-MM-DD" form, in Pacific Time.
+     */
+    std::string getQuotaDay(std::time_t t_time) {
+        std::time_t shifted = t_time + QUOTA_RESET_UTC_OFFSET_HOURS * 3600;
+        std::tm tm{};
+        char buffer[11];
+
+        gmtime_r(&shifted, &tm);
+        std::strftime(buffer, sizeof(buffer), "%Y-%m-%d", &tm);
+
+        return std::string(buffer);
+    }
+
+    /**
+     * Reads the quota settings from config, once.
+     *
+     * @return Settings, with defaults for anything that isn't configured.
+     */
+    quotaSettings_t getQuotaSettings() {
+        static std::once_flag loaded;
+        static quotaSettings_t settings;
+
+        std::call_once(loaded, []() {
+            std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+
+            settings.dailyLimit = cfg->getLongInt("quota/daily_limit", QUOTA_DEFAULT_DAILY_LIMIT);
+            settings.bucketCapacity = cfg->getInt("quota/bucket_capacity", QUOTA_DEFAULT_BUCKET_CAPACITY);
+            settings.refillPerSecond = cfg->getInt("quota/refill_per_second", QUOTA_DEFAULT_REFILL_PER_SECOND);
+        });
+
+        return settings;
+    }
+
+    /**
+     * The token bucket shared by every APIHandler in the process.
+     */
+    static QuotaBucket &getProcessQuotaBucket() {
+        static QuotaBucket bucket(getQuotaSettings().bucketCapacity, getQuotaSettings().refillPerSecond);
+
+        return bucket;
+    }
+
+    /**
+     * Makes sure usageToday is for the current quota day, loading it from the ledger on rollover.
+     *
+     * Caller must hold ledgerMutex.
+     */
+    static void syncLedgerDay() {
+        std::string today = getQuotaDay(std::time(nullptr));
+
+        if (today != ledgerDay) {
+            std::list<std::string> errors;
+
+            usageToday = getQuotaUsageFromDB(today, &errors);
+            ledgerDay = today;
+        }
+    }
+
+    /**
+     * Charges units to today's ledger, unless that would exceed the daily limit.
+     *
+     * @param t_endpoint    API resource.
+     * @param t_units       Quota units.
+     * @param t_dailyLimit  Daily limit, 0 for no limit.
+     * @param t_chargedDay  Set to the quota day the units were charged to, for refundDailyQuota.
+     * @return              true if the units were charged.
+     */
+    static bool reserveDailyQuota(const std::string &t_endpoint, long t_units, long t_dailyLimit,
+                                  std::string &t_chargedDay) {
+        std::lock_guard<std::mutex> lock(ledgerMutex);
+
+        syncLedgerDay();
+
+        if (t_dailyLimit > 0) {
+            long used = 0;
+            for (const auto &usage : usageToday) {
+                used += usage.second;
+            }
+
+            if (used + t_units > t_dailyLimit) {
+                return false;
+            }
+        }
+
+        usageToday[t_endpoint] += t_units;
+        ledgerEntry_t &pending = pendingUsage[ledgerDay][t_endpoint];
+        pending.units += t_units;
+        pending.requests++;
+        t_chargedDay = ledgerDay;
+
+        return true;
+    }
+
+    /**
+     * Takes back units charged by reserveDailyQuota for a request that was never sent.
+     *
+     * Waiting on the token bucket may well cross midnight Pacific Time, so the refund goes to the day that was
+     * charged: today's usage is left alone once the day has rolled over, only the old day's ledger is credited.
+     *
+     * @param t_endpoint    API resource.
+     * @param t_units       Quota units.
+     * @param t_chargedDay  Quota day reserveDailyQuota charged the units to.
+     */
+    static void refundDailyQuota(const std::string &t_endpoint, long t_units, const std::string &t_chargedDay) {
+        std::lock_guard<std::mutex> lock(ledgerMutex);
+
+        if (t_chargedDay == ledgerDay) {
+            usageToday[t_endpoint] -= t_units;
+        }
+
+        // Negative if the charge was already flushed, which the ledger's UPSERT then subtracts.
+        ledgerEntry_t &pending = pendingUsage[t_chargedDay][t_endpoint];
+        pending.units -= t_units;
+        pending.requests--;
+    }
+
+    /**
+     * Charges a request against the daily budget and waits for the token bucket to allow it.
+     *
+     * @param t_url     Full request URL.
+     * @param t_context Gives up waiting if cancelled or out of time.
+     * @return          true if the request may be sent, false if the daily budget is spent or waiting was aborted.
+     */
+    bool acquireQuota(const std::string &t_url, const requestContext_t &t_context) {
+        static std::atomic<bool> warned{false};
+
+        long cost = getQuotaCost(t_url);
+        if (cost == 0) {
+            return true;
+        }
+
+        quotaSettings_t settings = getQuotaSettings();
+        std::string endpoint = getQuotaEndpoint(t_url);
+        std::string chargedDay;
+
+        if (!reserveDailyQuota(endpoint, cost, settings.dailyLimit, chargedDay)) {
+            // Every worker would otherwise say the same thing.
+            if (!warned.exchange(true)) {
+                std::cerr << "acquireQuota: Daily quota budget of " << settings.dailyLimit << " units is spent, "
+                          << "no more requests will be made until it resets at midnight Pacific Time." << std::endl;
+            }
+            return false;
+        }
+
+        if (!getProcessQuotaBucket().acquire(cost, t_context)) {
+            refundDailyQuota(endpoint, cost, chargedDay);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Like acquireQuota, but never waits on the token bucket (for optional requests, such as hedges).
+     *
+     * @param t_url Full request URL.
+     * @return      true if the request may be sent.
+     */
+    bool tryAcquireQuota(const std::string &t_url) {
+        long cost = getQuotaCost(t_url);
+        if (cost == 0) {
+            return true;
+        }
+
+        std::string endpoint = getQuotaEndpoint(t_url);
+        std::string chargedDay;
+
+        if (!reserveDailyQuota(endpoint, cost, getQuotaSettings().dailyLimit, chargedDay)) {
+            return false;
+        }
+
+        if (!getProcessQuotaBucket().tryAcquire(cost)) {
+            refundDailyQuota(endpoint, cost, chargedDay);
+            return false;
+        }
+
+        return true;
+    }
+
+    long getQuotaUsedToday() {
+        long used = 0;
+
+        for (const auto &usage : getQuotaUsageToday()) {
+            used += usage.second;
+        }
+
+        return used;
+    }
+
+    /**
+     * Quota units left of today's budget.
+     *
+     * @return  Units left (0 if spent), or -1 if there is no daily limit.
+     */
+    long getRemainingQuota() {
+        long dailyLimit = getQuotaSettings().dailyLimit;
+
+        if (dailyLimit <= 0) {
+            return -1;
+        }
+
+        return std::max(0L, dailyLimit - getQuotaUsedToday());
+    }
+
+    /**
+     * Returns today's quota usage, both what's in the ledger and what this process has spent since.
+     *
+     * @return Map of <endpoint, quota units>.
+     */
+    std::map<std::string, long> getQuotaUsageToday() {
+        std::lock_guard<std::mutex> lock(ledgerMutex);
+
+        syncLedgerDay();
+
+        return usageToday;
+    }
+
+    /**
+     * Writes the usage charged since the last flush to the ledger in the DB.
+     *
+     * Requests run on worker threads, so they only update the in-memory counters, this is meant to be called
+     * from the main thread once they are done (e.g. after a refresh, and on exit).
+     *
+     * @return  true if everything was written, whatever wasn't is kept for the next flush.
+     */
+    bool flushQuotaLedger() {
+        std::map<std::string, std::map<std::string, ledgerEntry_t>> flushing;
+        std::map<std::string, std::map<std::string, ledgerEntry_t>> unwritten;
+        {
+            std::lock_guard<std::mutex> lock(ledgerMutex);
+            flushing.swap(pendingUsage);
+        }
+
+        for (const auto &day : flushing) {
+            for (const auto &entry : day.second) {
+                // A refund of an already flushed charge is written as a negative adjustment.
+                if (entry.second.units == 0 and entry.second.requests == 0) {
+                    continue;
+                }
+
+                // One endpoint at a time, so that it is known exactly what did (not) make it to the DB.
+                std::list<std::string> errors;
+                if (addQuotaUsageToDB(day.first, {{entry.first, entry.second.units}},
+                                      {{entry.first, entry.second.requests}}, &errors) != SQLITE_OK) {
+                    unwritten[day.first][entry.first] = entry.second;
+                }
+            }
+        }
+
+        if (unwritten.empty()) {
+            return true;
+        }
+
+        std::cerr << "flushQuotaLedger ERROR: Unable to write quota usage to the DB, will retry on the next flush."
+                  << std::endl;
+
+        // Anything charged while flushing has been added to pendingUsage meanwhile.
+        std::lock_guard<std::mutex> lock(ledgerMutex);
+        for (const auto &day : unwritten) {
+            for (const auto &entry : day.second) {
+                ledgerEntry_t &pending = pendingUsage[day.first][entry.first];
+                pending.units += entry.second.units;
+                pending.requests += entry.second.requests;
+            }
+        }
+
+        return false;
+    }
+} // namespace sane
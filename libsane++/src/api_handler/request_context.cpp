@@ -0,0 +1,97 @@
+#include <thread>
+#include <algorithm>
+
+#include <api_handler/request_context.hpp>
+
+namespace sane {
+    void CancellationToken::cancel() {
+        m_cancelled.store(true, std::memory_order_release);
+    }
+
+    bool CancellationToken::isCancelled() const {
+        return m_cancelled.load(std::memory_order_acquire);
+    }
+
+    bool requestContext_t::hasDeadline() const {
+        return deadline != std::chrono::steady_clock::time_point::max();
+    }
+
+    bool requestContext_t::isExpired() const {
+        return hasDeadline() and std::chrono::steady_clock::now() >= deadline;
+    }
+
+    bool requestContext_t::isCancelled() const {
+        return cancellationToken and cancellationToken->isCancelled();
+    }
+
+    /**
+     * Whether a request running under this context should stop (or never start).
+     *
+     * @return  true if cancelled or past the deadline.
+     */
+    bool requestContext_t::shouldAbort() const {
+        return isCancelled() or isExpired();
+    }
+
+    /**
+     * Time left until the deadline.
+     *
+     * @return  Milliseconds left (0 if expired), or -1 if there is no deadline.
+     */
+    long requestContext_t::remainingMilliseconds() const {
+        if (!hasDeadline()) {
+            return -1;
+        }
+
+        auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now()).count();
+
+        return remaining > 0 ? (long)remaining : 0;
+    }
+
+    /**
+     * Sleeps (e.g. for a retry backoff) while staying responsive to cancellation.
+     *
+     * @param t_duration    How long to sleep.
+     * @return              false if the sleep was cut short by cancellation, or would run past the deadline.
+     */
+    bool requestContext_t::sleepFor(std::chrono::milliseconds t_duration) const {
+        // Waking up after the deadline is pointless, so don't even start.
+        if (hasDeadline() and std::chrono::steady_clock::now() + t_duration >= deadline) {
+            return false;
+        }
+
+        const auto wakeUp = std::chrono::steady_clock::now() + t_duration;
+        const auto slice = std::chrono::milliseconds(50);
+
+        while (std::chrono::steady_clock::now() < wakeUp) {
+            if (isCancelled()) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                    slice, wakeUp - std::chrono::steady_clock::now()));
+        }
+
+        return !shouldAbort();
+    }
+
+    /**
+     * Creates a context that expires t_budget from now.
+     *
+     * @param t_budget              Time budget, zero or negative means no deadline.
+     * @param t_cancellationToken   Token to share with the caller, a fresh one is created if none is given.
+     * @return                      requestContext_t
+     */
+    requestContext_t makeRequestContext(std::chrono::milliseconds t_budget,
+                                        std::shared_ptr<CancellationToken> t_cancellationToken) {
+        requestContext_t context;
+
+        if (t_budget.count() > 0) {
+            context.deadline = std::chrono::steady_clock::now() + t_budget;
+        }
+
+        context.cancellationToken = t_cancellationToken ? t_cancellationToken : std::make_shared<CancellationToken>();
+
+        return context;
+    }
+} // namespace sane
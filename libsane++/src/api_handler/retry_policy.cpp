@@ -0,0 +1,130 @@
+#include <algorithm>
+
+#include <nlohmann/json.hpp>
+
+#include <api_handler/retry_policy.hpp>
+
+namespace sane {
+    /**
+     * Extracts the machine readable reason from a Google API error response.
+     *
+     * Error bodies look like: {"error": {"code": 403, "errors": [{"reason": "quotaExceeded", ...}], ...}}
+     *
+     * @param t_responseBody    Raw response body.
+     * @return                  Reason of the first error, or empty string if there is none.
+     */
+    std::string getApiErrorReason(const std::string &t_responseBody) {
+        nlohmann::json body = nlohmann::json::parse(t_responseBody, nullptr, false);
+
+        if (body.is_object() and body.find("error") != body.end() and body["error"].is_object()) {
+            const nlohmann::json &error = body["error"];
+
+            if (error.find("errors") != error.end() and error["errors"].is_array() and !error["errors"].empty()) {
+                const nlohmann::json &firstError = error["errors"][0];
+
+                if (firstError.find("reason") != firstError.end() and firstError["reason"].is_string()) {
+                    return firstError["reason"].get<std::string>();
+                }
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * Classifies the outcome of a request.
+     *
+     * Google reports both quota and rate limit errors as 403 (sometimes 429), so the reason in the
+     * body is what tells "come back tomorrow" apart from "come back in a second".
+     *
+     * @param t_result          libcURL result of the transfer.
+     * @param t_responseCode    HTTP status code (only meaningful if t_result is CURLE_OK).
+     * @param t_responseBody    Raw response body.
+     * @return                  FailureKind
+     */
+    FailureKind classifyFailure(CURLcode t_result, long t_responseCode, const std::string &t_responseBody) {
+        if (t_result == CURLE_ABORTED_BY_CALLBACK) {
+            // Cancelled or out of time, retrying would defeat the purpose.
+            return FailureKind::Fatal;
+        } else if (t_result != CURLE_OK) {
+            return FailureKind::Transient;
+        }
+
+        if (t_responseCode == 200) {
+            return FailureKind::None;
+        }
+
+        const std::string reason = getApiErrorReason(t_responseBody);
+
+        if (reason == "quotaExceeded" or reason == "dailyLimitExceeded") {
+            return FailureKind::QuotaExceeded;
+        } else if (reason == "rateLimitExceeded" or reason == "userRateLimitExceeded" or t_responseCode == 429) {
+            return FailureKind::RateLimited;
+        } else if (t_responseCode >= 500 or t_responseCode == 408) {
+            return FailureKind::Transient;
+        }
+
+        return FailureKind::Fatal;
+    }
+
+    bool isRetryable(FailureKind t_kind) {
+        return t_kind == FailureKind::Transient or t_kind == FailureKind::RateLimited;
+    }
+
+    const char *failureKindToString(FailureKind t_kind) {
+        switch (t_kind) {
+            case FailureKind::None:
+                return "none";
+            case FailureKind::Transient:
+                return "transient";
+            case FailureKind::RateLimited:
+                return "rate limited";
+            case FailureKind::QuotaExceeded:
+                return "quota exceeded";
+            case FailureKind::Fatal:
+                return "fatal";
+            case FailureKind::CircuitOpen:
+                return "circuit open";
+        }
+
+        return "unknown";
+    }
+
+    /**
+     * Exponential backoff with full jitter: a uniformly random delay in [0, min(max, base * 2^attempt)].
+     *
+     * Full jitter spreads out the retries of many concurrent workers hitting the same error,
+     * instead of having them all come back in lockstep.
+     *
+     * @param t_policy  Retry policy.
+     * @param t_attempt Zero-based number of the attempt that just failed.
+     * @param t_rng     Random number generator.
+     * @return          Delay in milliseconds.
+     */
+    long computeBackoffMs(const retryPolicy_t &t_policy, int t_attempt, std::mt19937 &t_rng) {
+        long ceiling = t_policy.baseDelayMs;
+        for (int i = 0; i < t_attempt and ceiling < t_policy.maxDelayMs; i++) {
+            ceiling *= 2;
+        }
+        ceiling = std::min(ceiling, t_policy.maxDelayMs);
+
+        std::uniform_int_distribution<long> distribution(0, std::max(ceiling, 0L));
+
+        return distribution(t_rng);
+    }
+
+    /**
+     * How long to wait before a retry the server asked to be held off with Retry-After.
+     *
+     * @param t_policy              Retry policy, its maxDelayMs is the longest wait that is worth it.
+     * @param t_retryAfterSeconds   Retry-After sent by the server (seconds).
+     * @return                      Delay in milliseconds, or -1 if the server asked for longer than that.
+     */
+    long computeRetryAfterMs(const retryPolicy_t &t_policy, long t_retryAfterSeconds) {
+        if (t_retryAfterSeconds > t_policy.maxDelayMs / 1000) {
+            return -1;
+        }
+
+        return std::min(t_retryAfterSeconds * 1000, t_policy.maxDelayMs);
+    }
+} // namespace sane
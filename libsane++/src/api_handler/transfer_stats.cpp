@@ -0,0 +1,54 @@
+#include <mutex>
+
+#include <api_handler/transfer_stats.hpp>
+
+namespace sane {
+    static std::mutex transferStatsMutex;
+    static std::map<std::string, transferStats_t> transferStats;
+
+    /**
+     * Strips the query string off an URL, leaving the endpoint route it was sent to.
+     *
+     * @param t_url Full request URL.
+     * @return      URL up to (but not including) the first '?'.
+     */
+    std::string getEndpointFromUrl(const std::string &t_url) {
+        return t_url.substr(0, t_url.find('?'));
+    }
+
+    /**
+     * Adds a finished transfer to the per-endpoint byte counters.
+     *
+     * Called from worker threads, so access is serialised.
+     *
+     * @param t_url             Full request URL (query string is ignored).
+     * @param t_wireBytes       Bytes received on the wire (CURLINFO_SIZE_DOWNLOAD_T).
+     * @param t_decodedBytes    Bytes delivered to the write callback after decompression.
+     */
+    void recordTransfer(const std::string &t_url, unsigned long long t_wireBytes,
+                        unsigned long long t_decodedBytes) {
+        std::lock_guard<std::mutex> lock(transferStatsMutex);
+
+        transferStats_t &stats = transferStats[getEndpointFromUrl(t_url)];
+        stats.requests++;
+        stats.wireBytes += t_wireBytes;
+        stats.decodedBytes += t_decodedBytes;
+    }
+
+    /**
+     * Returns a snapshot of the per-endpoint byte counters.
+     *
+     * @return Map of <endpoint URL, counters>.
+     */
+    std::map<std::string, transferStats_t> getTransferStats() {
+        std::lock_guard<std::mutex> lock(transferStatsMutex);
+
+        return transferStats;
+    }
+
+    void resetTransferStats() {
+        std::lock_guard<std::mutex> lock(transferStatsMutex);
+
+        transferStats.clear();
+    }
+} // namespace sane
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <cmath>
+
+#include <concurrency/aimd_limiter.hpp>
+
+namespace sane {
+    /**
+     * @param t_initialLimit        Concurrency to start out with.
+     * @param t_minLimit            Never go below this (at least 1).
+     * @param t_maxLimit            Never go above this.
+     * @param t_decreaseFactor      Limit is multiplied by this on overload, in the range (0, 1).
+     * @param t_latencyTolerance    Latency above baseline * tolerance counts as overload.
+     */
+    AIMDLimiter::AIMDLimiter(int t_initialLimit, int t_minLimit, int t_maxLimit, double t_decreaseFactor,
+                             double t_latencyTolerance) {
+        m_minLimit = std::max(t_minLimit, 1);
+        m_maxLimit = std::max(t_maxLimit, m_minLimit);
+        m_limit = std::min(std::max(t_initialLimit, m_minLimit), m_maxLimit);
+        m_peakLimit = (int)m_limit;
+        m_decreaseFactor = (t_decreaseFactor > 0.0 and t_decreaseFactor < 1.0) ? t_decreaseFactor
+                                                                                 : AIMD_DEFAULT_DECREASE_FACTOR;
+        m_latencyTolerance = t_latencyTolerance > 1.0 ? t_latencyTolerance : AIMD_DEFAULT_LATENCY_TOLERANCE;
+    }
+
+    int AIMDLimiter::getLimit() const {
+        return (int)m_limit;
+    }
+
+    int AIMDLimiter::getPeakLimit() const {
+        return m_peakLimit;
+    }
+
+    size_t AIMDLimiter::getDecreaseCount() const {
+        return m_decreaseCount;
+    }
+
+    /**
+     * @return  Lowest latency observed (ms), or -1 if no successes have been recorded yet.
+     */
+    long AIMDLimiter::getBaselineLatency() const {
+        return m_baselineLatencyMs;
+    }
+
+    /**
+     * Registers a successfully completed task.
+     *
+     * @param t_latencyMs   How long it took, negative if unknown (e.g. it was answered without a round trip).
+     */
+    void AIMDLimiter::onSuccess(long t_latencyMs) {
+        tick();
+
+        if (t_latencyMs >= 0 and (m_baselineLatencyMs < 0 or t_latencyMs < m_baselineLatencyMs)) {
+            m_baselineLatencyMs = t_latencyMs;
+        }
+
+        // Latency spike: requests are queueing up somewhere, treat it like an explicit overload.
+        if (t_latencyMs >= 0 and m_baselineLatencyMs > 0
+            and (double)t_latencyMs > (double)m_baselineLatencyMs * m_latencyTolerance) {
+            decrease();
+            return;
+        }
+
+        if (m_slowStart) {
+            m_limit += 1.0;
+        } else {
+            // +1 for every getLimit() successes, i.e. roughly +1 per round of requests.
+            m_limit += 1.0 / m_limit;
+        }
+
+        m_limit = std::min(m_limit, (double)m_maxLimit);
+        m_peakLimit = std::max(m_peakLimit, (int)m_limit);
+    }
+
+    /**
+     * Registers a task that was rate limited or hit a server error.
+     */
+    void AIMDLimiter::onOverload() {
+        tick();
+        decrease();
+    }
+
+    void AIMDLimiter::onResult(long t_latencyMs, bool t_overloaded) {
+        if (t_overloaded) {
+            onOverload();
+        } else {
+            onSuccess(t_latencyMs);
+        }
+    }
+
+    /**
+     * Multiplicative decrease.
+     *
+     * Tasks already in flight when the limit was cut will report the same congestion,
+     * so further decreases are held off until a round's worth of tasks have completed.
+     */
+    void AIMDLimiter::decrease() {
+        m_slowStart = false;
+
+        if (m_decreaseCooldown > 0) {
+            return;
+        }
+
+        m_decreaseCooldown = (int)m_limit;
+        m_limit = std::max(std::floor(m_limit * m_decreaseFactor), (double)m_minLimit);
+        m_decreaseCount++;
+    }
+
+    /**
+     * Counts down the decrease cooldown, once per completed task.
+     */
+    void AIMDLimiter::tick() {
+        if (m_decreaseCooldown > 0) {
+            m_decreaseCooldown--;
+        }
+    }
+} // namespace sane
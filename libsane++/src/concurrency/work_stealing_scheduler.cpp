@@ -0,0 +1,198 @@
+#include <iostream>
+#include <random>
+#include <algorithm>
+
+#include <concurrency/work_stealing_scheduler.hpp>
+
+namespace sane {
+    // Which scheduler and worker (if any) the calling thread belongs to.
+    static thread_local const WorkStealingScheduler *currentScheduler = nullptr;
+    static thread_local size_t currentWorker = 0;
+
+    /**
+     * Starts the workers.
+     *
+     * @param t_workers Number of worker threads (at least 1).
+     */
+    WorkStealingScheduler::WorkStealingScheduler(size_t t_workers) {
+        size_t workers = std::max(t_workers, (size_t)1);
+
+        for (size_t i = 0; i < workers; i++) {
+            m_workers.push_back(std::make_unique<worker_t>());
+        }
+
+        for (size_t i = 0; i < workers; i++) {
+            m_threads.emplace_back(&WorkStealingScheduler::workerLoop, this, i);
+        }
+    }
+
+    /**
+     * Finishes every submitted task, then stops the workers.
+     */
+    WorkStealingScheduler::~WorkStealingScheduler() {
+        wait();
+
+        {
+            std::lock_guard<std::mutex> lock(m_idleMutex);
+            m_stopping.store(true);
+        }
+        m_wakeup.notify_all();
+
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    /**
+     * Schedules a task.
+     *
+     * Exceptions thrown by the task are reported and swallowed.
+     *
+     * @param t_task    Task, may itself submit more tasks.
+     */
+    void WorkStealingScheduler::submit(std::function<void()> t_task) {
+        size_t index = currentScheduler == this ? currentWorker
+                                                : m_nextWorker.fetch_add(1, std::memory_order_relaxed)
+                                                  % m_workers.size();
+
+        m_unfinished.fetch_add(1, std::memory_order_seq_cst);
+        // Counted before it is queued, so the count never runs behind a worker that pops it straight away.
+        m_queued.fetch_add(1, std::memory_order_seq_cst);
+
+        {
+            std::lock_guard<std::mutex> lock(m_workers[index]->mutex);
+            m_workers[index]->tasks.push_back(std::move(t_task));
+        }
+
+        // Pairs with workerLoop: either an idle worker sees the task counted, or we see it going to sleep.
+        if (m_sleeping.load(std::memory_order_seq_cst) > 0) {
+            std::lock_guard<std::mutex> lock(m_idleMutex);
+            m_wakeup.notify_one();
+        }
+    }
+
+    /**
+     * Blocks until every submitted task (including tasks they submitted) has finished.
+     *
+     * Must not be called from within a task.
+     */
+    void WorkStealingScheduler::wait() {
+        std::unique_lock<std::mutex> lock(m_doneMutex);
+
+        m_done.wait(lock, [this]() { return m_unfinished.load() == 0; });
+    }
+
+    size_t WorkStealingScheduler::getWorkerCount() const {
+        return m_workers.size();
+    }
+
+    unsigned long WorkStealingScheduler::getExecutedCount() const {
+        return m_executed.load();
+    }
+
+    /**
+     * @return  Number of tasks that were run by another worker than the one they were queued on.
+     */
+    unsigned long WorkStealingScheduler::getStolenCount() const {
+        return m_stolen.load();
+    }
+
+    void WorkStealingScheduler::workerLoop(size_t t_index) {
+        currentScheduler = this;
+        currentWorker = t_index;
+
+        while (true) {
+            std::function<void()> task;
+
+            if (popLocal(t_index, task) or steal(t_index, task)) {
+                execute(task);
+                continue;
+            }
+
+            // Nothing to do anywhere, sleep until something is submitted.
+            std::unique_lock<std::mutex> lock(m_idleMutex);
+
+            m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+            m_wakeup.wait(lock, [this]() {
+                return m_stopping.load() or m_queued.load(std::memory_order_seq_cst) > 0;
+            });
+            m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+
+            if (m_stopping.load() and m_queued.load() == 0) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * Takes the newest task off a worker's own deque.
+     */
+    bool WorkStealingScheduler::popLocal(size_t t_index, std::function<void()> &t_task) {
+        worker_t &worker = *m_workers[t_index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        if (worker.tasks.empty()) {
+            return false;
+        }
+
+        t_task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        m_queued.fetch_sub(1);
+
+        return true;
+    }
+
+    /**
+     * Takes the oldest task off another worker's deque, trying every victim once starting at a random one.
+     */
+    bool WorkStealingScheduler::steal(size_t t_thief, std::function<void()> &t_task) {
+        static thread_local std::minstd_rand random(std::random_device{}());
+
+        size_t workers = m_workers.size();
+        if (workers < 2) {
+            return false;
+        }
+
+        size_t first = random() % workers;
+        for (size_t i = 0; i < workers; i++) {
+            size_t victimIndex = (first + i) % workers;
+            if (victimIndex == t_thief) {
+                continue;
+            }
+
+            worker_t &victim = *m_workers[victimIndex];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+
+            if (!victim.tasks.empty()) {
+                t_task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                m_queued.fetch_sub(1);
+                m_stolen.fetch_add(1, std::memory_order_relaxed);
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void WorkStealingScheduler::execute(std::function<void()> &t_task) {
+        try {
+            t_task();
+        } catch (const std::exception &exc) {
+            std::cerr << "WorkStealingScheduler: Unhandled exception in task: " << std::string(exc.what())
+                      << std::endl;
+        } catch (...) {
+            // Anything escaping the worker thread would terminate the process (and wait() would never return).
+            std::cerr << "WorkStealingScheduler: Unhandled non-standard exception in task!" << std::endl;
+        }
+
+        // Counted however the task ended.
+        m_executed.fetch_add(1, std::memory_order_relaxed);
+
+        if (m_unfinished.fetch_sub(1) == 1) {
+            std::lock_guard<std::mutex> lock(m_doneMutex);
+            m_done.notify_all();
+        }
+    }
+} // namespace sane
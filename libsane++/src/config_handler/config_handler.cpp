@@ -154,6 +154,25 @@ namespace sane {
         return retval;
     }
 
+    /**
+     * Read an optional config section and return its value as an int.
+     *
+     * Unlike getInt(const std::string&) a missing section is not an error, it silently yields the default.
+     *
+     * @param t_section String of path to JSON/config section.
+     * @param t_default Value to return if the section is missing or not a number.
+     * @return          Result or t_default.
+     */
+    int ConfigHandler::getInt(const std::string &t_section, int t_default) {
+        nlohmann::json section;
+
+        if (findSection(t_section, section) and section.is_number()) {
+            return section.get<int>();
+        }
+
+        return t_default;
+    }
+
     /**
      * Read a config section and return its value as a long int.
      *
@@ -178,6 +197,23 @@ namespace sane {
         return retval;
     }
 
+    /**
+     * Read an optional config section and return its value as a long int.
+     *
+     * @param t_section String of path to JSON/config section.
+     * @param t_default Value to return if the section is missing or not a number.
+     * @return          Result or t_default.
+     */
+    long int ConfigHandler::getLongInt(const std::string &t_section, long int t_default) {
+        nlohmann::json section;
+
+        if (findSection(t_section, section) and section.is_number()) {
+            return section.get<long int>();
+        }
+
+        return t_default;
+    }
+
     const std::list<std::string> ConfigHandler::getStringList(const std::string &t_section) {
         // Open config file.
         nlohmann::json config = getConfig();
@@ -187,4 +223,34 @@ namespace sane {
 
         return std::list<std::string>();
     }
+
+    /**
+     * Quietly looks up a config section, without the error reporting of hasSection.
+     *
+     * Used for optional settings, where a missing (or unreadable) config simply means "use the default".
+     *
+     * @param t_section String of path to JSON/config section.
+     * @param t_value   Set to the section's value if found.
+     * @return          true if the section exists.
+     */
+    bool ConfigHandler::findSection(const std::string &t_section, nlohmann::json &t_value) {
+        nlohmann::json valueJson;
+
+        try {
+            valueJson = getConfig();
+        } catch (nlohmann::detail::parse_error &) {
+            return false;
+        }
+
+        for (const auto& section : tokenize(t_section, SECTION_SEPARATOR)) {
+            if (!valueJson.is_object() or valueJson.find(section) == valueJson.end()) {
+                return false;
+            }
+            valueJson = valueJson[section];
+        }
+
+        t_value = valueJson;
+
+        return true;
+    }
 } // namespace sane
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <cstring>
+
+#include <db_handler/db_handler.hpp>
+#include <db_handler/db_quota_ledger.hpp>
+
+namespace sane {
+    /**
+     * Creates the YouTube API quota ledger table, if it doesn't already exist.
+     *
+     * Day is the quota day (YouTube resets quota at midnight Pacific Time), not the local calendar day.
+     *
+     * @param t_db  Database handle.
+     * @return      SQLITE_OK or the failing status.
+     */
+    int createQuotaLedgerTable(const std::shared_ptr<DBHandler> &t_db) {
+        return t_db->runSqlStatement("CREATE TABLE IF NOT EXISTS youtube_quota_ledger ("
+                                     "Day TEXT NOT NULL, "
+                                     "Endpoint TEXT NOT NULL, "
+                                     "Units INTEGER NOT NULL DEFAULT 0, "
+                                     "Requests INTEGER NOT NULL DEFAULT 0, "
+                                     "PRIMARY KEY (Day, Endpoint)"
+                                     ")");
+    }
+
+    /**
+     * Adds quota usage to the per-day, per-endpoint ledger in the SQLite3 Database.
+     *
+     * Conflict policy:     Accumulate.
+     *
+     * Conflict handling:   If an entry already exists the new units and requests are added to it.
+     *
+     * @param t_day         Quota day on "YYYY-MM-DD" form.
+     * @param t_usage       Map of <endpoint, quota units> to add.
+     * @param t_requests    Map of <endpoint, request count> to add.
+     * @param t_errors      Pointer to a string list to put errors in.
+     * @return              SQLITE_OK or the failing status.
+     */
+    int addQuotaUsageToDB(const std::string &t_day, const std::map<std::string, long> &t_usage,
+                          const std::map<std::string, long> &t_requests, std::list<std::string> *t_errors) {
+        // Setup
+        sqlite3_stmt *preparedStatement = nullptr;
+        std::string sqlStatement;
+
+        std::shared_ptr<DBHandler> db = std::make_shared<DBHandler>();
+
+        // Creates the table if it does not already exist.
+        createQuotaLedgerTable(db);
+
+        sqlStatement = std::string("INSERT INTO youtube_quota_ledger (Day, Endpoint, Units, Requests) "
+                                   "VALUES (?, ?, ?, ?) "
+                                   "ON CONFLICT(Day, Endpoint) DO UPDATE SET "
+                                   "Units=Units + excluded.Units, "
+                                   "Requests=Requests + excluded.Requests");
+
+        for (const auto &usage : t_usage) {
+            const char* day = t_day.c_str();
+            const char* endpoint = usage.first.c_str();
+            int units = (int)usage.second;
+            int requests = t_requests.find(usage.first) != t_requests.end() ? (int)t_requests.at(usage.first) : 0;
+
+            // Create a prepared statement
+            preparedStatement = db->prepareSqlStatement(sqlStatement);
+            if (db->lastStatus()  != SQLITE_OK) {
+                std::cerr << "sane::prepareSqlStatement(" << sqlStatement << ") ERROR: returned non-zero status: "
+                          << std::to_string( db->lastStatus() ) << std::endl;
+                t_errors->push_back("sane::prepareSqlStatement(" + sqlStatement + ") ERROR: returned non-zero status: "
+                                    + std::to_string( db->lastStatus() ));
+                return db->lastStatus();
+            }
+
+            //  Bind-parameter for VALUES (indexing is 1-based).
+            int rc = sqlite3_bind_text(preparedStatement, 1, day, strlen(day), nullptr);
+            db->checkRC(rc,             sqlStatement, 1, day, strlen(day), t_errors);
+            rc = sqlite3_bind_text(preparedStatement, 2, endpoint, strlen(endpoint), nullptr);
+            db->checkRC(rc,             sqlStatement, 2, endpoint, strlen(endpoint), t_errors);
+            rc = sqlite3_bind_int(preparedStatement,  3, units);
+            db->checkRC(rc,            sqlStatement,  3, units, t_errors);
+            rc = sqlite3_bind_int(preparedStatement,  4, requests);
+            db->checkRC(rc,            sqlStatement,  4, requests, t_errors);
+
+            // Step through, and do nothing, because this is an INSERT statement.
+            while ((rc = sqlite3_step(preparedStatement)) == SQLITE_ROW) {}
+            if (rc != SQLITE_DONE) {
+                // E.g. a locked database: the usage wasn't added, the caller has to hold on to it.
+                std::cerr << "sane::addQuotaUsageToDB(" << t_day << ", " << endpoint << ") ERROR: sqlite3_step "
+                          << "returned non-zero status: " << std::to_string(rc) << std::endl;
+                t_errors->push_back("sane::addQuotaUsageToDB(" + t_day + ", " + usage.first + ") ERROR: "
+                                    "sqlite3_step returned non-zero status: " + std::to_string(rc));
+                db->finalizePreparedSqlStatement(preparedStatement);
+
+                return rc;
+            }
+
+            // Clear and Reset the statement after each bind.
+            db->checkRC(sqlite3_clear_bindings(preparedStatement), "sqlite3_clear_bindings", sqlStatement, t_errors);
+            db->checkRC(sqlite3_reset(preparedStatement), "sqlite3_reset", sqlStatement, t_errors);
+
+            // Finalize prepared statement
+            db->finalizePreparedSqlStatement(preparedStatement);
+        }
+
+        return SQLITE_OK;
+    }
+
+    /**
+     * Reads a day's quota usage from the ledger.
+     *
+     * @param t_day     Quota day on "YYYY-MM-DD" form.
+     * @param t_errors  Pointer to a string list to put errors in.
+     * @return          Map of <endpoint, quota units>, empty if nothing has been recorded that day.
+     */
+    std::map<std::string, long> getQuotaUsageFromDB(const std::string &t_day, std::list<std::string> *t_errors) {
+        // Setup
+        sqlite3_stmt *preparedStatement = nullptr;
+        std::string sqlStatement;
+        std::map<std::string, long> usage;
+
+        std::shared_ptr<DBHandler> db = std::make_shared<DBHandler>();
+
+        // A fresh database has no ledger yet, and selecting from a missing table is an error.
+        createQuotaLedgerTable(db);
+
+        sqlStatement = std::string("SELECT Endpoint, Units FROM youtube_quota_ledger WHERE Day = ?");
+
+        // Create a prepared statement
+        preparedStatement = db->prepareSqlStatement(sqlStatement);
+        if (db->lastStatus()  != SQLITE_OK) {
+            std::cerr << "sane::prepareSqlStatement(" << sqlStatement << ") ERROR: returned non-zero status: "
+                      << std::to_string( db->lastStatus() ) << std::endl;
+            t_errors->push_back("sane::prepareSqlStatement(" + sqlStatement + ") ERROR: returned non-zero status: "
+                                + std::to_string( db->lastStatus() ));
+            return usage;
+        }
+
+        const char* day = t_day.c_str();
+        int rc = sqlite3_bind_text(preparedStatement, 1, day, strlen(day), nullptr);
+        db->checkRC(rc,             sqlStatement, 1, day, strlen(day), t_errors);
+
+        while (sqlite3_step(preparedStatement) == SQLITE_ROW) { // While query has result-rows.
+            // NB: ColId indexing is 0-based
+            const char* endpoint = (char*) sqlite3_column_text(preparedStatement, 0);
+            long units           = sqlite3_column_int64(preparedStatement, 1);
+
+            if (endpoint) {
+                usage[endpoint] = units;
+            }
+        }
+
+        db->checkRC(sqlite3_clear_bindings(preparedStatement), "sqlite3_clear_bindings", sqlStatement, t_errors);
+        db->checkRC(sqlite3_reset(preparedStatement), "sqlite3_reset", sqlStatement, t_errors);
+
+        // Finalize prepared statement
+        db->finalizePreparedSqlStatement(preparedStatement);
+
+        return usage;
+    }
+} // namespace sane
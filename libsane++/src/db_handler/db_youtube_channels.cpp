@@ -101,8 +101,6 @@ namespace sane {
 
         // Iterate through the subscription objects and add relevant fields to DB.
         for (auto &channel : t_channels) {
-            std::map<std::string, thumbnail_t> thumbnails = channel->getThumbnails();
-
             int hasUploadsPlaylist = channel->hasUploadsPlaylist() ? 1 : 0;
             int hasFavouritesPlaylist = channel->hasFavouritesPlaylist() ? 1 : 0;
             int hasLikesPlaylist = channel->hasLikesPlaylist() ? 1 : 0;
@@ -115,9 +113,9 @@ namespace sane {
             std::string idStr = channel->getId();
             std::string titleStr = channel->getTitle();
             std::string descriptionStr = channel->getDescription();
-            std::string thumbnailDefaultStr = thumbnails["default"].url;
-            std::string thumbnailHighStr = thumbnails["high"].url;
-            std::string thumbnailMediumStr = thumbnails["medium"].url;
+            std::string thumbnailDefaultStr = channel->getThumbnail(ThumbnailSize::Default).url;
+            std::string thumbnailHighStr = channel->getThumbnail(ThumbnailSize::High).url;
+            std::string thumbnailMediumStr = channel->getThumbnail(ThumbnailSize::Medium).url;
 
             // Create C Strings from the locally stored std::strings.
             const char* id = idStr.c_str();
@@ -35,7 +35,7 @@ namespace sane {
                 return true;
             } else if (t_json.is_string()) {
                 // If string, check if string consists solely of digits.
-                std::string str = t_json.get<std::string>();
+                const std::string &str = t_json.get_ref<const std::string &>();
                 return std::all_of(str.begin(), str.end(), ::isdigit);
             }
         }
@@ -43,29 +43,49 @@ namespace sane {
         return false;
     }
 
+    /**
+     * Looks up a member of a JSON object without operator[]'s habit of inserting null for missing keys.
+     *
+     * @param t_object  JSON object (anything else has no members).
+     * @param t_key     Member name.
+     * @return          The member, or a null value (thread-local, reset on every miss) if there is none.
+     */
+    nlohmann::json &getJsonField(nlohmann::json &t_object, const char *t_key) {
+        static thread_local nlohmann::json missing;
+
+        if (t_object.is_object()) {
+            auto it = t_object.find(t_key);
+
+            if (it != t_object.end()) {
+                return *it;
+            }
+        }
+
+        missing = nullptr;
+
+        return missing;
+    }
+
     /**
      * Returns a boolean value from the given JSON value.
      *
-     * If unsuccessful return default value and warn/error.
+     * If unsuccessful return default value and report an error.
      *
-     * @param t_bool    JSON value to be retrieved.
-     * @param t_funcName  Name of the function that called me.
-     * @param t_problems  Map to populate with possible warnings and errors..
+     * @param t_bool        JSON value to be retrieved.
+     * @param t_field       Name of the setter/field that called me (static string).
+     * @param t_diagnostics Where to report problems.
      * @return
      */
-    bool getJsonBoolValue(nlohmann::json &t_bool, const std::string &t_funcName,
-                          std::map<std::string, std::string> &t_problems) {
+    bool getJsonBoolValue(nlohmann::json &t_bool, const char *t_field, Diagnostics &t_diagnostics) {
         if (t_bool.is_boolean()) {
             // JSON is of expected type.
             return t_bool.get<bool>();
         } else if (t_bool.is_string()) {
             // JSON is a string, but it might still contain a boolean value.
-            return t_bool.get<std::string>() == "true";
+            return t_bool.get_ref<const std::string &>() == "true";
         } else {
             // JSON is of unhandled type.
-            t_problems["error"] = t_funcName + ": getJsonBoolValue called with invalid bool, "
-                                               "forced to return false! Type: "
-                                + t_bool.type_name() + std::string(", JSON: ") + t_bool.dump();
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::WrongType, t_field, "bool", t_bool);
         }
 
         // If you got here an error has occurred, returning false since something *has* to be returned.
@@ -77,77 +97,84 @@ namespace sane {
      *
      * If unsuccessful return default value and warn/error.
      *
-     * @param t_string  JSON value to be retrieved.
-     * @param t_funcName  Name of the function that called me.
-     * @param t_problems  Map to populate with possible warnings and errors..
+     * @param t_string      JSON value to be retrieved.
+     * @param t_field       Name of the setter/field that called me (static string).
+     * @param t_diagnostics Where to report problems.
      * @return
      */
-    std::string getJsonStringValue(nlohmann::json &t_string, const std::string &t_funcName,
-                                   std::map<std::string, std::string> &t_problems) {
+    std::string getJsonStringValue(nlohmann::json &t_string, const char *t_field, Diagnostics &t_diagnostics) {
         if (t_string.is_string()) {
-            if (t_string.get<std::string>() == "null") {
+            const std::string &value = t_string.get_ref<const std::string &>();
+
+            if (value == "null") {
                 // Called with the "null" string.
-                t_problems["warning"] = t_funcName + ": getJsonStringValue called with \"null\" string, "
-                                                     "returning empty string!";
+                t_diagnostics.add(DiagnosticSeverity::Warning, DiagnosticCode::NullString, t_field, "string");
             } else {
-                // If it actually is a string, then explicitly cast it.
-                return t_string.get<std::string>();
+                return value;
             }
         } else if (t_string.is_null()) {
             // Called with no value.
-            t_problems["error"] = t_funcName + ": getJsonStringValue called with no value, returning empty string!";
-        } else if (!t_string.is_string()) {
-            // JSON is string with no digits.
-            t_problems["error"] = t_funcName + ": getJsonStringValue called with non-string! Type: "
-                    + t_string.type_name() + std::string(", JSON: ") + t_string.dump();
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::MissingValue, t_field, "string");
         } else {
             // JSON is of unhandled type.
-            t_problems["error"] = t_funcName + ": getJsonStringValue called with invalid parameter! Type: "
-                    + t_string.type_name() + std::string(", JSON: ") + t_string.dump();
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::WrongType, t_field, "string", t_string);
         }
 
         // If you got here an error has occurred, returning empty string since something *has* to be returned.
         return {};
     }
 
+    /**
+     * Like getJsonStringValue, but moves the string out of the JSON value instead of copying it.
+     *
+     * Only use it on JSON that is yours to consume, t_string is left holding an empty string.
+     *
+     * @param t_string      JSON value to be taken.
+     * @param t_field       Name of the setter/field that called me (static string).
+     * @param t_diagnostics Where to report problems.
+     * @return
+     */
+    std::string takeJsonStringValue(nlohmann::json &t_string, const char *t_field, Diagnostics &t_diagnostics) {
+        if (t_string.is_string() and t_string.get_ref<const std::string &>() != "null") {
+            return std::move(t_string.get_ref<std::string &>());
+        }
+
+        // Let the copying variant report the problem.
+        return getJsonStringValue(t_string, t_field, t_diagnostics);
+    }
+
     /**
      * Returns a long value from the given JSON value.
      *
-     * If unsuccessful return default value and warn/error.
+     * If unsuccessful return default value and report an error.
      *
-     * @param t_long    JSON value to be retrieved.
-     * @param t_funcName  Name of the function that called me.
-     * @param t_problems  Map to populate with possible warnings and errors..
+     * @param t_long        JSON value to be retrieved.
+     * @param t_field       Name of the setter/field that called me (static string).
+     * @param t_diagnostics Where to report problems.
      * @return
      */
-    long getJsonLongValue(nlohmann::json &t_long, const std::string &t_funcName,
-                          std::map<std::string, std::string> &t_problems) {
+    long getJsonLongValue(nlohmann::json &t_long, const char *t_field, Diagnostics &t_diagnostics) {
         if (t_long.is_number()) {
             // JSON has expected value type.
             return t_long.get<long>();
         } else if (t_long.is_null()) {
             // Called with no value.
-            t_problems["error"] = t_funcName + ": getJsonLongValue called with no value, returning 0 (likely wrong)!";
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::MissingValue, t_field, "long");
         } else if (t_long.is_string()) {
             // JSON is of string type, but might still hold digits.
-            if ( isDigits(t_long) ) {
+            if (isDigits(t_long)) {
                 // JSON is digits as a string.
-                return std::stol(t_long.get<std::string>());
-            } else if (t_long.get<std::string>() == "null") {
+                return std::stol(t_long.get_ref<const std::string &>());
+            } else if (t_long.get_ref<const std::string &>() == "null") {
                 // Called with the "null" string.
-                t_problems["error"] = t_funcName + ": getJsonULongValue called with \"null\" string, "
-                                                   "returning 0 (likely wrong)!";
+                t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::NullString, t_field, "long");
             } else {
-                    // JSON is string with no digits.
-                t_problems["error"] = t_funcName + ": getJsonLongValue called with non-digit string, "
-                                                   "returning 0 (likely wrong)! Type: " + t_long.type_name()
-                                                   + std::string(", JSON: ") + t_long.dump();
-                }
+                // JSON is string with no digits.
+                t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::NonDigitString, t_field, "long", t_long);
+            }
         } else {
             // Unhandled file type
-            t_problems["error"] = t_funcName + ": getJsonLongValue called  with invalid parameter, "
-                                               "returning 0 (likely wrong)! Type: " + t_long.type_name()
-                                               + std::string(", JSON: ") + t_long.dump();
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::WrongType, t_field, "long", t_long);
         }
 
         // If you got here an error has occurred, returning 0 since something *has* to be returned.
@@ -157,42 +184,37 @@ namespace sane {
     /**
      * Returns an unsigned long value from the given JSON value.
      *
-     * If unsuccessful return default value and warn/error.
+     * If unsuccessful return default value and report an error.
      *
-     * @param t_ulong     JSON value to be retrieved.
-     * @param t_funcName  Name of the function that called me.
-     * @param t_problems  Map to populate with possible warnings and errors..
+     * @param t_ulong       JSON value to be retrieved.
+     * @param t_field       Name of the setter/field that called me (static string).
+     * @param t_diagnostics Where to report problems.
      * @return
      */
-    unsigned long getJsonULongValue(nlohmann::json &t_ulong, const std::string &t_funcName,
-                                    std::map<std::string, std::string> &t_problems) {
+    unsigned long getJsonULongValue(nlohmann::json &t_ulong, const char *t_field, Diagnostics &t_diagnostics) {
         if (t_ulong.is_number()) {
             // JSON has expected value type.
             return t_ulong.get<unsigned long>();
         } else if (t_ulong.is_null()) {
             // Called with no value.
-            t_problems["error"] = t_funcName + ": getJsonULongValue called with no value, "
-                                               "returning 0 (likely wrong)! Type: ";
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::MissingValue, t_field, "unsigned long");
         } else if (t_ulong.is_string()) {
             // JSON is of string type, but might still hold digits.
             if (isDigits(t_ulong)) {
                 // JSON is digits as a string.
-                return std::stoul(t_ulong.get<std::string>());
-            } else if (t_ulong.get<std::string>() == "null") {
+                return std::stoul(t_ulong.get_ref<const std::string &>());
+            } else if (t_ulong.get_ref<const std::string &>() == "null") {
                 // Called with the "null" string.
-                t_problems["error"] = t_funcName + ": getJsonULongValue called with \"null\" string, "
-                                                   "returning 0 (likely wrong)!";
+                t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::NullString, t_field, "unsigned long");
             } else {
                 // JSON is string with no digits.
-                t_problems["error"] = t_funcName + ": getJsonULongValue called with non-digit string, "
-                                                   "returning 0 (likely wrong)! Type: " + t_ulong.type_name()
-                                                   + std::string(", JSON: ") + t_ulong.dump();
+                t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::NonDigitString, t_field,
+                                  "unsigned long", t_ulong);
             }
         } else {
             // Unhandled file type
-            t_problems["error"] = t_funcName + ": getJsonULongValue called "
-                                  "with invalid parameter, returning 0 (likely wrong)! Type: " + t_ulong.type_name()
-                                  + std::string(", JSON: ") + t_ulong.dump();
+            t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::WrongType, t_field, "unsigned long",
+                              t_ulong);
         }
 
         // If you got here an error has occurred, returning 0 since something *has* to be returned.
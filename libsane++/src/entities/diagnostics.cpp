@@ -0,0 +1,104 @@
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+#include <entities/diagnostics.hpp>
+
+namespace sane {
+    /**
+     * @return  Human readable description of the problem.
+     */
+    std::string diagnostic_t::getMessage() const {
+        switch (code) {
+            case DiagnosticCode::NullString:
+                return std::string(field) + ": expected " + expected + ", got the \"null\" string!";
+            case DiagnosticCode::MissingValue:
+                return std::string(field) + ": expected " + expected + ", got no value!";
+            case DiagnosticCode::NonDigitString:
+                return std::string(field) + ": expected " + expected + ", got non-digit string! JSON: " + json.dump();
+            case DiagnosticCode::WrongType:
+                return std::string(field) + ": expected " + expected + ", got " + json.type_name() + "! JSON: "
+                       + json.dump();
+            default:
+                return message;
+        }
+    }
+
+    /**
+     * Reports a problem with a JSON value.
+     *
+     * @param t_severity    Warning or error.
+     * @param t_code        What was wrong with it.
+     * @param t_field       Setter or field that got the value, must be a static string.
+     * @param t_expected    What type of value was expected, must be a static string.
+     * @param t_value       The offending value.
+     */
+    void Diagnostics::add(DiagnosticSeverity t_severity, DiagnosticCode t_code, const char *t_field,
+                          const char *t_expected, const nlohmann::json &t_value) {
+        diagnostic_t diagnostic;
+        diagnostic.severity = t_severity;
+        diagnostic.code = t_code;
+        diagnostic.field = t_field;
+        diagnostic.expected = t_expected;
+        diagnostic.json = t_value;
+
+        m_diagnostics.push_back(std::move(diagnostic));
+    }
+
+    void Diagnostics::addMessage(DiagnosticSeverity t_severity, const std::string &t_message,
+                                 const nlohmann::json &t_json) {
+        diagnostic_t diagnostic;
+        diagnostic.severity = t_severity;
+        diagnostic.message = t_message;
+        diagnostic.json = t_json;
+
+        m_diagnostics.push_back(std::move(diagnostic));
+    }
+
+    bool Diagnostics::empty() const {
+        return m_diagnostics.empty();
+    }
+
+    size_t Diagnostics::count(DiagnosticSeverity t_severity) const {
+        return (size_t)std::count_if(m_diagnostics.begin(), m_diagnostics.end(),
+                                     [t_severity](const diagnostic_t &t_diagnostic) {
+            return t_diagnostic.severity == t_severity;
+        });
+    }
+
+    const std::vector<diagnostic_t> &Diagnostics::getAll() const {
+        return m_diagnostics;
+    }
+
+    void Diagnostics::clear() {
+        m_diagnostics.clear();
+    }
+
+    void Diagnostics::clear(DiagnosticSeverity t_severity) {
+        m_diagnostics.erase(std::remove_if(m_diagnostics.begin(), m_diagnostics.end(),
+                                           [t_severity](const diagnostic_t &t_diagnostic) {
+            return t_diagnostic.severity == t_severity;
+        }), m_diagnostics.end());
+    }
+
+    /**
+     * Prints every diagnostic of a severity, one per line.
+     *
+     * @param t_severity    Warning or error.
+     * @param t_indent      Indentation of the messages.
+     * @param t_withJson    Also print the offending value/context JSON.
+     * @param t_jsonIndent  Indentation of the JSON dump.
+     */
+    void Diagnostics::print(DiagnosticSeverity t_severity, int t_indent, bool t_withJson, int t_jsonIndent) const {
+        for (const diagnostic_t &diagnostic : m_diagnostics) {
+            if (diagnostic.severity != t_severity) {
+                continue;
+            }
+
+            std::cout << std::string(t_indent, ' ') << diagnostic.getMessage() << std::endl;
+            if (t_withJson and !diagnostic.json.empty()) {
+                std::cout << diagnostic.json.dump(t_jsonIndent) << std::endl;
+            }
+        }
+    }
+} // namespace sane
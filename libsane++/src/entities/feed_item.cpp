@@ -0,0 +1,411 @@
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/feed_item.hpp>
+
+namespace sane {
+    /**
+     * Looks up a channel, adding it if it is new.
+     *
+     * @param t_channelId       Channel ID.
+     * @param t_channelTitle    Channel title, replaces the stored one if the channel has been renamed.
+     * @return                  The channel's index.
+     */
+    uint32_t FeedChannelTable::intern(const ChannelId &t_channelId, const std::string &t_channelTitle) {
+        auto existing = m_indexes.find(t_channelId);
+
+        if (existing != m_indexes.end()) {
+            channel_t &channel = m_channels[existing->second];
+            if (channel.title != t_channelTitle) {
+                channel.title = t_channelTitle;
+            }
+
+            return existing->second;
+        }
+
+        auto index = (uint32_t)m_channels.size();
+        m_channels.push_back({t_channelId, t_channelTitle});
+        m_indexes.emplace(t_channelId, index);
+
+        return index;
+    }
+
+    uint32_t FeedChannelTable::intern(const std::string &t_channelId, const std::string &t_channelTitle) {
+        return intern(ChannelId::fromString(t_channelId), t_channelTitle);
+    }
+
+    const ChannelId &FeedChannelTable::getPackedChannelId(uint32_t t_channel) const {
+        return m_channels.at(t_channel).id;
+    }
+
+    std::string FeedChannelTable::getChannelId(uint32_t t_channel) const {
+        return m_channels.at(t_channel).id.toString();
+    }
+
+    const std::string &FeedChannelTable::getChannelTitle(uint32_t t_channel) const {
+        return m_channels.at(t_channel).title;
+    }
+
+    size_t FeedChannelTable::size() const {
+        return m_channels.size();
+    }
+
+    FeedItem::FeedItem(const VideoId &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel, std::string t_title,
+                       uint32_t t_durationSeconds, uint8_t t_flags)
+            : m_publishedAtMs(t_publishedAtMs), m_title(std::move(t_title)), m_id(t_videoId), m_channel(t_channel),
+              m_durationSeconds(t_durationSeconds), m_flags(t_flags) {}
+
+    FeedItem::FeedItem(const std::string &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel, std::string t_title,
+                       uint32_t t_durationSeconds, uint8_t t_flags)
+            : FeedItem(VideoId::fromString(t_videoId), t_publishedAtMs, t_channel, std::move(t_title),
+                       t_durationSeconds, t_flags) {}
+
+    const VideoId &FeedItem::getVideoId() const {
+        return m_id;
+    }
+
+    std::string FeedItem::getId() const {
+        return m_id.toString();
+    }
+
+    int64_t FeedItem::getPublishedAtMs() const {
+        return m_publishedAtMs;
+    }
+
+    uint32_t FeedItem::getChannel() const {
+        return m_channel;
+    }
+
+    const std::string &FeedItem::getTitle() const {
+        return m_title;
+    }
+
+    uint32_t FeedItem::getDurationSeconds() const {
+        return m_durationSeconds;
+    }
+
+    uint8_t FeedItem::getFlags() const {
+        return m_flags;
+    }
+
+    bool FeedItem::isHD() const {
+        return (m_flags & FEED_ITEM_FLAG_HD) != 0;
+    }
+
+    bool FeedItem::hasCaptions() const {
+        return (m_flags & FEED_ITEM_FLAG_CAPTIONS) != 0;
+    }
+
+    bool FeedItem::isLive() const {
+        return (m_flags & FEED_ITEM_FLAG_LIVE) != 0;
+    }
+
+    bool FeedItem::isUpcoming() const {
+        return (m_flags & FEED_ITEM_FLAG_UPCOMING) != 0;
+    }
+
+    /**
+     * Reads a fixed number of digits.
+     *
+     * @return  The number, -1 if any of the characters isn't a digit.
+     */
+    static int readDigits(const std::string &t_string, size_t t_offset, size_t t_count) {
+        if (t_offset + t_count > t_string.size()) {
+            return -1;
+        }
+
+        int value = 0;
+        for (size_t i = t_offset; i < t_offset + t_count; i++) {
+            if (t_string[i] < '0' or t_string[i] > '9') {
+                return -1;
+            }
+            value = value * 10 + (t_string[i] - '0');
+        }
+
+        return value;
+    }
+
+    /**
+     * Parses the API's UTC timestamps (YYYY-MM-DDThh:mm:ss[.sss]Z) without going through strptime and timegm.
+     *
+     * @param t_iso8601 Timestamp.
+     * @return          Milliseconds since the UNIX epoch, -1 if malformed.
+     */
+    int64_t FeedItem::parsePublishedAtMs(const std::string &t_iso8601) {
+        int year = readDigits(t_iso8601, 0, 4);
+        int month = readDigits(t_iso8601, 5, 2);
+        int day = readDigits(t_iso8601, 8, 2);
+        int hour = readDigits(t_iso8601, 11, 2);
+        int minute = readDigits(t_iso8601, 14, 2);
+        int second = readDigits(t_iso8601, 17, 2);
+
+        if (year < 0 or month < 1 or month > 12 or day < 1 or day > 31 or hour < 0 or hour > 23
+            or minute < 0 or minute > 59 or second < 0 or second > 60
+            or t_iso8601[4] != '-' or t_iso8601[7] != '-' or t_iso8601[10] != 'T'
+            or t_iso8601[13] != ':' or t_iso8601[16] != ':') {
+            return -1;
+        }
+
+        int millisecond = 0;
+        if (t_iso8601.size() > 19 and t_iso8601[19] == '.') {
+            // Only the first three fractional digits count.
+            for (size_t i = 20, scale = 100; i < t_iso8601.size() and t_iso8601[i] != 'Z'; i++, scale /= 10) {
+                if (t_iso8601[i] < '0' or t_iso8601[i] > '9') {
+                    return -1;
+                }
+                millisecond += (int)((t_iso8601[i] - '0') * scale);
+            }
+        }
+
+        // Days since the epoch of a proleptic Gregorian date (eras of 400 years, years starting in March).
+        int64_t y = month <= 2 ? year - 1 : year;
+        int64_t era = (y >= 0 ? y : y - 399) / 400;
+        int64_t yearOfEra = y - era * 400;
+        int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+        int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        int64_t days = era * 146097 + dayOfEra - 719468;
+
+        return ((days * 24 + hour) * 60 + minute) * 60000 + (int64_t)second * 1000 + millisecond;
+    }
+
+    /**
+     * Parses a contentDetails.duration, an ISO 8601 duration such as PT1H2M3S or P1DT2H.
+     *
+     * @param t_iso8601Duration Duration.
+     * @return                  Duration in seconds, -1 if malformed.
+     */
+    long FeedItem::parseDurationSeconds(const std::string &t_iso8601Duration) {
+        if (t_iso8601Duration.empty() or t_iso8601Duration[0] != 'P') {
+            return -1;
+        }
+
+        long seconds = 0;
+        long number = -1;
+        bool inTime = false;
+
+        for (size_t i = 1; i < t_iso8601Duration.size(); i++) {
+            char c = t_iso8601Duration[i];
+
+            if (c >= '0' and c <= '9') {
+                number = (number < 0 ? 0 : number) * 10 + (c - '0');
+                continue;
+            }
+            if (c == 'T' and !inTime and number < 0) {
+                inTime = true;
+                continue;
+            }
+            if (number < 0) {
+                return -1;
+            }
+
+            if (!inTime and c == 'W') {
+                seconds += number * 604800;
+            } else if (!inTime and c == 'D') {
+                seconds += number * 86400;
+            } else if (inTime and c == 'H') {
+                seconds += number * 3600;
+            } else if (inTime and c == 'M') {
+                seconds += number * 60;
+            } else if (inTime and c == 'S') {
+                seconds += number;
+            } else {
+                return -1;
+            }
+            number = -1;
+        }
+
+        return number < 0 ? seconds : -1;
+    }
+
+    /**
+     * SAX handler picking the feed fields out of a videos.list() response without building a JSON DOM.
+     *
+     * Tracks where it is by depth: 1 is the response, 2 the items array, 3 an item, 4 an item's part.
+     */
+    class feedItemSaxHandler : public nlohmann::json_sax<nlohmann::json> {
+    public:
+        feedItemSaxHandler(FeedChannelTable &t_channels, std::vector<FeedItem> &t_items)
+                : m_channels(t_channels), m_items(t_items) {}
+
+        bool null() override {
+            return true;
+        }
+
+        bool boolean(bool) override {
+            return true;
+        }
+
+        bool number_integer(number_integer_t) override {
+            return true;
+        }
+
+        bool number_unsigned(number_unsigned_t) override {
+            return true;
+        }
+
+        bool number_float(number_float_t, const string_t &) override {
+            return true;
+        }
+
+        bool string(string_t &t_value) override {
+            if (!m_inItems) {
+                return true;
+            }
+
+            if (m_depth == 3 and m_keys[3] == "id") {
+                m_id.swap(t_value);
+            } else if (m_depth == 4 and m_keys[3] == "snippet") {
+                const std::string &key = m_keys[4];
+
+                if (key == "publishedAt") {
+                    m_publishedAtMs = FeedItem::parsePublishedAtMs(t_value);
+                } else if (key == "channelId") {
+                    m_channelId.swap(t_value);
+                } else if (key == "channelTitle") {
+                    m_channelTitle.swap(t_value);
+                } else if (key == "title") {
+                    m_title.swap(t_value);
+                } else if (key == "liveBroadcastContent") {
+                    m_flags |= t_value == "live" ? FEED_ITEM_FLAG_LIVE : 0;
+                    m_flags |= t_value == "upcoming" ? FEED_ITEM_FLAG_UPCOMING : 0;
+                }
+            } else if (m_depth == 4 and m_keys[3] == "contentDetails") {
+                const std::string &key = m_keys[4];
+
+                if (key == "duration") {
+                    m_durationSeconds = FeedItem::parseDurationSeconds(t_value);
+                } else if (key == "definition") {
+                    m_flags |= t_value == "hd" ? FEED_ITEM_FLAG_HD : 0;
+                } else if (key == "caption") {
+                    m_flags |= t_value == "true" ? FEED_ITEM_FLAG_CAPTIONS : 0;
+                }
+            }
+
+            return true;
+        }
+
+        bool start_object(std::size_t) override {
+            m_depth++;
+
+            if (m_inItems and m_depth == 3) {
+                // A new item.
+                m_id.clear();
+                m_channelId.clear();
+                m_channelTitle.clear();
+                m_title.clear();
+                m_publishedAtMs = -1;
+                m_durationSeconds = 0;
+                m_flags = 0;
+            }
+
+            return true;
+        }
+
+        bool key(string_t &t_key) override {
+            if (m_depth < (int)m_keys.size()) {
+                m_keys[m_depth].swap(t_key);
+            }
+
+            return true;
+        }
+
+        bool end_object() override {
+            if (m_inItems and m_depth == 3) {
+                finishItem();
+            }
+            m_depth--;
+
+            return true;
+        }
+
+        bool start_array(std::size_t) override {
+            m_depth++;
+
+            if (m_depth == 2 and m_keys[1] == "items") {
+                m_inItems = true;
+            }
+
+            return true;
+        }
+
+        bool end_array() override {
+            if (m_depth == 2) {
+                m_inItems = false;
+            }
+            m_depth--;
+
+            return true;
+        }
+
+        bool parse_error(std::size_t t_position, const std::string &, const nlohmann::detail::exception &t_exc) override {
+            std::cerr << "parseFeedItems: Unparsable videos response at byte " << t_position << ": "
+                      << std::string(t_exc.what()) << std::endl;
+
+            return false;
+        }
+
+        size_t getSkippedCount() const {
+            return m_skipped;
+        }
+
+    private:
+        void finishItem() {
+            VideoId videoId;
+            ChannelId channelId;
+
+            if (!VideoId::tryParse(m_id, videoId) or m_publishedAtMs < 0
+                or !ChannelId::tryParse(m_channelId, channelId)) {
+                m_skipped++;
+                return;
+            }
+
+            uint32_t channel = m_channels.intern(channelId, m_channelTitle);
+            m_items.emplace_back(videoId, m_publishedAtMs, channel, std::move(m_title),
+                                 (uint32_t)std::max(m_durationSeconds, 0L), m_flags);
+        }
+
+        FeedChannelTable &m_channels;
+        std::vector<FeedItem> &m_items;
+
+        int m_depth = 0;
+        bool m_inItems = false;
+        // Most recent key at each depth that matters (deeper ones aren't tracked).
+        std::array<std::string, 5> m_keys;
+
+        // Fields of the item being parsed.
+        std::string m_id;
+        std::string m_channelId;
+        std::string m_channelTitle;
+        std::string m_title;
+        int64_t m_publishedAtMs = -1;
+        long m_durationSeconds = 0;
+        uint8_t m_flags = 0;
+
+        size_t m_skipped = 0;
+    };
+
+    /**
+     * Parses the items of a videos.list() response body (requested with at least snippet and contentDetails)
+     * straight into FeedItems.
+     *
+     * @param t_body        Response body.
+     * @param t_channels    Table the items' channels are interned in.
+     * @param t_items       Vector the items are appended to.
+     * @return              False if the body isn't valid JSON (items parsed up to the error are kept).
+     */
+    bool parseFeedItems(const std::string &t_body, FeedChannelTable &t_channels, std::vector<FeedItem> &t_items) {
+        feedItemSaxHandler handler(t_channels, t_items);
+
+        bool parsed = nlohmann::json::sax_parse(t_body, &handler);
+
+        if (handler.getSkippedCount() > 0) {
+            std::cerr << "parseFeedItems WARNING: Skipped " << handler.getSkippedCount()
+                      << " items lacking an ID, publish date or channel." << std::endl;
+        }
+
+        return parsed;
+    }
+} // namespace sane
@@ -0,0 +1,558 @@
+#include <iostream>
+#include <cctype>
+#include <cstring>
+#include <algorithm>
+
+#include <entities/lazy_video.hpp>
+
+namespace sane {
+    static size_t skipWhitespace(const std::string &t_json, size_t t_position) {
+        while (t_position < t_json.size() and (t_json[t_position] == ' ' or t_json[t_position] == '\n'
+                                               or t_json[t_position] == '\r' or t_json[t_position] == '\t')) {
+            t_position++;
+        }
+
+        return t_position;
+    }
+
+    /**
+     * @return  Position after the string that starts (with its opening quote) at t_position,
+     *          std::string::npos if it never ends.
+     */
+    static size_t skipString(const std::string &t_json, size_t t_position) {
+        const char *data = t_json.data();
+        size_t position = t_position + 1;
+
+        while (position < t_json.size()) {
+            auto quote = static_cast<const char *>(std::memchr(data + position, '"', t_json.size() - position));
+            if (quote == nullptr) {
+                break;
+            }
+
+            // The quote is escaped if an odd number of backslashes precede it.
+            size_t backslashes = 0;
+            while (quote - backslashes - 1 > data + t_position and *(quote - backslashes - 1) == '\\') {
+                backslashes++;
+            }
+
+            position = (size_t)(quote - data) + 1;
+            if (backslashes % 2 == 0) {
+                return position;
+            }
+        }
+
+        return std::string::npos;
+    }
+
+    /**
+     * Skips a JSON value without decoding it.
+     *
+     * Only the structure is followed (strings, nesting), it's not a validator.
+     *
+     * @return  Position after the value that starts at t_position, std::string::npos if it never ends.
+     */
+    static size_t skipValue(const std::string &t_json, size_t t_position) {
+        if (t_position >= t_json.size()) {
+            return std::string::npos;
+        }
+
+        char first = t_json[t_position];
+        if (first == '"') {
+            return skipString(t_json, t_position);
+        } else if (first == '{' or first == '[') {
+            size_t depth = 0;
+
+            for (size_t i = t_position; i < t_json.size(); i++) {
+                char c = t_json[i];
+
+                if (c == '"') {
+                    i = skipString(t_json, i);
+                    if (i == std::string::npos) {
+                        return std::string::npos;
+                    }
+                    i--;
+                } else if (c == '{' or c == '[') {
+                    depth++;
+                } else if ((c == '}' or c == ']') and --depth == 0) {
+                    return i + 1;
+                }
+            }
+
+            return std::string::npos;
+        }
+
+        // Number or literal, runs until the next delimiter.
+        size_t end = t_position;
+        while (end < t_json.size() and std::strchr(",}] \n\r\t", t_json[end]) == nullptr) {
+            end++;
+        }
+
+        return end == t_position ? std::string::npos : end;
+    }
+
+    /**
+     * Calls t_callback(keyOffset, keyLength, value) for every member of the object at t_position, where the key
+     * is the raw (still escaped) text between the quotes. The callback returns false to stop early.
+     *
+     * @return  Position after the object, 0 if stopped early, std::string::npos if it isn't a (whole) object.
+     */
+    template<typename Callback>
+    static size_t forEachMember(const std::string &t_json, size_t t_position, Callback t_callback) {
+        if (t_position >= t_json.size() or t_json[t_position] != '{') {
+            return std::string::npos;
+        }
+
+        size_t position = skipWhitespace(t_json, t_position + 1);
+        if (position < t_json.size() and t_json[position] == '}') {
+            return position + 1;
+        }
+
+        while (position < t_json.size() and t_json[position] == '"') {
+            size_t keyEnd = skipString(t_json, position);
+            if (keyEnd == std::string::npos) {
+                break;
+            }
+
+            size_t valueStart = skipWhitespace(t_json, keyEnd);
+            if (valueStart >= t_json.size() or t_json[valueStart] != ':') {
+                break;
+            }
+            valueStart = skipWhitespace(t_json, valueStart + 1);
+
+            size_t valueEnd = skipValue(t_json, valueStart);
+            if (valueEnd == std::string::npos) {
+                break;
+            }
+
+            jsonSpan_t value;
+            value.offset = (uint32_t)valueStart;
+            value.length = (uint32_t)(valueEnd - valueStart);
+            if (!t_callback(position + 1, keyEnd - position - 2, value)) {
+                return 0;
+            }
+
+            position = skipWhitespace(t_json, valueEnd);
+            if (position < t_json.size() and t_json[position] == '}') {
+                return position + 1;
+            } else if (position >= t_json.size() or t_json[position] != ',') {
+                break;
+            }
+            position = skipWhitespace(t_json, position + 1);
+        }
+
+        return std::string::npos;
+    }
+
+    static bool keyEquals(const std::string &t_json, size_t t_keyOffset, size_t t_keyLength, const char *t_key) {
+        return std::strlen(t_key) == t_keyLength and t_json.compare(t_keyOffset, t_keyLength, t_key) == 0;
+    }
+
+    static void appendUtf8(std::string &t_string, uint32_t t_codePoint) {
+        if (t_codePoint < 0x80) {
+            t_string += (char)t_codePoint;
+        } else if (t_codePoint < 0x800) {
+            t_string += (char)(0xC0 | (t_codePoint >> 6));
+            t_string += (char)(0x80 | (t_codePoint & 0x3F));
+        } else if (t_codePoint < 0x10000) {
+            t_string += (char)(0xE0 | (t_codePoint >> 12));
+            t_string += (char)(0x80 | ((t_codePoint >> 6) & 0x3F));
+            t_string += (char)(0x80 | (t_codePoint & 0x3F));
+        } else {
+            t_string += (char)(0xF0 | (t_codePoint >> 18));
+            t_string += (char)(0x80 | ((t_codePoint >> 12) & 0x3F));
+            t_string += (char)(0x80 | ((t_codePoint >> 6) & 0x3F));
+            t_string += (char)(0x80 | (t_codePoint & 0x3F));
+        }
+    }
+
+    /**
+     * @return  Value of the \u escape's four hex digits at t_position, or -1 if they aren't.
+     */
+    static long readHex4(const std::string &t_json, size_t t_position) {
+        if (t_position + 4 > t_json.size()) {
+            return -1;
+        }
+
+        long value = 0;
+        for (size_t i = t_position; i < t_position + 4; i++) {
+            char c = t_json[i];
+            value <<= 4;
+
+            if (c >= '0' and c <= '9') {
+                value |= c - '0';
+            } else if (c >= 'a' and c <= 'f') {
+                value |= c - 'a' + 10;
+            } else if (c >= 'A' and c <= 'F') {
+                value |= c - 'A' + 10;
+            } else {
+                return -1;
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * Decodes the JSON string at t_span (quotes included).
+     */
+    static std::string unescapeString(const std::string &t_json, jsonSpan_t t_span) {
+        size_t begin = t_span.offset + 1;
+        size_t end = t_span.offset + t_span.length - 1;
+
+        // Most strings have nothing escaped.
+        if (std::find(t_json.begin() + begin, t_json.begin() + end, '\\') == t_json.begin() + end) {
+            return t_json.substr(begin, end - begin);
+        }
+
+        std::string string;
+        string.reserve(end - begin);
+
+        for (size_t i = begin; i < end; i++) {
+            if (t_json[i] != '\\') {
+                string += t_json[i];
+                continue;
+            }
+
+            switch (t_json[++i]) {
+                case 'b':
+                    string += '\b';
+                    break;
+                case 'f':
+                    string += '\f';
+                    break;
+                case 'n':
+                    string += '\n';
+                    break;
+                case 'r':
+                    string += '\r';
+                    break;
+                case 't':
+                    string += '\t';
+                    break;
+                case 'u': {
+                    long codePoint = readHex4(t_json, i + 1);
+                    if (codePoint < 0) {
+                        return string;
+                    }
+                    i += 4;
+
+                    // UTF-16 surrogate pair.
+                    if (codePoint >= 0xD800 and codePoint <= 0xDBFF and i + 6 < end and t_json[i + 1] == '\\'
+                        and t_json[i + 2] == 'u') {
+                        long low = readHex4(t_json, i + 3);
+                        if (low >= 0xDC00 and low <= 0xDFFF) {
+                            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                            i += 6;
+                        }
+                    }
+                    appendUtf8(string, (uint32_t)codePoint);
+                    break;
+                }
+                default:
+                    // \" \\ and \/
+                    string += t_json[i];
+                    break;
+            }
+        }
+
+        return string;
+    }
+
+    /**
+     * Indexes the video object that starts at t_offset of t_buffer.
+     *
+     * @param t_buffer  Response body, kept alive for as long as the video is.
+     * @param t_offset  Position of the item's opening brace.
+     */
+    LazyVideo::LazyVideo(std::shared_ptr<const std::string> t_buffer, size_t t_offset)
+            : m_buffer(std::move(t_buffer)) {
+        const std::string &json = *m_buffer;
+
+        size_t end = forEachMember(json, t_offset, [this, &json](size_t t_keyOffset, size_t t_keyLength,
+                                                                 jsonSpan_t t_value) {
+            if (keyEquals(json, t_keyOffset, t_keyLength, "id")) {
+                m_id = t_value;
+                return true;
+            }
+
+            for (size_t part = 0; part < VIDEO_PART_COUNT; part++) {
+                if (keyEquals(json, t_keyOffset, t_keyLength, getVideoPartKey((VideoPart)part))) {
+                    m_parts[part] = t_value;
+                    break;
+                }
+            }
+
+            return true;
+        });
+
+        if (end == std::string::npos) {
+            // Leave it invalid and empty.
+            m_id = jsonSpan_t();
+            m_parts.fill(jsonSpan_t());
+        } else {
+            m_item.offset = (uint32_t)t_offset;
+            m_item.length = (uint32_t)(end - t_offset);
+        }
+    }
+
+    /**
+     * @return  False if there was no (whole) object at the given offset.
+     */
+    bool LazyVideo::isValid() const {
+        return m_item.length > 0;
+    }
+
+    jsonSpan_t LazyVideo::getSpan() const {
+        return m_item;
+    }
+
+    bool LazyVideo::hasPart(VideoPart t_part) const {
+        return m_parts[(size_t)t_part].length > 0;
+    }
+
+    std::string LazyVideo::getId() const {
+        if (m_id.length == 0 or (*m_buffer)[m_id.offset] != '"') {
+            return {};
+        }
+
+        return unescapeString(*m_buffer, m_id);
+    }
+
+    std::string LazyVideo::getTitle() const {
+        return getString(VideoPart::Snippet, "title");
+    }
+
+    std::string LazyVideo::getDescription() const {
+        return getString(VideoPart::Snippet, "description");
+    }
+
+    std::string LazyVideo::getChannelId() const {
+        return getString(VideoPart::Snippet, "channelId");
+    }
+
+    std::string LazyVideo::getChannelTitle() const {
+        return getString(VideoPart::Snippet, "channelTitle");
+    }
+
+    std::string LazyVideo::getPublishedAt() const {
+        return getString(VideoPart::Snippet, "publishedAt");
+    }
+
+    std::string LazyVideo::getDuration() const {
+        return getString(VideoPart::ContentDetails, "duration");
+    }
+
+    unsigned long LazyVideo::getViewCount() const {
+        return getULong(VideoPart::Statistics, "viewCount");
+    }
+
+    /**
+     * Looks up and decodes a string field of a part.
+     *
+     * @param t_part    Part the field is in.
+     * @param t_key     Field name.
+     * @return          The decoded string, empty if absent or not a string.
+     */
+    std::string LazyVideo::getString(VideoPart t_part, const char *t_key) const {
+        jsonSpan_t span = findField(t_part, t_key);
+
+        if (span.length == 0 or (*m_buffer)[span.offset] != '"') {
+            return {};
+        }
+
+        return unescapeString(*m_buffer, span);
+    }
+
+    /**
+     * Points at a string field of a part in the response buffer, without copying it.
+     *
+     * The pointer stays valid for as long as the buffer does (see getBuffer()).
+     *
+     * @param t_part    Part the field is in.
+     * @param t_key     Field name.
+     * @param t_data    Set to the first character.
+     * @param t_length  Set to the length in bytes.
+     * @return          False if absent, not a string or escaped (use getString() then).
+     */
+    bool LazyVideo::getRawString(VideoPart t_part, const char *t_key, const char *&t_data, size_t &t_length) const {
+        jsonSpan_t span = findField(t_part, t_key);
+
+        if (span.length == 0 or (*m_buffer)[span.offset] != '"') {
+            return false;
+        }
+
+        const char *data = m_buffer->data() + span.offset + 1;
+        size_t length = span.length - 2;
+        if (std::memchr(data, '\\', length) != nullptr) {
+            return false;
+        }
+
+        t_data = data;
+        t_length = length;
+
+        return true;
+    }
+
+    /**
+     * Looks up an unsigned field of a part, which the API sends as digit strings (e.g. statistics) or numbers.
+     *
+     * @return  The value, 0 if absent or not digits.
+     */
+    unsigned long LazyVideo::getULong(VideoPart t_part, const char *t_key) const {
+        jsonSpan_t span = findField(t_part, t_key);
+        size_t begin = span.offset;
+        size_t end = span.offset + span.length;
+
+        if (span.length >= 2 and (*m_buffer)[begin] == '"') {
+            begin++;
+            end--;
+        }
+
+        if (begin == end or !std::all_of(m_buffer->begin() + begin, m_buffer->begin() + end, ::isdigit)) {
+            return 0;
+        }
+
+        return std::stoul(m_buffer->substr(begin, end - begin));
+    }
+
+    /**
+     * Looks up a boolean field of a part, which the API sends as booleans or as "true"/"false" strings.
+     */
+    bool LazyVideo::getBool(VideoPart t_part, const char *t_key) const {
+        jsonSpan_t span = findField(t_part, t_key);
+
+        return (span.length == 4 and m_buffer->compare(span.offset, 4, "true") == 0)
+               or (span.length == 6 and m_buffer->compare(span.offset, 6, "\"true\"") == 0);
+    }
+
+    /**
+     * Parses a single part.
+     *
+     * @return  The part as JSON, null if the video doesn't have it.
+     */
+    nlohmann::json LazyVideo::getPart(VideoPart t_part) const {
+        jsonSpan_t span = m_parts[(size_t)t_part];
+
+        if (span.length == 0) {
+            return nlohmann::json();
+        }
+
+        return nlohmann::json::parse(m_buffer->begin() + span.offset, m_buffer->begin() + span.offset + span.length);
+    }
+
+    /**
+     * Parses the whole item.
+     */
+    nlohmann::json LazyVideo::toJson() const {
+        if (!isValid()) {
+            return nlohmann::json();
+        }
+
+        return nlohmann::json::parse(m_buffer->begin() + m_item.offset,
+                                     m_buffer->begin() + m_item.offset + m_item.length);
+    }
+
+    /**
+     * @return  A fully populated YoutubeVideo of the item.
+     */
+    std::shared_ptr<YoutubeVideo> LazyVideo::materialize() const {
+        nlohmann::json json = toJson();
+
+        return std::make_shared<YoutubeVideo>(std::move(json));
+    }
+
+    const std::shared_ptr<const std::string> &LazyVideo::getBuffer() const {
+        return m_buffer;
+    }
+
+    jsonSpan_t LazyVideo::findField(VideoPart t_part, const char *t_key) const {
+        jsonSpan_t part = m_parts[(size_t)t_part];
+        jsonSpan_t field;
+
+        if (part.length == 0) {
+            return field;
+        }
+
+        const std::string &json = *m_buffer;
+        forEachMember(json, part.offset, [&json, &field, t_key](size_t t_keyOffset, size_t t_keyLength,
+                                                                jsonSpan_t t_value) {
+            if (keyEquals(json, t_keyOffset, t_keyLength, t_key)) {
+                field = t_value;
+                return false;
+            }
+
+            return true;
+        });
+
+        return field;
+    }
+
+    /**
+     * Indexes the items of a videos.list() response body as LazyVideos, without decoding any of their fields.
+     *
+     * @param t_body    Response body, shared by the videos.
+     * @param t_videos  Vector the videos are appended to.
+     * @return          False if the body couldn't be scanned.
+     */
+    bool parseLazyVideos(std::shared_ptr<const std::string> t_body, std::vector<LazyVideo> &t_videos) {
+        if (t_body == nullptr or t_body->size() > UINT32_MAX) {
+            std::cerr << "parseLazyVideos: Missing or oversized response body!" << std::endl;
+            return false;
+        }
+
+        const std::string &json = *t_body;
+        jsonSpan_t items;
+
+        size_t end = forEachMember(json, skipWhitespace(json, 0), [&json, &items](size_t t_keyOffset,
+                                                                               size_t t_keyLength, jsonSpan_t t_value) {
+            if (keyEquals(json, t_keyOffset, t_keyLength, "items")) {
+                items = t_value;
+                return false;
+            }
+
+            return true;
+        });
+
+        if (end == std::string::npos and items.length == 0) {
+            std::cerr << "parseLazyVideos: Unparsable videos response!" << std::endl;
+            return false;
+        } else if (items.length == 0 or json[items.offset] != '[') {
+            // No items.
+            return true;
+        }
+
+        size_t position = skipWhitespace(json, items.offset + 1);
+        if (json[position] == ']') {
+            return true;
+        }
+
+        while (position < json.size()) {
+            if (json[position] == '{') {
+                t_videos.emplace_back(t_body, position);
+
+                if (!t_videos.back().isValid()) {
+                    t_videos.pop_back();
+                    break;
+                }
+                position += t_videos.back().getSpan().length;
+            } else {
+                position = skipValue(json, position);
+                if (position == std::string::npos) {
+                    break;
+                }
+            }
+
+            position = skipWhitespace(json, position);
+            if (position < json.size() and json[position] == ']') {
+                return true;
+            } else if (position >= json.size() or json[position] != ',') {
+                break;
+            }
+            position = skipWhitespace(json, position + 1);
+        }
+
+        std::cerr << "parseLazyVideos: Unparsable videos response at byte " << position << "!" << std::endl;
+
+        return false;
+    }
+} // namespace sane
@@ -0,0 +1,178 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include <entities/packed_ids.hpp>
+
+namespace sane {
+    bool VideoId::isValid(const std::string &t_id) {
+        return isValid(t_id.data(), t_id.size());
+    }
+
+    /**
+     * Packs an ID if it's valid.
+     *
+     * @param t_id          Video ID.
+     * @param t_videoId     Set to the packed ID, left as is if t_id isn't valid.
+     * @return              True if t_id was a valid video ID.
+     */
+    bool VideoId::tryParse(const std::string &t_id, VideoId &t_videoId) {
+        if (!isValid(t_id)) {
+            return false;
+        }
+
+        t_videoId = encode(t_id.data());
+
+        return true;
+    }
+
+    /**
+     * @return  The packed ID, or VideoId() if t_id isn't a valid video ID.
+     */
+    VideoId VideoId::fromString(const std::string &t_id) {
+        VideoId videoId;
+
+        if (!tryParse(t_id, videoId)) {
+            std::cerr << "VideoId::fromString Error: '" << t_id << "' is not a valid video ID!" << std::endl;
+        }
+
+        return videoId;
+    }
+
+    std::string VideoId::toString() const {
+        std::string id(VIDEO_ID_LENGTH, '\0');
+        decode(&id[0]);
+
+        return id;
+    }
+
+    const char *ChannelId::getPrefix(ChannelIdTag t_tag) {
+        switch (t_tag) {
+            case ChannelIdTag::Uploads:
+                return "UU";
+            case ChannelIdTag::Favourites:
+                return "FL";
+            case ChannelIdTag::Likes:
+                return "LL";
+            default:
+                return "UC";
+        }
+    }
+
+    /**
+     * Splits the prefix off an ID.
+     *
+     * @return  False if the prefix isn't one of UC, UU, FL or LL.
+     */
+    static bool parseChannelIdPrefix(const std::string &t_id, ChannelIdTag &t_tag) {
+        for (auto tag : {ChannelIdTag::Channel, ChannelIdTag::Uploads, ChannelIdTag::Favourites, ChannelIdTag::Likes}) {
+            if (t_id.compare(0, 2, ChannelId::getPrefix(tag)) == 0) {
+                t_tag = tag;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool ChannelId::isValid(const std::string &t_id) {
+        ChannelIdTag tag = ChannelIdTag::Channel;
+
+        return t_id.size() == CHANNEL_ID_LENGTH and parseChannelIdPrefix(t_id, tag)
+               and isValidBody(t_id.data() + 2, CHANNEL_ID_BODY_LENGTH);
+    }
+
+    /**
+     * Packs an ID (including its prefix) if it's valid.
+     *
+     * @param t_id          Channel or uploads/favourites/likes playlist ID.
+     * @param t_channelId   Set to the packed ID, left as is if t_id isn't valid.
+     * @return              True if t_id was a valid ID.
+     */
+    bool ChannelId::tryParse(const std::string &t_id, ChannelId &t_channelId) {
+        ChannelIdTag tag = ChannelIdTag::Channel;
+
+        if (t_id.size() != CHANNEL_ID_LENGTH or !parseChannelIdPrefix(t_id, tag)
+            or !isValidBody(t_id.data() + 2, CHANNEL_ID_BODY_LENGTH)) {
+            return false;
+        }
+
+        t_channelId = encode(t_id.data() + 2, tag);
+
+        return true;
+    }
+
+    /**
+     * Packs the body of an ID, i.e. the ID without its prefix (what YoutubeChannel::getId() holds).
+     *
+     * @param t_body        CHANNEL_ID_BODY_LENGTH characters.
+     * @param t_tag         Prefix to give the ID.
+     * @param t_channelId   Set to the packed ID, left as is if t_body isn't valid.
+     * @return              True if t_body was valid.
+     */
+    bool ChannelId::tryParseBody(const std::string &t_body, ChannelIdTag t_tag, ChannelId &t_channelId) {
+        if (!isValidBody(t_body.data(), t_body.size())) {
+            return false;
+        }
+
+        t_channelId = encode(t_body.data(), t_tag);
+
+        return true;
+    }
+
+    /**
+     * @return  The packed ID, or ChannelId() if t_id isn't a valid ID.
+     */
+    ChannelId ChannelId::fromString(const std::string &t_id) {
+        ChannelId channelId;
+
+        if (!tryParse(t_id, channelId)) {
+            std::cerr << "ChannelId::fromString Error: '" << t_id << "' is not a valid channel ID!" << std::endl;
+        }
+
+        return channelId;
+    }
+
+    /**
+     * @return  The ID including its prefix.
+     */
+    std::string ChannelId::toString() const {
+        std::string id(CHANNEL_ID_LENGTH, '\0');
+        std::memcpy(&id[0], getPrefix(m_tag), 2);
+        decode(&id[2]);
+
+        return id;
+    }
+
+    /**
+     * @return  The ID without its prefix.
+     */
+    std::string ChannelId::toBodyString() const {
+        std::string body(CHANNEL_ID_BODY_LENGTH, '\0');
+        decode(&body[0]);
+
+        return body;
+    }
+
+    /**
+     * Writes the body as CHANNEL_ID_BYTES big-endian bytes, so BLOB columns sort the same way as ChannelId.
+     */
+    void ChannelId::toBytes(uint8_t *t_bytes) const {
+        for (int i = 0; i < 8; i++) {
+            t_bytes[i] = (uint8_t)(m_high >> (56 - 8 * i));
+            t_bytes[8 + i] = (uint8_t)(m_low >> (56 - 8 * i));
+        }
+    }
+
+    ChannelId ChannelId::fromBytes(const uint8_t *t_bytes, ChannelIdTag t_tag) {
+        uint64_t high = 0;
+        uint64_t low = 0;
+
+        for (int i = 0; i < 8; i++) {
+            high = (high << 8) | t_bytes[i];
+            low = (low << 8) | t_bytes[8 + i];
+        }
+
+        return ChannelId(high, low, t_tag);
+    }
+} // namespace sane
@@ -0,0 +1,86 @@
+#include <string>
+#include <functional>
+
+#include <entities/string_pool.hpp>
+
+namespace sane {
+    static const std::string &emptyString() {
+        static const std::string empty;
+
+        return empty;
+    }
+
+    InternedString::InternedString() : m_string(&emptyString()) {}
+
+    std::ostream &operator<<(std::ostream &t_stream, const InternedString &t_string) {
+        return t_stream << t_string.get();
+    }
+
+    /**
+     * Looks up a string, adding it if it is new.
+     *
+     * @param t_string  String to intern.
+     * @return          Handle to the pool's copy of the string.
+     */
+    InternedString StringPool::intern(const std::string &t_string) {
+        if (t_string.empty()) {
+            return InternedString();
+        }
+
+        // The high bits pick the shard, the set itself buckets on the low ones.
+        size_t hash = std::hash<std::string>()(t_string);
+        shard_t &shard = m_shards[(hash >> (sizeof(size_t) * 8 - 8)) % STRING_POOL_SHARDS];
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto inserted = shard.strings.insert(t_string);
+        if (inserted.second) {
+            // Short strings live inside the std::string itself (SSO), longer ones in a heap buffer.
+            const std::string &string = *inserted.first;
+            shard.bytes += sizeof(std::string) + (string.capacity() > 15 ? string.capacity() + 1 : 0);
+        }
+
+        // Set nodes don't move when the set rehashes, so the pointer stays valid.
+        return InternedString(&*inserted.first);
+    }
+
+    /**
+     * @return  Number of unique strings.
+     */
+    size_t StringPool::size() const {
+        size_t size = 0;
+
+        for (const shard_t &shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            size += shard.strings.size();
+        }
+
+        return size;
+    }
+
+    /**
+     * @return  Approximate memory used by the strings themselves (not counting the hash sets' own overhead).
+     */
+    size_t StringPool::getBytes() const {
+        size_t bytes = 0;
+
+        for (const shard_t &shard : m_shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            bytes += shard.bytes;
+        }
+
+        return bytes;
+    }
+
+    /**
+     * The pool entities intern their repeated fields in.
+     */
+    StringPool &getStringPool() {
+        static StringPool pool;
+
+        return pool;
+    }
+
+    InternedString internString(const std::string &t_string) {
+        return getStringPool().intern(t_string);
+    }
+} // namespace sane
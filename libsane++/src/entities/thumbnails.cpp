@@ -0,0 +1,381 @@
+#include <iostream>
+#include <cstring>
+#include <cstdlib>
+
+#include <entities/thumbnails.hpp>
+
+namespace sane {
+    // Keys in a resource's "thumbnails" object, in ThumbnailSize order.
+    static const char *const THUMBNAIL_KEYS[THUMBNAIL_SIZE_COUNT] = {
+            "default", "medium", "high", "standard", "maxres"
+    };
+
+    // Diagnostic field names, in ThumbnailSize order.
+    static const char *const THUMBNAIL_FIELDS[THUMBNAIL_SIZE_COUNT] = {
+            "setThumbnails [default]", "setThumbnails [medium]", "setThumbnails [high]",
+            "setThumbnails [standard]", "setThumbnails [maxres]"
+    };
+
+    // File names of the video thumbnails, after YOUTUBE_VIDEO_THUMBNAIL_URL_PREFIX and the video ID.
+    static const char *const VIDEO_THUMBNAIL_FILES[THUMBNAIL_SIZE_COUNT] = {
+            "default.jpg", "mqdefault.jpg", "hqdefault.jpg", "sddefault.jpg", "maxresdefault.jpg"
+    };
+
+    // Dimensions of the video thumbnails, which encode() leaves out.
+    static const uint16_t VIDEO_THUMBNAIL_WIDTHS[THUMBNAIL_SIZE_COUNT] = { 120, 320, 480, 640, 1280 };
+    static const uint16_t VIDEO_THUMBNAIL_HEIGHTS[THUMBNAIL_SIZE_COUNT] = { 90, 180, 360, 480, 720 };
+
+    // One character per slot in encode(), in ThumbnailSize order.
+    static const char THUMBNAIL_CODES[] = "dmhsx";
+
+    const char *getThumbnailKey(ThumbnailSize t_size) {
+        return THUMBNAIL_KEYS[(size_t)t_size];
+    }
+
+    bool tryParseThumbnailKey(const std::string &t_key, ThumbnailSize &t_size) {
+        for (size_t i = 0; i < THUMBNAIL_SIZE_COUNT; i++) {
+            if (t_key == THUMBNAIL_KEYS[i]) {
+                t_size = (ThumbnailSize)i;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    std::string getVideoThumbnailUrl(const std::string &t_videoId, ThumbnailSize t_size) {
+        return YOUTUBE_VIDEO_THUMBNAIL_URL_PREFIX + t_videoId + "/" + VIDEO_THUMBNAIL_FILES[(size_t)t_size];
+    }
+
+    /**
+     * Same as t_url == getVideoThumbnailUrl(t_videoId, t_size), without building the URL.
+     */
+    static bool isVideoThumbnailUrl(const std::string &t_url, const std::string &t_videoId, ThumbnailSize t_size) {
+        static const size_t prefixLength = std::strlen(YOUTUBE_VIDEO_THUMBNAIL_URL_PREFIX);
+        const char *file = VIDEO_THUMBNAIL_FILES[(size_t)t_size];
+        size_t fileLength = std::strlen(file);
+
+        return t_url.size() == prefixLength + t_videoId.size() + 1 + fileLength
+               and t_url.compare(0, prefixLength, YOUTUBE_VIDEO_THUMBNAIL_URL_PREFIX) == 0
+               and t_url.compare(prefixLength, t_videoId.size(), t_videoId) == 0
+               and t_url[prefixLength + t_videoId.size()] == '/'
+               and t_url.compare(prefixLength + t_videoId.size() + 1, fileLength, file) == 0;
+    }
+
+    static uint8_t getThumbnailBit(ThumbnailSize t_size) {
+        return (uint8_t)(1u << (unsigned)t_size);
+    }
+
+    bool Thumbnails::has(ThumbnailSize t_size) const {
+        return (m_present & getThumbnailBit(t_size)) != 0;
+    }
+
+    bool Thumbnails::empty() const {
+        return m_present == 0;
+    }
+
+    uint8_t Thumbnails::getPresence() const {
+        return m_present;
+    }
+
+    bool Thumbnails::isUrlStored(ThumbnailSize t_size) const {
+        return (m_stored & getThumbnailBit(t_size)) != 0;
+    }
+
+    /**
+     * @return  Offset of the slot's URL in m_urls, or where it would be inserted if it has none.
+     */
+    size_t Thumbnails::findStoredUrl(ThumbnailSize t_size) const {
+        size_t offset = 0;
+
+        for (size_t i = 0; i < (size_t)t_size; i++) {
+            if (isUrlStored((ThumbnailSize)i)) {
+                offset = m_urls.find('\0', offset) + 1;
+            }
+        }
+
+        return offset;
+    }
+
+    /**
+     * Sets a slot, or erases it if t_url is empty.
+     *
+     * @param t_size    Slot to set.
+     * @param t_url     Thumbnail URL.
+     * @param t_width   Width in pixels (dimensions over 65535 are clamped).
+     * @param t_height  Height in pixels.
+     * @param t_videoId ID of the video the thumbnail is of, if any: a URL that can be rebuilt from it isn't stored.
+     */
+    void Thumbnails::set(ThumbnailSize t_size, const std::string &t_url, unsigned int t_width,
+                         unsigned int t_height, const std::string &t_videoId) {
+        erase(t_size);
+
+        if (t_url.empty()) {
+            return;
+        }
+
+        auto slot = (size_t)t_size;
+        m_present |= getThumbnailBit(t_size);
+        m_widths[slot] = (uint16_t)(t_width > UINT16_MAX ? UINT16_MAX : t_width);
+        m_heights[slot] = (uint16_t)(t_height > UINT16_MAX ? UINT16_MAX : t_height);
+
+        if (t_videoId.empty() or !isVideoThumbnailUrl(t_url, t_videoId, t_size)) {
+            size_t offset = findStoredUrl(t_size);
+
+            m_urls.insert(offset, t_url.c_str(), t_url.size() + 1);
+            m_stored |= getThumbnailBit(t_size);
+        }
+    }
+
+    void Thumbnails::erase(ThumbnailSize t_size) {
+        if (isUrlStored(t_size)) {
+            size_t offset = findStoredUrl(t_size);
+
+            m_urls.erase(offset, m_urls.find('\0', offset) + 1 - offset);
+            m_stored &= (uint8_t)~getThumbnailBit(t_size);
+        }
+
+        m_present &= (uint8_t)~getThumbnailBit(t_size);
+        m_widths[(size_t)t_size] = 0;
+        m_heights[(size_t)t_size] = 0;
+    }
+
+    /**
+     * @param t_size    Slot to get.
+     * @param t_videoId ID of the video, to rebuild a URL that wasn't stored.
+     * @return          The thumbnail, empty if the slot isn't set.
+     */
+    thumbnail_t Thumbnails::get(ThumbnailSize t_size, const std::string &t_videoId) const {
+        thumbnail_t thumbnail;
+
+        if (has(t_size)) {
+            thumbnail.url = getUrl(t_size, t_videoId);
+            thumbnail.width = m_widths[(size_t)t_size];
+            thumbnail.height = m_heights[(size_t)t_size];
+        }
+
+        return thumbnail;
+    }
+
+    std::string Thumbnails::getUrl(ThumbnailSize t_size, const std::string &t_videoId) const {
+        if (isUrlStored(t_size)) {
+            return std::string(m_urls.c_str() + findStoredUrl(t_size));
+        } else if (has(t_size) and !t_videoId.empty()) {
+            return getVideoThumbnailUrl(t_videoId, t_size);
+        }
+
+        return {};
+    }
+
+    /**
+     * @return  The set slots keyed as in a "thumbnails" object.
+     */
+    std::map<std::string, thumbnail_t> Thumbnails::toMap(const std::string &t_videoId) const {
+        std::map<std::string, thumbnail_t> thumbnails;
+
+        for (size_t i = 0; i < THUMBNAIL_SIZE_COUNT; i++) {
+            if (has((ThumbnailSize)i)) {
+                thumbnails[THUMBNAIL_KEYS[i]] = get((ThumbnailSize)i, t_videoId);
+            }
+        }
+
+        return thumbnails;
+    }
+
+    /**
+     * Encodes the set slots as "<slot>[<width>x<height>][=<URL length>:<URL>]", separated by ';'.
+     *
+     * Slots are one of "dmhsx" (default to maxres), dimensions are left out when they are those of the video
+     * thumbnails and only stored URLs are written, so a video's usual five thumbnails encode as "d;m;h;s;x".
+     *
+     * @return
+     */
+    std::string Thumbnails::encode() const {
+        std::string encoded;
+        size_t urlOffset = 0;
+
+        for (size_t i = 0; i < THUMBNAIL_SIZE_COUNT; i++) {
+            auto size = (ThumbnailSize)i;
+            if (!has(size)) {
+                continue;
+            }
+
+            if (!encoded.empty()) {
+                encoded += ';';
+            }
+            encoded += THUMBNAIL_CODES[i];
+
+            if (m_widths[i] != VIDEO_THUMBNAIL_WIDTHS[i] or m_heights[i] != VIDEO_THUMBNAIL_HEIGHTS[i]) {
+                encoded += std::to_string(m_widths[i]) + "x" + std::to_string(m_heights[i]);
+            }
+
+            if (isUrlStored(size)) {
+                size_t urlLength = m_urls.find('\0', urlOffset) - urlOffset;
+
+                encoded += "=" + std::to_string(urlLength) + ":";
+                encoded.append(m_urls, urlOffset, urlLength);
+                urlOffset += urlLength + 1;
+            }
+        }
+
+        return encoded;
+    }
+
+    /**
+     * Reads a slot's number in tryDecode(), which must be followed by t_terminator.
+     */
+    static bool readThumbnailNumber(const std::string &t_encoded, size_t &t_position, char t_terminator,
+                                    unsigned long &t_number) {
+        const char *begin = t_encoded.c_str() + t_position;
+        char *end = nullptr;
+
+        if (*begin < '0' or *begin > '9') {
+            return false;
+        }
+        t_number = std::strtoul(begin, &end, 10);
+        t_position += end - begin;
+
+        if (t_position >= t_encoded.size() or t_encoded[t_position] != t_terminator) {
+            return false;
+        }
+        t_position++;
+
+        return true;
+    }
+
+    /**
+     * Decodes what encode() produced.
+     *
+     * @param t_encoded     Encoded thumbnails.
+     * @param t_thumbnails  Set to the decoded thumbnails, or left empty if t_encoded is malformed.
+     * @return              false if t_encoded is malformed.
+     */
+    bool Thumbnails::tryDecode(const std::string &t_encoded, Thumbnails &t_thumbnails) {
+        Thumbnails thumbnails;
+        size_t position = 0;
+        size_t nextSlot = 0;
+
+        while (position < t_encoded.size()) {
+            const char *code = std::strchr(THUMBNAIL_CODES, t_encoded[position]);
+            if (t_encoded[position] == '\0' or code == nullptr or (size_t)(code - THUMBNAIL_CODES) < nextSlot) {
+                // Unknown, repeated or out of order slot.
+                break;
+            }
+            auto size = (ThumbnailSize)(code - THUMBNAIL_CODES);
+            auto slot = (size_t)size;
+            nextSlot = slot + 1;
+            position++;
+
+            unsigned long width = VIDEO_THUMBNAIL_WIDTHS[slot];
+            unsigned long height = VIDEO_THUMBNAIL_HEIGHTS[slot];
+            if (position < t_encoded.size() and t_encoded[position] >= '0' and t_encoded[position] <= '9') {
+                if (!readThumbnailNumber(t_encoded, position, 'x', width)
+                    or t_encoded[position] < '0' or t_encoded[position] > '9') {
+                    break;
+                }
+                char *end = nullptr;
+                height = std::strtoul(t_encoded.c_str() + position, &end, 10);
+                position = end - t_encoded.c_str();
+            }
+
+            thumbnails.m_present |= getThumbnailBit(size);
+            thumbnails.m_widths[slot] = (uint16_t)(width > UINT16_MAX ? UINT16_MAX : width);
+            thumbnails.m_heights[slot] = (uint16_t)(height > UINT16_MAX ? UINT16_MAX : height);
+
+            if (position < t_encoded.size() and t_encoded[position] == '=') {
+                unsigned long urlLength = 0;
+
+                position++;
+                if (!readThumbnailNumber(t_encoded, position, ':', urlLength)
+                    or urlLength == 0 or urlLength > t_encoded.size() - position) {
+                    break;
+                }
+
+                // Slots are encoded in order, so the URL goes at the end.
+                thumbnails.m_urls.append(t_encoded, position, urlLength);
+                thumbnails.m_urls += '\0';
+                thumbnails.m_stored |= getThumbnailBit(size);
+                position += urlLength;
+            }
+
+            if (position == t_encoded.size()) {
+                t_thumbnails = std::move(thumbnails);
+                return true;
+            } else if (t_encoded[position] != ';') {
+                break;
+            }
+            position++;
+        }
+
+        if (t_encoded.empty()) {
+            t_thumbnails = Thumbnails();
+            return true;
+        }
+
+        std::cerr << "Thumbnails::tryDecode ERROR: Malformed thumbnails '" << t_encoded << "'!" << std::endl;
+        t_thumbnails = Thumbnails();
+
+        return false;
+    }
+
+    bool Thumbnails::operator==(const Thumbnails &t_other) const {
+        return m_present == t_other.m_present and m_stored == t_other.m_stored and m_widths == t_other.m_widths
+               and m_heights == t_other.m_heights and m_urls == t_other.m_urls;
+    }
+
+    bool Thumbnails::operator!=(const Thumbnails &t_other) const {
+        return !(*this == t_other);
+    }
+
+    /**
+     * Reads a thumbnail's width or height, 0 if it has none.
+     */
+    static unsigned int getThumbnailDimension(const nlohmann::json &t_thumbnail, const char *t_key) {
+        auto dimension = t_thumbnail.find(t_key);
+
+        if (dimension != t_thumbnail.end() and dimension->is_number_integer() and dimension->get<long>() >= 0) {
+            return dimension->get<unsigned int>();
+        }
+
+        return 0;
+    }
+
+    /**
+     * Reads a resource's "thumbnails" object.
+     *
+     * @param t_thumbnails  The "thumbnails" object.
+     * @param t_videoId     ID of the video the thumbnails are of, empty for other resources.
+     * @param t_diagnostics Where to report thumbnails without a usable URL.
+     * @return              The thumbnails, unknown sizes are left out.
+     */
+    Thumbnails getThumbnailsFromJson(const nlohmann::json &t_thumbnails, const std::string &t_videoId,
+                                     Diagnostics &t_diagnostics) {
+        Thumbnails thumbnails;
+
+        if (!t_thumbnails.is_object()) {
+            return thumbnails;
+        }
+
+        for (size_t i = 0; i < THUMBNAIL_SIZE_COUNT; i++) {
+            auto thumbnail = t_thumbnails.find(THUMBNAIL_KEYS[i]);
+            if (thumbnail == t_thumbnails.end() or !thumbnail->is_object()) {
+                continue;
+            }
+
+            auto url = thumbnail->find("url");
+            if (url == thumbnail->end() or url->is_null()) {
+                t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::MissingValue, THUMBNAIL_FIELDS[i],
+                                  "string");
+            } else if (!url->is_string()) {
+                t_diagnostics.add(DiagnosticSeverity::Error, DiagnosticCode::WrongType, THUMBNAIL_FIELDS[i],
+                                  "string", *url);
+            } else {
+                thumbnails.set((ThumbnailSize)i, url->get_ref<const std::string &>(),
+                               getThumbnailDimension(*thumbnail, "width"),
+                               getThumbnailDimension(*thumbnail, "height"), t_videoId);
+            }
+        }
+
+        return thumbnails;
+    }
+} // namespace sane
@@ -0,0 +1,87 @@
+#include <iostream>
+#include <cstring>
+
+#include <entities/video_parts.hpp>
+
+namespace sane {
+    // Response/request keys of the parts, in VideoPart order.
+    static const char *const VIDEO_PART_KEYS[VIDEO_PART_COUNT] = {
+            "snippet", "contentDetails", "statistics", "status", "player", "topicDetails", "recordingDetails",
+            "fileDetails", "processingDetails", "suggestions", "liveStreamingDetails", "localizations"
+    };
+
+    const char *getVideoPartKey(VideoPart t_part) {
+        return VIDEO_PART_KEYS[(size_t)t_part];
+    }
+
+    /**
+     * Parses the "part" parameter of a videos.list() request.
+     *
+     * "id" is accepted but has no bit (it's always returned), unknown parts are reported and left out.
+     *
+     * @param t_part    Comma separated parts, e.g. "snippet,contentDetails".
+     * @return
+     */
+    VideoParts VideoParts::parse(const std::string &t_part) {
+        VideoParts parts;
+        size_t begin = 0;
+
+        while (begin <= t_part.size()) {
+            size_t end = t_part.find(',', begin);
+            if (end == std::string::npos) {
+                end = t_part.size();
+            }
+
+            // Ignore surrounding whitespace, e.g. "snippet, contentDetails".
+            size_t first = begin;
+            size_t last = end;
+            while (first < last and t_part[first] == ' ') {
+                first++;
+            }
+            while (last > first and t_part[last - 1] == ' ') {
+                last--;
+            }
+
+            if (last > first and t_part.compare(first, last - first, "id") != 0) {
+                bool known = false;
+
+                for (size_t i = 0; i < VIDEO_PART_COUNT; i++) {
+                    if (std::strlen(VIDEO_PART_KEYS[i]) == last - first
+                        and t_part.compare(first, last - first, VIDEO_PART_KEYS[i]) == 0) {
+                        parts = parts.with((VideoPart)i);
+                        known = true;
+                        break;
+                    }
+                }
+
+                if (!known) {
+                    std::cerr << "VideoParts::parse WARNING: Ignoring unknown part '"
+                              << t_part.substr(first, last - first) << "'!" << std::endl;
+                }
+            }
+
+            begin = end + 1;
+        }
+
+        return parts;
+    }
+
+    /**
+     * @return  The parts as a "part" parameter value, e.g. "snippet,contentDetails" ("id" if there are none, the
+     *          parameter can't be empty).
+     */
+    std::string VideoParts::toString() const {
+        std::string part;
+
+        for (size_t i = 0; i < VIDEO_PART_COUNT; i++) {
+            if (has((VideoPart)i)) {
+                if (!part.empty()) {
+                    part += ",";
+                }
+                part += VIDEO_PART_KEYS[i];
+            }
+        }
+
+        return part.empty() ? "id" : part;
+    }
+} // namespace sane
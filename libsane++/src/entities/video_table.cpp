@@ -0,0 +1,258 @@
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+#include <entities/video_table.hpp>
+
+namespace sane {
+    /**
+     * Reserves room up front, so building a large table doesn't keep reallocating its columns.
+     *
+     * @param t_rows        Expected number of rows.
+     * @param t_titleBytes  Expected total length of the titles.
+     */
+    void VideoTable::reserve(size_t t_rows, size_t t_titleBytes) {
+        m_publishedAtMs.reserve(t_rows);
+        m_channel.reserve(t_rows);
+        m_durationSeconds.reserve(t_rows);
+        m_flags.reserve(t_rows);
+        m_ids.reserve(t_rows);
+        m_titleOffsets.reserve(t_rows + 1);
+        m_titleArena.reserve(t_titleBytes);
+    }
+
+    size_t VideoTable::size() const {
+        return m_publishedAtMs.size();
+    }
+
+    void VideoTable::clear() {
+        *this = VideoTable();
+    }
+
+    uint32_t VideoTable::internChannel(const ChannelId &t_channelId, const std::string &t_channelTitle) {
+        return m_channels.intern(t_channelId, t_channelTitle);
+    }
+
+    uint32_t VideoTable::internChannel(const std::string &t_channelId, const std::string &t_channelTitle) {
+        return m_channels.intern(t_channelId, t_channelTitle);
+    }
+
+    /**
+     * Appends a row.
+     *
+     * @param t_videoId         Video ID.
+     * @param t_publishedAtMs   Publish time, ms since the UNIX epoch.
+     * @param t_channel         Channel index, see internChannel().
+     * @param t_title           Title.
+     * @param t_durationSeconds Duration.
+     * @param t_flags           FEED_ITEM_FLAG_* flags.
+     */
+    void VideoTable::append(const VideoId &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel,
+                            const std::string &t_title, uint32_t t_durationSeconds, uint8_t t_flags) {
+        m_publishedAtMs.push_back(t_publishedAtMs);
+        m_channel.push_back(t_channel);
+        m_durationSeconds.push_back(t_durationSeconds);
+        m_flags.push_back(t_flags);
+        m_ids.push_back(t_videoId);
+        m_titleArena.append(t_title);
+        m_titleOffsets.push_back((uint32_t)m_titleArena.size());
+    }
+
+    void VideoTable::append(const std::string &t_videoId, int64_t t_publishedAtMs, uint32_t t_channel,
+                            const std::string &t_title, uint32_t t_durationSeconds, uint8_t t_flags) {
+        append(VideoId::fromString(t_videoId), t_publishedAtMs, t_channel, t_title, t_durationSeconds, t_flags);
+    }
+
+    /**
+     * Appends parsed feed items.
+     *
+     * @param t_items       Items.
+     * @param t_channels    Table the items' channel indexes refer to, re-interned into this table's.
+     */
+    void VideoTable::append(const std::vector<FeedItem> &t_items, const FeedChannelTable &t_channels) {
+        std::vector<uint32_t> channelMap(t_channels.size());
+        for (uint32_t channel = 0; channel < t_channels.size(); channel++) {
+            channelMap[channel] = internChannel(t_channels.getPackedChannelId(channel),
+                                               t_channels.getChannelTitle(channel));
+        }
+
+        reserve(size() + t_items.size());
+        for (const FeedItem &item : t_items) {
+            append(item.getVideoId(), item.getPublishedAtMs(), channelMap[item.getChannel()], item.getTitle(),
+                   item.getDurationSeconds(), item.getFlags());
+        }
+    }
+
+    /**
+     * Appends the items of a videos.list() response body.
+     *
+     * @param t_body    Response body.
+     * @return          False if it couldn't be parsed (the items parsed up to the error are still appended).
+     */
+    bool VideoTable::appendResponse(const std::string &t_body) {
+        FeedChannelTable channels;
+        std::vector<FeedItem> items;
+
+        bool parsed = parseFeedItems(t_body, channels, items);
+        append(items, channels);
+
+        return parsed;
+    }
+
+    /**
+     * Appends YoutubeVideo entities, e.g. a feed from createSubscriptionsFeed().
+     */
+    void VideoTable::append(const std::list<std::shared_ptr<YoutubeVideo>> &t_videos) {
+        reserve(size() + t_videos.size());
+
+        for (const auto &video : t_videos) {
+            uint8_t flags = 0;
+            flags |= video->isHD() ? FEED_ITEM_FLAG_HD : 0;
+            flags |= video->hasCaptions() ? FEED_ITEM_FLAG_CAPTIONS : 0;
+            flags |= video->getLiveBroadcastContent() == "live" ? FEED_ITEM_FLAG_LIVE : 0;
+            flags |= video->getLiveBroadcastContent() == "upcoming" ? FEED_ITEM_FLAG_UPCOMING : 0;
+            long durationSeconds = FeedItem::parseDurationSeconds(video->getDuration());
+
+            append(video->getId(), (int64_t)(video->getPublishedAt().timestampWithMsec * 1000),
+                   internChannel(video->getChannelId(), video->getChannelTitle()), video->getTitle(),
+                   (uint32_t)std::max(durationSeconds, 0L), flags);
+        }
+    }
+
+    const VideoId &VideoTable::getVideoId(size_t t_row) const {
+        return m_ids[t_row];
+    }
+
+    std::string VideoTable::getId(size_t t_row) const {
+        return m_ids[t_row].toString();
+    }
+
+    int64_t VideoTable::getPublishedAtMs(size_t t_row) const {
+        return m_publishedAtMs[t_row];
+    }
+
+    uint32_t VideoTable::getChannel(size_t t_row) const {
+        return m_channel[t_row];
+    }
+
+    std::string VideoTable::getTitle(size_t t_row) const {
+        return m_titleArena.substr(m_titleOffsets[t_row], m_titleOffsets[t_row + 1] - m_titleOffsets[t_row]);
+    }
+
+    uint32_t VideoTable::getDurationSeconds(size_t t_row) const {
+        return m_durationSeconds[t_row];
+    }
+
+    uint8_t VideoTable::getFlags(size_t t_row) const {
+        return m_flags[t_row];
+    }
+
+    const FeedChannelTable &VideoTable::getChannels() const {
+        return m_channels;
+    }
+
+    /**
+     * @return  A selection of every row, to narrow down with the filter kernels.
+     */
+    selection_t VideoTable::selectAll() const {
+        return selection_t(size(), 1);
+    }
+
+    // The kernels below deliberately use & rather than && and no early outs: one pass, no branches.
+
+    /**
+     * Keeps rows published within [t_fromMs, t_toMs].
+     */
+    void VideoTable::filterPublishedBetween(int64_t t_fromMs, int64_t t_toMs, selection_t &t_selection) const {
+        const int64_t *publishedAt = m_publishedAtMs.data();
+        uint8_t *selected = t_selection.data();
+        size_t rows = std::min(size(), t_selection.size());
+
+        for (size_t i = 0; i < rows; i++) {
+            selected[i] &= (uint8_t)((publishedAt[i] >= t_fromMs) & (publishedAt[i] <= t_toMs));
+        }
+    }
+
+    /**
+     * Keeps rows of one channel.
+     */
+    void VideoTable::filterChannel(uint32_t t_channel, selection_t &t_selection) const {
+        const uint32_t *channel = m_channel.data();
+        uint8_t *selected = t_selection.data();
+        size_t rows = std::min(size(), t_selection.size());
+
+        for (size_t i = 0; i < rows; i++) {
+            selected[i] &= (uint8_t)(channel[i] == t_channel);
+        }
+    }
+
+    /**
+     * Keeps rows lasting within [t_minSeconds, t_maxSeconds].
+     */
+    void VideoTable::filterDurationBetween(uint32_t t_minSeconds, uint32_t t_maxSeconds,
+                                           selection_t &t_selection) const {
+        const uint32_t *duration = m_durationSeconds.data();
+        uint8_t *selected = t_selection.data();
+        size_t rows = std::min(size(), t_selection.size());
+
+        for (size_t i = 0; i < rows; i++) {
+            selected[i] &= (uint8_t)((duration[i] >= t_minSeconds) & (duration[i] <= t_maxSeconds));
+        }
+    }
+
+    /**
+     * Keeps rows that have every flag in t_required and none in t_excluded.
+     *
+     * @param t_required    FEED_ITEM_FLAG_* flags that must be set.
+     * @param t_excluded    FEED_ITEM_FLAG_* flags that must not be set.
+     */
+    void VideoTable::filterFlags(uint8_t t_required, uint8_t t_excluded, selection_t &t_selection) const {
+        const uint8_t *flags = m_flags.data();
+        uint8_t *selected = t_selection.data();
+        size_t rows = std::min(size(), t_selection.size());
+        auto mask = (uint8_t)(t_required | t_excluded);
+
+        for (size_t i = 0; i < rows; i++) {
+            selected[i] &= (uint8_t)((flags[i] & mask) == t_required);
+        }
+    }
+
+    size_t VideoTable::countSelected(const selection_t &t_selection) {
+        size_t count = 0;
+
+        for (uint8_t selected : t_selection) {
+            count += selected;
+        }
+
+        return count;
+    }
+
+    /**
+     * @return  Indexes of the selected rows, in table order.
+     */
+    std::vector<uint32_t> VideoTable::getSelectedRows(const selection_t &t_selection) {
+        std::vector<uint32_t> rows;
+        rows.reserve(countSelected(t_selection));
+
+        for (size_t i = 0; i < t_selection.size(); i++) {
+            if (t_selection[i]) {
+                rows.push_back((uint32_t)i);
+            }
+        }
+
+        return rows;
+    }
+
+    /**
+     * Orders rows newest first, comparing only the publish date column.
+     */
+    std::vector<uint32_t> VideoTable::sortByPublishedDescending(std::vector<uint32_t> t_rows) const {
+        const int64_t *publishedAt = m_publishedAtMs.data();
+
+        std::stable_sort(t_rows.begin(), t_rows.end(), [publishedAt](uint32_t t_row1, uint32_t t_row2) {
+            return publishedAt[t_row1] > publishedAt[t_row2];
+        });
+
+        return t_rows;
+    }
+} // namespace sane
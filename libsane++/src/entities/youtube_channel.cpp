@@ -11,7 +11,17 @@ namespace sane {
     // An empty constructor if you want to populate it later.
     YoutubeChannel::YoutubeChannel() = default;
 
-    void YoutubeChannel::addFromJson(nlohmann::json t_json) {
+    void YoutubeChannel::addFromJson(const nlohmann::json &t_json) {
+        // The setters consume what they parse, so leave the caller's JSON alone.
+        addFromJson(nlohmann::json(t_json));
+    }
+
+    /**
+     * Populates the channel from a channel (or subscription) resource, moving its strings instead of copying them.
+     *
+     * @param t_json    The resource, left with empty strings wherever values were taken.
+     */
+    void YoutubeChannel::addFromJson(nlohmann::json &&t_json) {
         try {
             if (t_json.find("kind") != t_json.end()) {
                 if (t_json["kind"].get<std::string>() == "youtube#channel") {
@@ -29,14 +39,14 @@ namespace sane {
 
             // If channelId was valid, strip non-unique channel prefix from its head to produce the actual ID.
             if (!getId().empty()) {
-                m_id = getId().substr(2);
+                setId(getId().substr(2));
             } else {
                 addError("Missing Channel ID!", t_json);
                 std::cerr << "Missing Channel ID:\n" << t_json.dump(4) << std::endl;
             }
 
             // Playlists
-            nlohmann::json relatedPlaylists = t_json["contentDetails"]["relatedPlaylists"];
+            nlohmann::json &relatedPlaylists = t_json["contentDetails"]["relatedPlaylists"];
             setHasFavouritesPlaylist(relatedPlaylists["favorites"].is_string());
             setHasUploadsPlaylist(relatedPlaylists["uploads"].is_string());
             setHasLikesPlaylist(relatedPlaylists["likes"].is_string());
@@ -68,20 +78,13 @@ namespace sane {
         setDescription(std::string(t_description));
 
         // Thumbnails
-        std::map<std::string, thumbnail_t> thumbs;
-        thumbnail_t thumbnailDefault;
-        thumbnail_t thumbnailHigh;
-        thumbnail_t thumbnailMedium;
-
-        thumbnailDefault.url = std::string(t_thumbnailDefault);
-        thumbnailHigh.url = std::string(t_thumbnailHigh);
-        thumbnailMedium.url = std::string(t_thumbnailMedium);
+        Thumbnails thumbnails;
 
-        thumbs["default"] = thumbnailDefault;
-        thumbs["high"] = thumbnailHigh;
-        thumbs["medium"] = thumbnailMedium;
+        thumbnails.set(ThumbnailSize::Default, std::string(t_thumbnailDefault), 0, 0);
+        thumbnails.set(ThumbnailSize::High, std::string(t_thumbnailHigh), 0, 0);
+        thumbnails.set(ThumbnailSize::Medium, std::string(t_thumbnailMedium), 0, 0);
 
-        setThumbnails(thumbs);
+        setThumbnails(std::move(thumbnails));
 
         setIsSubscribedOnYoutube(t_subscribedOnYoutube);
         setHasSubscribedLocalOverride(t_subscribedLocalOverride);
@@ -100,20 +103,13 @@ namespace sane {
         setDescription(std::string(t_description));
 
         // Thumbnails
-        std::map<std::string, thumbnail_t> thumbs;
-        thumbnail_t thumbnailDefault;
-        thumbnail_t thumbnailHigh;
-        thumbnail_t thumbnailMedium;
+        Thumbnails thumbnails;
 
-        thumbnailDefault.url = std::string(t_thumbnailDefault);
-        thumbnailHigh.url = std::string(t_thumbnailHigh);
-        thumbnailMedium.url = std::string(t_thumbnailMedium);
+        thumbnails.set(ThumbnailSize::Default, std::string(t_thumbnailDefault), 0, 0);
+        thumbnails.set(ThumbnailSize::High, std::string(t_thumbnailHigh), 0, 0);
+        thumbnails.set(ThumbnailSize::Medium, std::string(t_thumbnailMedium), 0, 0);
 
-        thumbs["default"] = thumbnailDefault;
-        thumbs["high"] = thumbnailHigh;
-        thumbs["medium"] = thumbnailMedium;
-
-        setThumbnails(thumbs);
+        setThumbnails(std::move(thumbnails));
 
         setIsSubscribedOnYoutube(t_subscribedOnYoutube);
         setHasSubscribedLocalOverride(t_subscribedLocalOverride);
@@ -134,20 +130,13 @@ namespace sane {
         setDescription(t_description);
 
         // Thumbnails
-        std::map<std::string, thumbnail_t> thumbs;
-        thumbnail_t thumbnailDefault;
-        thumbnail_t thumbnailHigh;
-        thumbnail_t thumbnailMedium;
-
-        thumbnailDefault.url = t_thumbnailDefault;
-        thumbnailHigh.url = t_thumbnailHigh;
-        thumbnailMedium.url = t_thumbnailMedium;
+        Thumbnails thumbnails;
 
-        thumbs["default"] = thumbnailDefault;
-        thumbs["high"] = thumbnailHigh;
-        thumbs["medium"] = thumbnailMedium;
+        thumbnails.set(ThumbnailSize::Default, t_thumbnailDefault, 0, 0);
+        thumbnails.set(ThumbnailSize::High, t_thumbnailHigh, 0, 0);
+        thumbnails.set(ThumbnailSize::Medium, t_thumbnailMedium, 0, 0);
 
-        setThumbnails(thumbs);
+        setThumbnails(std::move(thumbnails));
 
         setIsSubscribedOnYoutube(t_subscribedOnYoutube);
         setHasSubscribedLocalOverride(t_subscribedLocalOverride);
@@ -189,20 +178,13 @@ namespace sane {
         setDescription(std::string((const char *)t_map["Description"]));
 
         // Thumbnails
-        std::map<std::string, thumbnail_t> thumbs;
-        thumbnail_t thumbnailDefault;
-        thumbnail_t thumbnailHigh;
-        thumbnail_t thumbnailMedium;
-
-        thumbnailDefault.url = reinterpret_cast<const char *>(t_map["ThumbnailDefault"]);
-        thumbnailHigh.url = reinterpret_cast<const char *>(t_map["ThumbnailHigh"]);
-        thumbnailMedium.url = reinterpret_cast<const char *>(t_map["ThumbnailMedium"]);
+        Thumbnails thumbnails;
 
-        thumbs["default"] = thumbnailDefault;
-        thumbs["high"] = thumbnailHigh;
-        thumbs["medium"] = thumbnailMedium;
+        thumbnails.set(ThumbnailSize::Default, reinterpret_cast<const char *>(t_map["ThumbnailDefault"]), 0, 0);
+        thumbnails.set(ThumbnailSize::High, reinterpret_cast<const char *>(t_map["ThumbnailHigh"]), 0, 0);
+        thumbnails.set(ThumbnailSize::Medium, reinterpret_cast<const char *>(t_map["ThumbnailMedium"]), 0, 0);
 
-        setThumbnails(thumbs);
+        setThumbnails(std::move(thumbnails));
     }
 
     const std::string YoutubeChannel::getFavouritesPlaylist() {
@@ -241,16 +223,28 @@ namespace sane {
         return m_id;
     }
 
-    void YoutubeChannel::setId(const std::string &t_id) {
-        m_id = t_id;
+    void YoutubeChannel::setId(std::string t_id) {
+        m_id = std::move(t_id);
+
+        if (!ChannelId::tryParseBody(m_id, ChannelIdTag::Channel, m_packedId)) {
+            m_packedId = ChannelId();
+        }
+    }
+
+    const ChannelId &YoutubeChannel::getPackedId() const {
+        return m_packedId;
+    }
+
+    /**
+     * Same as getUploadsPlaylist(), packed: only swaps the tag of getPackedId(), no string is built.
+     */
+    ChannelId YoutubeChannel::getUploadsPlaylistId() const {
+        return m_packedId.withTag(ChannelIdTag::Uploads);
     }
 
-    void YoutubeChannel::setId(nlohmann::json t_id) {
+    void YoutubeChannel::setId(nlohmann::json &t_id) {
         if (t_id.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setId(getJsonStringValue(t_id, "setId", problems));
-            reportProblems(problems);
+            setId(takeJsonStringValue(t_id, "setId", m_diagnostics));
         }
     }
 
@@ -258,16 +252,13 @@ namespace sane {
         return m_description;
     }
 
-    void YoutubeChannel::setDescription(const std::string &t_description) {
-        m_description = t_description;
+    void YoutubeChannel::setDescription(std::string t_description) {
+        m_description = std::move(t_description);
     }
 
     void YoutubeChannel::setDescription(nlohmann::json &t_description) {
         if (t_description.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setDescription(getJsonStringValue(t_description, "setDescription", problems));
-            reportProblems(problems);
+            setDescription(takeJsonStringValue(t_description, "setDescription", m_diagnostics));
         }
     }
 
@@ -275,88 +266,70 @@ namespace sane {
         return m_publishedAt;
     }
 
-    void YoutubeChannel::setPublishedAt(const std::string &t_publishedAt) {
-        m_publishedAt = t_publishedAt;
+    void YoutubeChannel::setPublishedAt(std::string t_publishedAt) {
+        m_publishedAt = std::move(t_publishedAt);
     }
 
     void YoutubeChannel::setPublishedAt(nlohmann::json &t_publishedAt) {
         if (t_publishedAt.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setPublishedAt(getJsonStringValue(t_publishedAt, "setPublishedAt", problems));
-            reportProblems(problems);
+            setPublishedAt(takeJsonStringValue(t_publishedAt, "setPublishedAt", m_diagnostics));
         }
     }
 
-    const std::map<std::string, thumbnail_t> &YoutubeChannel::getThumbnails() const {
-        return m_thumbnails;
+    /**
+     * @return  The thumbnails keyed as in the "thumbnails" object, built on demand.
+     */
+    std::map<std::string, thumbnail_t> YoutubeChannel::getThumbnails() const {
+        return m_thumbnails.toMap();
     }
 
-    void YoutubeChannel::setThumbnails(const std::map<std::string, thumbnail_t> &t_thumbnails) {
-        m_thumbnails = t_thumbnails;
+    thumbnail_t YoutubeChannel::getThumbnail(ThumbnailSize t_size) const {
+        return m_thumbnails.get(t_size);
     }
 
-    void YoutubeChannel::setThumbnails(nlohmann::json &t_thumbnails) {
-        // Define variables.
-        std::map<std::string, thumbnail_t> thumbnails;
-
-        // Create each thumbnail struct.
-        thumbnail_t defaultThumbnail = thumbnail_t();
-        if (t_thumbnails["default"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
-
-            defaultThumbnail.url = getJsonStringValue(t_thumbnails["default"]["url"],
-                                                                    "setThumbnails [default]", problems);
-            reportProblems(problems);
-        }
+    const Thumbnails &YoutubeChannel::getPackedThumbnails() const {
+        return m_thumbnails;
+    }
 
-        thumbnail_t highThumbnail = thumbnail_t();
-        if (t_thumbnails["high"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
+    void YoutubeChannel::setThumbnails(const std::map<std::string, thumbnail_t> &t_thumbnails) {
+        Thumbnails thumbnails;
 
-            highThumbnail.url = getJsonStringValue(t_thumbnails["high"]["url"],
-                                                                 "setThumbnails [high]", problems);
-            reportProblems(problems);
+        for (auto const& thumbnail : t_thumbnails) {
+            ThumbnailSize size;
+            if (tryParseThumbnailKey(thumbnail.first, size)) {
+                thumbnails.set(size, thumbnail.second.url, thumbnail.second.width, thumbnail.second.height);
+            } else {
+                addWarning("setThumbnails: Ignoring thumbnail of unknown size '" + thumbnail.first + "'");
+            }
         }
 
-        thumbnail_t mediumThumbnail = thumbnail_t();
-        if (t_thumbnails["medium"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
-
-            mediumThumbnail.url = getJsonStringValue(t_thumbnails["medium"]["url"],
-                                                                   "setThumbnails [medium]", problems);
-            reportProblems(problems);
-        }
+        setThumbnails(std::move(thumbnails));
+    }
 
-        // Add thumbnail structs to map.
-        thumbnails["default"] = defaultThumbnail;
-        thumbnails["high"] = highThumbnail;
-        thumbnails["medium"] = mediumThumbnail;
+    void YoutubeChannel::setThumbnails(Thumbnails t_thumbnails) {
+        m_thumbnails = std::move(t_thumbnails);
+    }
 
-        // Finally assign the thumbnails map to the object property.
-        setThumbnails(thumbnails);
+    void YoutubeChannel::setThumbnails(nlohmann::json &t_thumbnails) {
+        setThumbnails(getThumbnailsFromJson(t_thumbnails, std::string(), m_diagnostics));
     }
 
     const std::string &YoutubeChannel::getTitle() const {
         return m_title;
     }
 
-    void YoutubeChannel::setTitle(const std::string &t_title) {
-        m_title = t_title;
+    void YoutubeChannel::setTitle(std::string t_title) {
+        m_title = std::move(t_title);
     }
 
     void YoutubeChannel::setTitle(nlohmann::json &t_title) {
         if (t_title.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setTitle(getJsonStringValue(t_title, "setTitle", problems));
-            reportProblems(problems);
+            setTitle(takeJsonStringValue(t_title, "setTitle", m_diagnostics));
         }
     }
 
     void YoutubeChannel::print(int indentationSpacing = 0) {
         std::string indentation(indentationSpacing, ' ');
-        std::map<std::string, thumbnail_t> thumbnails = getThumbnails();
 
         std::cout << indentation << "Title: " << getTitle() << std::endl;
         std::cout << indentation << "ID: " << getId() << std::endl;
@@ -366,64 +339,37 @@ namespace sane {
         std::cout << indentation << "Favourites Playlist: " << getFavouritesPlaylist() << std::endl;
         std::cout << indentation << "Uploads Playlist: " << getUploadsPlaylist() << std::endl;
 
-        std::cout << indentation << "Thumbnail URL (default): " << thumbnails["default"].url << std::endl;
-        std::cout << indentation << "Thumbnail URL (high): " << thumbnails["high"].url << std::endl;
-        std::cout << indentation << "Thumbnail URL (medium): " << thumbnails["medium"].url << std::endl;
+        std::cout << indentation << "Thumbnail URL (default): " << getThumbnail(ThumbnailSize::Default).url << std::endl;
+        std::cout << indentation << "Thumbnail URL (high): " << getThumbnail(ThumbnailSize::High).url << std::endl;
+        std::cout << indentation << "Thumbnail URL (medium): " << getThumbnail(ThumbnailSize::Medium).url << std::endl;
     }
 
-    void YoutubeChannel::addError(const std::string &t_errorMsg, nlohmann::json t_json) {
-        std::map<std::string, nlohmann::json> _;
-        _[t_errorMsg] = t_json;
-
-        m_errors.push_back(_);
+    void YoutubeChannel::addError(const std::string &t_errorMsg, const nlohmann::json &t_json) {
+        m_diagnostics.addMessage(DiagnosticSeverity::Error, t_errorMsg, t_json);
     }
 
-    void YoutubeChannel::addWarning(const std::string &t_warningMsg, nlohmann::json t_json) {
-        std::map<std::string, nlohmann::json> _;
-        _[t_warningMsg] = t_json;
-
-        m_warnings.push_back(_);
+    void YoutubeChannel::addWarning(const std::string &t_warningMsg, const nlohmann::json &t_json) {
+        m_diagnostics.addMessage(DiagnosticSeverity::Warning, t_warningMsg, t_json);
     }
 
-    void YoutubeChannel::reportProblems(std::map<std::string, std::string> &t_problems) {
-        if (!t_problems.empty()) {
-            addWarning(t_problems["warning"]);
-            addError(t_problems["error"]);
-        }
+    const Diagnostics &YoutubeChannel::getDiagnostics() const {
+        return m_diagnostics;
     }
 
-    std::list<std::map<std::string, nlohmann::json>> YoutubeChannel::getErrors() {
-        return m_errors;
+    size_t YoutubeChannel::getErrorCount() const {
+        return m_diagnostics.count(DiagnosticSeverity::Error);
     }
 
     void YoutubeChannel::printErrors(int indent, bool withJson, int jsonIndent) {
-        // For map in list
-        for (auto const& item : getErrors()) {
-            // For message, JSON in map
-            for (auto const& map : item) {
-                std::cout << std::string(indent, ' ') << map.first << std::endl;
-                if (withJson and !map.second.empty()) {
-                    std::cout << map.second.dump(jsonIndent) << std::endl;
-                }
-            }
-        }
+        m_diagnostics.print(DiagnosticSeverity::Error, indent, withJson, jsonIndent);
     }
 
-    std::list<std::map<std::string, nlohmann::json>> YoutubeChannel::getWarnings() {
-        return m_warnings;
+    size_t YoutubeChannel::getWarningCount() const {
+        return m_diagnostics.count(DiagnosticSeverity::Warning);
     }
 
     void YoutubeChannel::printWarnings(int indent, bool withJson, int jsonIndent) {
-        // For map in list
-        for (auto const& item : getWarnings()) {
-            // For message, JSON in map
-            for (auto const& map : item) {
-                std::cout << std::string(indent, ' ') << map.first << std::endl;
-                if (withJson and !map.second.empty()) {
-                    std::cout << map.second.dump(jsonIndent) << std::endl;
-                }
-            }
-        }
+        m_diagnostics.print(DiagnosticSeverity::Warning, indent, withJson, jsonIndent);
     }
 
     bool YoutubeChannel::wasAborted() {
@@ -431,16 +377,15 @@ namespace sane {
     }
 
     void YoutubeChannel::clearWarnings() {
-        m_warnings.clear();
+        m_diagnostics.clear(DiagnosticSeverity::Warning);
     }
 
     void YoutubeChannel::clearErrors() {
-        m_errors.clear();
+        m_diagnostics.clear(DiagnosticSeverity::Error);
     }
 
     void YoutubeChannel::clearErrorsAndWarnings() {
-        clearWarnings();
-        clearErrors();
+        m_diagnostics.clear();
     }
 
     bool YoutubeChannel::hasFavouritesPlaylist() {
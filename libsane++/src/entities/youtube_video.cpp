@@ -7,76 +7,56 @@ namespace sane {
     // An empty constructor if you want to populate it later.
     YoutubeVideo::YoutubeVideo() = default;
 
-    void YoutubeVideo::addError(const std::string &t_errorMsg, nlohmann::json t_json) {
-        std::map<std::string, nlohmann::json> _;
-        _[t_errorMsg] = t_json;
-
-        m_errors.push_back(_);
+    void YoutubeVideo::addError(const std::string &t_errorMsg, const nlohmann::json &t_json) {
+        m_diagnostics.addMessage(DiagnosticSeverity::Error, t_errorMsg, t_json);
     }
 
-    void YoutubeVideo::addWarning(const std::string &t_warningMsg, nlohmann::json t_json) {
-        std::map<std::string, nlohmann::json> _;
-        _[t_warningMsg] = t_json;
-
-        m_warnings.push_back(_);
+    void YoutubeVideo::addWarning(const std::string &t_warningMsg, const nlohmann::json &t_json) {
+        m_diagnostics.addMessage(DiagnosticSeverity::Warning, t_warningMsg, t_json);
     }
 
-    void YoutubeVideo::reportProblems(std::map<std::string, std::string> &t_problems) {
-        if (!t_problems.empty()) {
-            addWarning(t_problems["warning"]);
-            addError(t_problems["error"]);
-        }
+    const Diagnostics &YoutubeVideo::getDiagnostics() const {
+        return m_diagnostics;
     }
 
-    std::list<std::map<std::string, nlohmann::json>> YoutubeVideo::getErrors() {
-        return m_errors;
+    size_t YoutubeVideo::getErrorCount() const {
+        return m_diagnostics.count(DiagnosticSeverity::Error);
     }
 
     void YoutubeVideo::printErrors(int indent, bool withJson, int jsonIndent) {
-        // For map in list
-        for (auto const& item : getErrors()) {
-            // For message, JSON in map
-            for (auto const& map : item) {
-                std::cout << std::string(indent, ' ') << map.first << std::endl;
-                if (withJson and !map.second.empty()) {
-                    std::cout << map.second.dump(jsonIndent) << std::endl;
-                }
-            }
-        }
+        m_diagnostics.print(DiagnosticSeverity::Error, indent, withJson, jsonIndent);
     }
 
-    std::list<std::map<std::string, nlohmann::json>> YoutubeVideo::getWarnings() {
-        return m_warnings;
+    size_t YoutubeVideo::getWarningCount() const {
+        return m_diagnostics.count(DiagnosticSeverity::Warning);
     }
 
     void YoutubeVideo::printWarnings(int indent, bool withJson, int jsonIndent) {
-        // For map in list
-        for (auto const& item : getWarnings()) {
-            // For message, JSON in map
-            for (auto const& map : item) {
-                std::cout << std::string(indent, ' ') << map.first << std::endl;
-                if (withJson and !map.second.empty()) {
-                    std::cout << map.second.dump(jsonIndent) << std::endl;
-                }
-            }
-        }
+        m_diagnostics.print(DiagnosticSeverity::Warning, indent, withJson, jsonIndent);
     }
 
     bool YoutubeVideo::wasAborted() {
         return m_aborted;
     }
 
+    bool YoutubeVideo::hasPart(VideoPart t_part) const {
+        return m_parts.has(t_part);
+    }
+
+    VideoParts YoutubeVideo::getParts() const {
+        return m_parts;
+    }
+
     void YoutubeVideo::clearWarnings() {
-        m_warnings.clear();
+        m_diagnostics.clear(DiagnosticSeverity::Warning);
     }
 
     void YoutubeVideo::clearErrors() {
-        m_errors.clear();
+        m_diagnostics.clear(DiagnosticSeverity::Error);
     }
 
     void YoutubeVideo::clearErrorsAndWarnings() {
-        clearWarnings();
-        clearErrors();
+        m_diagnostics.clear();
     }
 
     // START: Getters & Setters.
@@ -84,16 +64,13 @@ namespace sane {
         return m_id;
     }
 
-    void YoutubeVideo::setId(const std::string &t_id) {
-        m_id = t_id;
+    void YoutubeVideo::setId(std::string t_id) {
+        m_id = std::move(t_id);
     }
 
-    void YoutubeVideo::setId(nlohmann::json t_id) {
+    void YoutubeVideo::setId(nlohmann::json &t_id) {
         if (t_id.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setId(getJsonStringValue(t_id, "setId", problems));
-            reportProblems(problems);
+            setId(takeJsonStringValue(t_id, "setId", m_diagnostics));
         }
     }
 
@@ -111,10 +88,7 @@ namespace sane {
 
     void YoutubeVideo::setPublishedAt(nlohmann::json &t_publishedAt) {
         if (t_publishedAt.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setPublishedAt(getJsonStringValue(t_publishedAt, "setPublishedAt", problems));
-            reportProblems(problems);
+            setPublishedAt(takeJsonStringValue(t_publishedAt, "setPublishedAt", m_diagnostics));
         }
     }
 
@@ -123,15 +97,12 @@ namespace sane {
     }
 
     void YoutubeVideo::setChannelId(const std::string &t_channelId) {
-        m_channelId = t_channelId;
+        m_channelId = internString(t_channelId);
     }
 
     void YoutubeVideo::setChannelId(nlohmann::json &t_channelId) {
         if (t_channelId.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setChannelId(getJsonStringValue(t_channelId, "setChannelId", problems));
-            reportProblems(problems);
+            setChannelId(takeJsonStringValue(t_channelId, "setChannelId", m_diagnostics));
         }
     }
 
@@ -139,16 +110,13 @@ namespace sane {
         return m_title;
     }
 
-    void YoutubeVideo::setTitle(const std::string &t_title) {
-        m_title = t_title;
+    void YoutubeVideo::setTitle(std::string t_title) {
+        m_title = std::move(t_title);
     }
 
     void YoutubeVideo::setTitle(nlohmann::json &t_title) {
         if (t_title.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setTitle(getJsonStringValue(t_title, "setTitle", problems));
-            reportProblems(problems);
+            setTitle(takeJsonStringValue(t_title, "setTitle", m_diagnostics));
         }
     }
 
@@ -156,96 +124,52 @@ namespace sane {
         return m_description;
     }
 
-    void YoutubeVideo::setDescription(const std::string &t_description) {
-        m_description = t_description;
+    void YoutubeVideo::setDescription(std::string t_description) {
+        m_description = std::move(t_description);
     }
 
     void YoutubeVideo::setDescription(nlohmann::json &t_description) {
         if (t_description.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setDescription(getJsonStringValue(t_description, "setDescription", problems));
-            reportProblems(problems);
+            setDescription(takeJsonStringValue(t_description, "setDescription", m_diagnostics));
         }
     }
 
-    const std::map<std::string, thumbnail_t> &YoutubeVideo::getThumbnails() const {
-        return m_thumbnails;
+    /**
+     * @return  The thumbnails keyed as in the "thumbnails" object, built on demand.
+     */
+    std::map<std::string, thumbnail_t> YoutubeVideo::getThumbnails() const {
+        return m_thumbnails.toMap(m_id);
     }
 
-    void YoutubeVideo::setThumbnails(const std::map<std::string, thumbnail_t> &t_thumbnails) {
-        m_thumbnails = t_thumbnails;
+    thumbnail_t YoutubeVideo::getThumbnail(ThumbnailSize t_size) const {
+        return m_thumbnails.get(t_size, m_id);
     }
 
-    void YoutubeVideo::setThumbnails(nlohmann::json &t_thumbnails) {
-        // Define variables.
-        std::map<std::string, thumbnail_t> thumbnails;
-
-        // Create each thumbnail struct.
-        thumbnail_t defaultThumbnail;
-        if (t_thumbnails["default"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
-
-            defaultThumbnail.url = getJsonStringValue(t_thumbnails["default"]["url"],
-                                                                     "setThumbnails [default]", problems);
-            reportProblems(problems);
-        }
-        defaultThumbnail.height  = t_thumbnails["default"]["height"].get<unsigned int>();
-        defaultThumbnail.width   = t_thumbnails["default"]["width"].get<unsigned int>();
-
-        thumbnail_t highThumbnail;
-        if (t_thumbnails["high"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
-
-            highThumbnail.url = getJsonStringValue(t_thumbnails["high"]["url"],
-                                                                    "setThumbnails [high]", problems);
-            reportProblems(problems);
-        }
-        highThumbnail.height     = t_thumbnails["high"]["height"].get<unsigned int>();
-        highThumbnail.width      = t_thumbnails["high"]["width"].get<unsigned int>();
-
-        thumbnail_t mediumThumbnail;
-        if (t_thumbnails["medium"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
-
-            mediumThumbnail.url = getJsonStringValue(t_thumbnails["medium"]["url"],
-                                                                 "setThumbnails [medium]", problems);
-            reportProblems(problems);
-        }
-        mediumThumbnail.height   = t_thumbnails["medium"]["height"].get<unsigned int>();
-        mediumThumbnail.width    = t_thumbnails["medium"]["width"].get<unsigned int>();
+    const Thumbnails &YoutubeVideo::getPackedThumbnails() const {
+        return m_thumbnails;
+    }
 
-        thumbnail_t standardThumbnail;
-        if (t_thumbnails["standard"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
+    void YoutubeVideo::setThumbnails(const std::map<std::string, thumbnail_t> &t_thumbnails) {
+        Thumbnails thumbnails;
 
-            standardThumbnail.url = getJsonStringValue(t_thumbnails["standard"]["url"],
-                                                                 "setThumbnails [standard]", problems);
-            reportProblems(problems);
+        for (auto const& thumbnail : t_thumbnails) {
+            ThumbnailSize size;
+            if (tryParseThumbnailKey(thumbnail.first, size)) {
+                thumbnails.set(size, thumbnail.second.url, thumbnail.second.width, thumbnail.second.height, m_id);
+            } else {
+                addWarning("setThumbnails: Ignoring thumbnail of unknown size '" + thumbnail.first + "'");
+            }
         }
-        standardThumbnail.height = t_thumbnails["standard"]["height"].get<unsigned int>();
-        standardThumbnail.width  = t_thumbnails["standard"]["width"].get<unsigned int>();
 
-        thumbnail_t maxresThumbnail;
-        if (t_thumbnails["maxres"]["url"].is_string()) {
-            std::map<std::string, std::string> problems;
-
-            maxresThumbnail.url = getJsonStringValue(t_thumbnails["maxres"]["url"],
-                                                                 "setThumbnails [maxres]", problems);
-            reportProblems(problems);
-        }
-        maxresThumbnail.height  = t_thumbnails["maxres"]["height"].get<unsigned int>();
-        maxresThumbnail.width   = t_thumbnails["maxres"]["width"].get<unsigned int>();
+        setThumbnails(std::move(thumbnails));
+    }
 
-        // Add thumbnail structs to map.
-        thumbnails["default"] = defaultThumbnail;
-        thumbnails["high"] = highThumbnail;
-        thumbnails["medium"] = mediumThumbnail;
-        thumbnails["standard"] = standardThumbnail;
-        thumbnails["maxres"] = maxresThumbnail;
+    void YoutubeVideo::setThumbnails(Thumbnails t_thumbnails) {
+        m_thumbnails = std::move(t_thumbnails);
+    }
 
-        // Finally assign the thumbnails map to the object property.
-        setThumbnails(thumbnails);
+    void YoutubeVideo::setThumbnails(nlohmann::json &t_thumbnails) {
+        setThumbnails(getThumbnailsFromJson(t_thumbnails, m_id, m_diagnostics));
     }
 
     const std::string &YoutubeVideo::getChannelTitle() const {
@@ -253,42 +177,44 @@ namespace sane {
     }
 
     void YoutubeVideo::setChannelTitle(const std::string &t_channelTitle) {
-        m_channelTitle = t_channelTitle;
+        m_channelTitle = internString(t_channelTitle);
     }
 
     void YoutubeVideo::setChannelTitle(nlohmann::json &t_channelTitle) {
         if (t_channelTitle.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setChannelTitle(getJsonStringValue(t_channelTitle, "setChannelTitle", problems));
-            reportProblems(problems);
+            setChannelTitle(takeJsonStringValue(t_channelTitle, "setChannelTitle", m_diagnostics));
         }
     }
 
-    const std::list<std::string> &YoutubeVideo::getTags() const {
+    const std::vector<InternedString> &YoutubeVideo::getTags() const {
         return m_tags;
     }
 
-    void YoutubeVideo::setTags(const std::list<std::string> &t_tags) {
-        m_tags = t_tags;
+    void YoutubeVideo::setTags(const std::vector<std::string> &t_tags) {
+        m_tags.clear();
+        m_tags.reserve(t_tags.size());
+
+        for (const std::string &tag : t_tags) {
+            m_tags.push_back(internString(tag));
+        }
     }
 
     void YoutubeVideo::setTags(nlohmann::json &t_tags) {
-        std::list<std::string> tags;
-
         if (t_tags.empty()) {
             return;
         }
 
+        m_tags.clear();
+        m_tags.reserve(t_tags.size());
+
+        // Intern straight from the JSON, the pool only copies tags it hasn't seen before.
         for (const nlohmann::json &tag : t_tags) {
             if (tag.is_string()) {
-                tags.push_back(tag.get<std::string>());
+                m_tags.push_back(internString(tag.get_ref<const std::string &>()));
             } else {
                 addError("setTags: non-string (" + std::string(tag.type_name()) + "): " + tag.dump());
             }
         }
-
-        setTags(tags);
     }
 
     const std::string &YoutubeVideo::getCategoryId() const {
@@ -296,15 +222,12 @@ namespace sane {
     }
 
     void YoutubeVideo::setCategoryId(const std::string &t_categoryId) {
-        m_categoryId = t_categoryId;
+        m_categoryId = internString(t_categoryId);
     }
 
     void YoutubeVideo::setCategoryId(nlohmann::json &t_categoryId) {
         if (t_categoryId.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setCategoryId(getJsonStringValue(t_categoryId, "setCategoryId", problems));
-            reportProblems(problems);
+            setCategoryId(takeJsonStringValue(t_categoryId, "setCategoryId", m_diagnostics));
         }
     }
 
@@ -313,16 +236,13 @@ namespace sane {
     }
 
     void YoutubeVideo::setLiveBroadcastContent(const std::string &t_liveBroadcastContent) {
-        m_liveBroadcastContent = t_liveBroadcastContent;
+        m_liveBroadcastContent = internString(t_liveBroadcastContent);
     }
 
     void YoutubeVideo::setLiveBroadcastContent(nlohmann::json &t_liveBroadcastContent) {
         if (t_liveBroadcastContent.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setLiveBroadcastContent(getJsonStringValue(t_liveBroadcastContent, "setLiveBroadcastContent",
-                                                                     problems));
-            reportProblems(problems);
+            setLiveBroadcastContent(takeJsonStringValue(t_liveBroadcastContent, "setLiveBroadcastContent",
+                                                                     m_diagnostics));
         }
     }
 
@@ -331,15 +251,12 @@ namespace sane {
     }
 
     void YoutubeVideo::setDefaultLanguage(const std::string &t_defaultLanguage) {
-        m_defaultLanguage = t_defaultLanguage;
+        m_defaultLanguage = internString(t_defaultLanguage);
     }
 
     void YoutubeVideo::setDefaultLanguage(nlohmann::json &t_defaultLanguage) {
         if (t_defaultLanguage.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setDefaultLanguage(getJsonStringValue(t_defaultLanguage, "setDefaultLanguage", problems));
-            reportProblems(problems);
+            setDefaultLanguage(takeJsonStringValue(t_defaultLanguage, "setDefaultLanguage", m_diagnostics));
         }
     }
 
@@ -347,16 +264,13 @@ namespace sane {
         return m_localizedTitle;
     }
 
-    void YoutubeVideo::setLocalizedTitle(const std::string &t_localizedTitle) {
-        m_localizedTitle = t_localizedTitle;
+    void YoutubeVideo::setLocalizedTitle(std::string t_localizedTitle) {
+        m_localizedTitle = std::move(t_localizedTitle);
     }
 
     void YoutubeVideo::setLocalizedTitle(nlohmann::json &t_localizedTitle) {
         if (t_localizedTitle.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setLocalizedTitle(getJsonStringValue(t_localizedTitle, "setLocalizedTitle", problems));
-            reportProblems(problems);
+            setLocalizedTitle(takeJsonStringValue(t_localizedTitle, "setLocalizedTitle", m_diagnostics));
         }
     }
 
@@ -364,17 +278,14 @@ namespace sane {
         return m_localizedDescription;
     }
 
-    void YoutubeVideo::setLocalizedDescription(const std::string &t_localizedDescription) {
-        m_localizedDescription = t_localizedDescription;
+    void YoutubeVideo::setLocalizedDescription(std::string t_localizedDescription) {
+        m_localizedDescription = std::move(t_localizedDescription);
     }
 
     void YoutubeVideo::setLocalizedDescription(nlohmann::json &t_localizedDescription) {
         if (t_localizedDescription.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setLocalizedDescription(getJsonStringValue(t_localizedDescription, "setLocalizedDescription",
-                                                                     problems));
-            reportProblems(problems);
+            setLocalizedDescription(takeJsonStringValue(t_localizedDescription, "setLocalizedDescription",
+                                                                     m_diagnostics));
         }
     }
 
@@ -383,16 +294,13 @@ namespace sane {
     }
 
     void YoutubeVideo::setDefaultAudioLanguage(const std::string &t_defaultAudioLanguage) {
-        m_defaultAudioLanguage = t_defaultAudioLanguage;
+        m_defaultAudioLanguage = internString(t_defaultAudioLanguage);
     }
 
     void YoutubeVideo::setDefaultAudioLanguage(nlohmann::json &t_defaultAudioLanguage) {
         if (t_defaultAudioLanguage.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setDefaultAudioLanguage(getJsonStringValue(t_defaultAudioLanguage, "setDefaultAudioLanguage",
-                                                                     problems));
-            reportProblems(problems);
+            setDefaultAudioLanguage(takeJsonStringValue(t_defaultAudioLanguage, "setDefaultAudioLanguage",
+                                                                     m_diagnostics));
         }
     }
 
@@ -400,23 +308,20 @@ namespace sane {
         return m_duration;
     }
 
-    void YoutubeVideo::setDuration(const std::string &t_duration) {
-        m_duration = t_duration;
+    void YoutubeVideo::setDuration(std::string t_duration) {
+        m_duration = std::move(t_duration);
     }
 
     void YoutubeVideo::setDuration(nlohmann::json &t_duration) {
         if (t_duration.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setDuration(getJsonStringValue(t_duration, "setDuration", problems));
-            reportProblems(problems);
+            setDuration(takeJsonStringValue(t_duration, "setDuration", m_diagnostics));
         }
     }
 
     void YoutubeVideo::setDimension(nlohmann::json &t_dimension) {
         // Determine is video is 2D or 3D;
         if (!t_dimension.empty() and t_dimension.is_string()) {
-            std::string dimension = t_dimension.get<std::string>();
+            const std::string &dimension = t_dimension.get_ref<const std::string &>();
 
             if (dimension == "2d") {
                 setIs2D(true);
@@ -450,7 +355,7 @@ namespace sane {
     void YoutubeVideo::setDefinition(nlohmann::json &t_definition) {
         // Determine is video is 2D or 3D;
         if (!t_definition.empty() and t_definition.is_string()) {
-            std::string definition = t_definition.get<std::string>();
+            const std::string &definition = t_definition.get_ref<const std::string &>();
 
             if (definition == "hd") {
                 setIsHD(true);
@@ -481,10 +386,7 @@ namespace sane {
 
     void YoutubeVideo::setHasCaptions(nlohmann::json &t_hasCaptions) {
         if (isBool(t_hasCaptions)) {
-            std::map<std::string, std::string> problems;
-            
-            setHasCaptions(getJsonBoolValue(t_hasCaptions, "setHasCaptions", problems));
-            reportProblems(problems);
+            setHasCaptions(getJsonBoolValue(t_hasCaptions, "setHasCaptions", m_diagnostics));
         }
     }
 
@@ -498,53 +400,52 @@ namespace sane {
 
     void YoutubeVideo::setIsLicensedContent(nlohmann::json &t_isLicensedContent) {
         if (isBool(t_isLicensedContent)) {
-            std::map<std::string, std::string> problems;
-            
-            setIsLicensedContent(getJsonBoolValue(t_isLicensedContent, "setIsLicensedContent", problems));
-            reportProblems(problems);
+            setIsLicensedContent(getJsonBoolValue(t_isLicensedContent, "setIsLicensedContent", m_diagnostics));
         }
     }
 
-    const std::list<std::string> &YoutubeVideo::getRegionRestrictionWhitelist() const {
+    const std::vector<std::string> &YoutubeVideo::getRegionRestrictionWhitelist() const {
         return m_regionRestrictionWhitelist;
     }
 
-    void YoutubeVideo::setRegionRestrictionWhitelist(const std::list<std::string> &t_regionRestrictionWhitelist) {
-        m_regionRestrictionWhitelist = t_regionRestrictionWhitelist;
+    void YoutubeVideo::setRegionRestrictionWhitelist(std::vector<std::string> t_regionRestrictionWhitelist) {
+        m_regionRestrictionWhitelist = std::move(t_regionRestrictionWhitelist);
     }
 
     void YoutubeVideo::setRegionRestrictionWhitelist(nlohmann::json &t_regionRestrictionWhitelist) {
-        std::list<std::string> whitelist;
+        std::vector<std::string> whitelist;
+        whitelist.reserve(t_regionRestrictionWhitelist.size());
 
-        for (const nlohmann::json& countryCode : t_regionRestrictionWhitelist) {
-            whitelist.push_back(countryCode.get<std::string>());
+        for (nlohmann::json &countryCode : t_regionRestrictionWhitelist) {
+            whitelist.push_back(std::move(countryCode.get_ref<std::string &>()));
         }
 
-        setRegionRestrictionWhitelist(whitelist);
+        setRegionRestrictionWhitelist(std::move(whitelist));
     }
 
-    const std::list<std::string> &YoutubeVideo::getRegionRestrictionBlacklist() const {
+    const std::vector<std::string> &YoutubeVideo::getRegionRestrictionBlacklist() const {
         return m_regionRestrictionBlacklist;
     }
 
-    void YoutubeVideo::setRegionRestrictionBlacklist(const std::list<std::string> &t_regionRestrictionBlacklist) {
-        m_regionRestrictionBlacklist = t_regionRestrictionBlacklist;
+    void YoutubeVideo::setRegionRestrictionBlacklist(std::vector<std::string> t_regionRestrictionBlacklist) {
+        m_regionRestrictionBlacklist = std::move(t_regionRestrictionBlacklist);
     }
 
     void YoutubeVideo::setRegionRestrictionBlacklist(nlohmann::json &t_regionRestrictionBlacklist) {
-        std::list<std::string> blacklist;
+        std::vector<std::string> blacklist;
+        blacklist.reserve(t_regionRestrictionBlacklist.size());
 
-        for (const nlohmann::json& countryCode : t_regionRestrictionBlacklist) {
-            blacklist.push_back(countryCode.get<std::string>());
+        for (nlohmann::json &countryCode : t_regionRestrictionBlacklist) {
+            blacklist.push_back(std::move(countryCode.get_ref<std::string &>()));
         }
 
-        setRegionRestrictionBlacklist(blacklist);
+        setRegionRestrictionBlacklist(std::move(blacklist));
     }
 
     void YoutubeVideo::setProjection(nlohmann::json &t_projection) {
         // Determine is video is rectangular or 360 degrees.
         if (!t_projection.empty() and t_projection.is_string()) {
-            std::string definition = t_projection.get<std::string>();
+            const std::string &definition = t_projection.get_ref<const std::string &>();
 
             if (definition == "rectangular") {
                 setIsRectanguar(true);
@@ -585,10 +486,7 @@ namespace sane {
 
     void YoutubeVideo::setHasCustomThumbnail(nlohmann::json &t_hasCustomThumbnail) {
         if (isBool(t_hasCustomThumbnail)) {
-            std::map<std::string, std::string> problems;
-            
-            setHasCustomThumbnail(getJsonBoolValue(t_hasCustomThumbnail, "setHasCustomThumbnail", problems));
-            reportProblems(problems);
+            setHasCustomThumbnail(getJsonBoolValue(t_hasCustomThumbnail, "setHasCustomThumbnail", m_diagnostics));
         }
     }
 
@@ -597,15 +495,12 @@ namespace sane {
     }
 
     void YoutubeVideo::setUploadStatus(const std::string &t_uploadStatus) {
-        m_uploadStatus = t_uploadStatus;
+        m_uploadStatus = internString(t_uploadStatus);
     }
 
     void YoutubeVideo::setUploadStatus(nlohmann::json &t_uploadStatus) {
         if (t_uploadStatus.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setUploadStatus(getJsonStringValue(t_uploadStatus, "setUploadStatus", problems));
-            reportProblems(problems);
+            setUploadStatus(takeJsonStringValue(t_uploadStatus, "setUploadStatus", m_diagnostics));
         }
     }
 
@@ -613,16 +508,13 @@ namespace sane {
         return m_failureReason;
     }
 
-    void YoutubeVideo::setFailureReason(const std::string &t_failureReason) {
-        m_failureReason = t_failureReason;
+    void YoutubeVideo::setFailureReason(std::string t_failureReason) {
+        m_failureReason = std::move(t_failureReason);
     }
 
     void YoutubeVideo::setFailureReason(nlohmann::json &t_failureReason) {
         if (t_failureReason.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setFailureReason(getJsonStringValue(t_failureReason, "setFailureReason", problems));
-            reportProblems(problems);
+            setFailureReason(takeJsonStringValue(t_failureReason, "setFailureReason", m_diagnostics));
         }
     }
 
@@ -630,16 +522,13 @@ namespace sane {
         return m_rejectionReason;
     }
 
-    void YoutubeVideo::setRejectionReason(const std::string &t_rejectionReason) {
-        m_rejectionReason = t_rejectionReason;
+    void YoutubeVideo::setRejectionReason(std::string t_rejectionReason) {
+        m_rejectionReason = std::move(t_rejectionReason);
     }
 
     void YoutubeVideo::setRejectionReason(nlohmann::json &t_rejectionReason) {
         if (t_rejectionReason.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setRejectionReason(getJsonStringValue(t_rejectionReason, "setRejectionReason", problems));
-            reportProblems(problems);
+            setRejectionReason(takeJsonStringValue(t_rejectionReason, "setRejectionReason", m_diagnostics));
         }
     }
 
@@ -648,15 +537,12 @@ namespace sane {
     }
 
     void YoutubeVideo::setPrivacyStatus(const std::string &t_privacyStatus) {
-        m_privacyStatus = t_privacyStatus;
+        m_privacyStatus = internString(t_privacyStatus);
     }
 
     void YoutubeVideo::setPrivacyStatus(nlohmann::json &t_privacyStatus) {
         if (t_privacyStatus.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setPrivacyStatus(getJsonStringValue(t_privacyStatus, "setPrivacyStatus", problems));
-            reportProblems(problems);
+            setPrivacyStatus(takeJsonStringValue(t_privacyStatus, "setPrivacyStatus", m_diagnostics));
         }
     }
 
@@ -664,16 +550,13 @@ namespace sane {
         return m_publishAt;
     }
 
-    void YoutubeVideo::setPublishAt(const std::string &t_publishAt) {
-        m_publishAt = t_publishAt;
+    void YoutubeVideo::setPublishAt(std::string t_publishAt) {
+        m_publishAt = std::move(t_publishAt);
     }
 
     void YoutubeVideo::setPublishAt(nlohmann::json &t_publishAt) {
         if (t_publishAt.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setPublishAt(getJsonStringValue(t_publishAt, "setPublishAt", problems));
-            reportProblems(problems);
+            setPublishAt(takeJsonStringValue(t_publishAt, "setPublishAt", m_diagnostics));
         }
     }
 
@@ -682,15 +565,12 @@ namespace sane {
     }
 
     void YoutubeVideo::setLicense(const std::string &t_license) {
-        m_license = t_license;
+        m_license = internString(t_license);
     }
 
     void YoutubeVideo::setLicense(nlohmann::json &t_license) {
         if (t_license.is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            setLicense(getJsonStringValue(t_license, "setLicense", problems));
-            reportProblems(problems);
+            setLicense(takeJsonStringValue(t_license, "setLicense", m_diagnostics));
         }
     }
 
@@ -704,9 +584,7 @@ namespace sane {
 
     void YoutubeVideo::setIsEmbeddable(nlohmann::json &t_isEmbeddable) {
         if (isBool(t_isEmbeddable)) {
-            std::map<std::string, std::string> problems;
-            setIsEmbeddable(getJsonBoolValue(t_isEmbeddable, "setIsEmbeddable", problems));
-            reportProblems(problems);
+            setIsEmbeddable(getJsonBoolValue(t_isEmbeddable, "setIsEmbeddable", m_diagnostics));
         }
     }
 
@@ -720,10 +598,8 @@ namespace sane {
 
     void YoutubeVideo::setPublicStatsViewable(nlohmann::json &t_isPublicStatsViewable) {
         if (isBool(t_isPublicStatsViewable)) {
-            std::map<std::string, std::string> problems;
             setPublicStatsViewable(getJsonBoolValue(t_isPublicStatsViewable, "setPublicStatsViewable",
-                                                                  problems));
-            reportProblems(problems);
+                                                                  m_diagnostics));
         }
     }
 
@@ -737,10 +613,7 @@ namespace sane {
 
     void YoutubeVideo::setViewCount(nlohmann::json &t_viewCount) {
         if (isDigits(t_viewCount)) {
-            std::map<std::string, std::string> problems;
-            
-            setViewCount(getJsonULongValue(t_viewCount, "setViewCount", problems));
-            reportProblems(problems);
+            setViewCount(getJsonULongValue(t_viewCount, "setViewCount", m_diagnostics));
         }
     }
 
@@ -754,10 +627,7 @@ namespace sane {
 
     void YoutubeVideo::setLikeCount(nlohmann::json &t_likeCount) {
         if (isDigits(t_likeCount)) {
-            std::map<std::string, std::string> problems;
-            
-            setLikeCount(getJsonULongValue(t_likeCount, "setLikeCount", problems));
-            reportProblems(problems);
+            setLikeCount(getJsonULongValue(t_likeCount, "setLikeCount", m_diagnostics));
         }
     }
 
@@ -771,10 +641,7 @@ namespace sane {
 
     void YoutubeVideo::setDislikeCount(nlohmann::json &t_dislikeCount) {
         if (isDigits(t_dislikeCount)) {
-            std::map<std::string, std::string> problems;
-            
-            setDislikeCount(getJsonULongValue(t_dislikeCount, "setDislikeCount", problems));
-            reportProblems(problems);
+            setDislikeCount(getJsonULongValue(t_dislikeCount, "setDislikeCount", m_diagnostics));
         }
     }
 
@@ -788,10 +655,7 @@ namespace sane {
 
     void YoutubeVideo::setCommentCount(nlohmann::json &t_commentCount) {
         if (isDigits(t_commentCount)) {
-            std::map<std::string, std::string> problems;
-            
-            setCommentCount(getJsonULongValue(t_commentCount, "setCommentCount", problems));
-            reportProblems(problems);
+            setCommentCount(getJsonULongValue(t_commentCount, "setCommentCount", m_diagnostics));
         }
     }
 
@@ -799,27 +663,21 @@ namespace sane {
         return m_player;
     }
 
-    void YoutubeVideo::setPlayer(const player_t &t_player) {
-        m_player = t_player;
+    void YoutubeVideo::setPlayer(player_t t_player) {
+        m_player = std::move(t_player);
     }
 
     void YoutubeVideo::setPlayer(nlohmann::json &t_player) {
         player_t player = player_t();
 
         if (t_player["embedHtml"].is_string()) {
-            std::map<std::string, std::string> problems;
-            
-            player.embedHtml = getJsonStringValue(t_player["embedHtml"], "setPlayer [embedHtml]", problems);
-            reportProblems(problems);
+            player.embedHtml = takeJsonStringValue(t_player["embedHtml"], "setPlayer [embedHtml]", m_diagnostics);
         }
 
         if (t_player.find("embedWidth") != t_player.end()) {
-            nlohmann::json embedWidth = t_player["embedWidth"];
+            nlohmann::json &embedWidth = t_player["embedWidth"];
             if (isDigits(embedWidth)) {
-                std::map<std::string, std::string> problems;
-
-                player.embedWidth = getJsonLongValue(embedWidth, "setPlayer [embedWidth]", problems);
-                reportProblems(problems);
+                player.embedWidth = getJsonLongValue(embedWidth, "setPlayer [embedWidth]", m_diagnostics);
             } else {
                 addError("Player: Attempted to set non-long embedWidth! Type: " +
                          std::string(embedWidth.type_name()) + ", Value: " + embedWidth.dump(), embedWidth);
@@ -827,53 +685,48 @@ namespace sane {
         }
 
         if (t_player.find("embedHeight") != t_player.end()) {
-            nlohmann::json embedHeight = t_player["embedHeight"];
+            nlohmann::json &embedHeight = t_player["embedHeight"];
             if (isDigits(embedHeight)) {
-                std::map<std::string, std::string> problems;
-
-                player.embedHeight = getJsonLongValue(embedHeight, "setPlayer [embedHeight]", problems);
-                reportProblems(problems);
+                player.embedHeight = getJsonLongValue(embedHeight, "setPlayer [embedHeight]", m_diagnostics);
             } else {
                 addError("Player: Attempted to set non-long embedHeight! Type: " +
                          std::string(embedHeight.type_name()) + ", Value: " + embedHeight.dump(), embedHeight);
             }
         }
 
-        setPlayer(player);
+        setPlayer(std::move(player));
     }
 
-    const std::list<std::string> &YoutubeVideo::getTopicCategories() const {
+    const std::vector<std::string> &YoutubeVideo::getTopicCategories() const {
         return m_topicCategories;
     }
 
-    void YoutubeVideo::setTopicCategories(const std::list<std::string> &t_topicCategories) {
-        m_topicCategories = t_topicCategories;
+    void YoutubeVideo::setTopicCategories(std::vector<std::string> t_topicCategories) {
+        m_topicCategories = std::move(t_topicCategories);
     }
 
     void YoutubeVideo::setTopicCategories(nlohmann::json &t_topicCategories) {
-        std::list<std::string> categories;
+        std::vector<std::string> categories;
+        categories.reserve(t_topicCategories.size());
 
-        for (auto const& category : t_topicCategories) {
-            categories.push_back(category.get<std::string>());
+        for (nlohmann::json &category : t_topicCategories) {
+            categories.push_back(std::move(category.get_ref<std::string &>()));
         }
 
-        setTopicCategories(categories);
+        setTopicCategories(std::move(categories));
     }
 
     const std::string &YoutubeVideo::getRecordingDate() const {
         return m_recordingDate;
     }
 
-    void YoutubeVideo::setRecordingDate(const std::string &t_recordingDate) {
-        m_recordingDate = t_recordingDate;
+    void YoutubeVideo::setRecordingDate(std::string t_recordingDate) {
+        m_recordingDate = std::move(t_recordingDate);
     }
 
     void YoutubeVideo::setRecordingDate(nlohmann::json &t_recordingDate) {
         if (t_recordingDate.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setRecordingDate(getJsonStringValue(t_recordingDate, "setRecordingDate", problems));
-            reportProblems(problems);
+            setRecordingDate(takeJsonStringValue(t_recordingDate, "setRecordingDate", m_diagnostics));
         }
 
     }
@@ -882,16 +735,13 @@ namespace sane {
         return m_fileName;
     }
 
-    void YoutubeVideo::setFileName(const std::string &t_fileName) {
-        m_fileName = t_fileName;
+    void YoutubeVideo::setFileName(std::string t_fileName) {
+        m_fileName = std::move(t_fileName);
     }
 
     void YoutubeVideo::setFileName(nlohmann::json &t_fileName) {
         if (t_fileName.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setFileName(getJsonStringValue(t_fileName, "setFileName", problems));
-            reportProblems(problems);
+            setFileName(takeJsonStringValue(t_fileName, "setFileName", m_diagnostics));
         }
     }
 
@@ -905,10 +755,7 @@ namespace sane {
 
     void YoutubeVideo::setFileSize(nlohmann::json &t_fileSize) {
         if (isDigits(t_fileSize)) {
-            std::map<std::string, std::string> problems;
-
-            setFileSize(getJsonULongValue(t_fileSize, "setFileSize", problems));
-            reportProblems(problems);
+            setFileSize(getJsonULongValue(t_fileSize, "setFileSize", m_diagnostics));
         }
     }
 
@@ -916,16 +763,13 @@ namespace sane {
         return m_fileType;
     }
 
-    void YoutubeVideo::setFileType(const std::string &t_fileType) {
-        m_fileType = t_fileType;
+    void YoutubeVideo::setFileType(std::string t_fileType) {
+        m_fileType = std::move(t_fileType);
     }
 
     void YoutubeVideo::setFileType(nlohmann::json &t_fileType) {
         if (t_fileType.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setFileType(getJsonStringValue(t_fileType, "setFileType", problems));
-            reportProblems(problems);
+            setFileType(takeJsonStringValue(t_fileType, "setFileType", m_diagnostics));
         }
     }
 
@@ -933,132 +777,112 @@ namespace sane {
         return m_container;
     }
 
-    void YoutubeVideo::setContainer(const std::string &t_container) {
-        m_container = t_container;
+    void YoutubeVideo::setContainer(std::string t_container) {
+        m_container = std::move(t_container);
     }
 
     void YoutubeVideo::setContainer(nlohmann::json &t_container) {
         if (t_container.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setContainer(getJsonStringValue(t_container, "setContainer", problems));
-            reportProblems(problems);
+            setContainer(takeJsonStringValue(t_container, "setContainer", m_diagnostics));
         }
     }
 
-    const std::list<videoStream_t> &YoutubeVideo::getVideoStreams() const {
+    const std::vector<videoStream_t> &YoutubeVideo::getVideoStreams() const {
         return m_videoStreams;
     }
 
-    void YoutubeVideo::setVideoStreams(const std::list<videoStream_t> &t_videoStreams) {
-        m_videoStreams = t_videoStreams;
+    void YoutubeVideo::setVideoStreams(std::vector<videoStream_t> t_videoStreams) {
+        m_videoStreams = std::move(t_videoStreams);
     }
 
     void YoutubeVideo::setVideoStreams(nlohmann::json &t_videoStreams) {
-        std::list<videoStream_t> streams;
+        std::vector<videoStream_t> streams;
 
         if (t_videoStreams.empty()) {
             return;
         }
 
-        for (nlohmann::json item : t_videoStreams) {
+        streams.reserve(t_videoStreams.size());
+
+        for (nlohmann::json &item : t_videoStreams) {
             videoStream_t stream = videoStream_t();
 
-            if (isDigits(item["widthPixels"])) {
-                stream.widthPixels = item["widthPixels"].get<unsigned int>();
+            if (isDigits(getJsonField(item, "widthPixels"))) {
+                stream.widthPixels = getJsonField(item, "widthPixels").get<unsigned int>();
             }
 
-            if (isDigits(item["heightPixels"])) {
-                stream.heightPixels = item["heightPixels"].get<unsigned int>();
+            if (isDigits(getJsonField(item, "heightPixels"))) {
+                stream.heightPixels = getJsonField(item, "heightPixels").get<unsigned int>();
             }
 
-            stream.frameRateFps = item["frameRateFps"].get<double>();
-            stream.aspectRatio = item["aspectRatio"].get<double>();
-
-            if (item["codec"].is_string()) {
-                std::map<std::string, std::string> problems;
+            stream.frameRateFps = getJsonField(item, "frameRateFps").get<double>();
+            stream.aspectRatio = getJsonField(item, "aspectRatio").get<double>();
 
-                stream.codec = getJsonStringValue(item["codec"], "setVideoStreams [codec]", problems);
-                reportProblems(problems);
+            if (getJsonField(item, "codec").is_string()) {
+                stream.codec = takeJsonStringValue(getJsonField(item, "codec"), "setVideoStreams [codec]", m_diagnostics);
             }
 
-            if (isDigits(item["bitrateBps"])) {
-                std::map<std::string, std::string> problems;
-
-                stream.bitrateBps = getJsonULongValue(item["bitrateBps"], "setVideoStreams [bitrateBps]",
-                                                                    problems);
-                reportProblems(problems);
+            if (isDigits(getJsonField(item, "bitrateBps"))) {
+                stream.bitrateBps = getJsonULongValue(getJsonField(item, "bitrateBps"), "setVideoStreams [bitrateBps]",
+                                                                    m_diagnostics);
             }
 
-            if (item["rotation"].is_string()) {
-                std::map<std::string, std::string> problems;
-
-                stream.rotation = getJsonStringValue(item["rotation"], "setVideoStreams [rotation]",
-                                                                   problems);
-                reportProblems(problems);
+            if (getJsonField(item, "rotation").is_string()) {
+                stream.rotation = takeJsonStringValue(getJsonField(item, "rotation"), "setVideoStreams [rotation]",
+                                                                   m_diagnostics);
             }
 
-            if (item["vendor"].is_string()) {
-                std::map<std::string, std::string> problems;
-
-                stream.vendor = getJsonStringValue(item["vendor"], "setVideoStreams [vendor]", problems);
-                reportProblems(problems);
+            if (getJsonField(item, "vendor").is_string()) {
+                stream.vendor = takeJsonStringValue(getJsonField(item, "vendor"), "setVideoStreams [vendor]", m_diagnostics);
             }
 
-            streams.push_back(stream);
+            streams.push_back(std::move(stream));
         }
 
-        setVideoStreams(streams);
+        setVideoStreams(std::move(streams));
     }
 
-    const std::list<audioStream_t> &YoutubeVideo::getAudioStreams() const {
+    const std::vector<audioStream_t> &YoutubeVideo::getAudioStreams() const {
         return m_audioStreams;
     }
 
-    void YoutubeVideo::setAudioStreams(const std::list<audioStream_t> &t_audioStreams) {
-        m_audioStreams = t_audioStreams;
+    void YoutubeVideo::setAudioStreams(std::vector<audioStream_t> t_audioStreams) {
+        m_audioStreams = std::move(t_audioStreams);
     }
 
     void YoutubeVideo::setAudioStreams(nlohmann::json &t_audioStreams) {
-        std::list<audioStream_t> streams;
+        std::vector<audioStream_t> streams;
 
         if (t_audioStreams.empty()) {
             return;
         }
 
-        for (nlohmann::json item : t_audioStreams) {
+        streams.reserve(t_audioStreams.size());
+
+        for (nlohmann::json &item : t_audioStreams) {
             audioStream_t stream = audioStream_t();
 
-            if (isDigits(item["channelCount"])) {
-                stream.channelCount = item["channelCount"].get<unsigned int>();
+            if (isDigits(getJsonField(item, "channelCount"))) {
+                stream.channelCount = getJsonField(item, "channelCount").get<unsigned int>();
             }
 
-            if (item["codec"].is_string()) {
-                std::map<std::string, std::string> problems;
-
-                stream.codec = getJsonStringValue(item["codec"], "setAudioStreams [codec]", problems);
-                reportProblems(problems);
+            if (getJsonField(item, "codec").is_string()) {
+                stream.codec = takeJsonStringValue(getJsonField(item, "codec"), "setAudioStreams [codec]", m_diagnostics);
             }
 
-            if (isDigits(item["bitrateBps"])) {
-                std::map<std::string, std::string> problems;
-
-                stream.bitrateBps = getJsonULongValue(item["bitrateBps"], "setAudioStreams [bitrateBps]",
-                                                                    problems);
-                reportProblems(problems);
+            if (isDigits(getJsonField(item, "bitrateBps"))) {
+                stream.bitrateBps = getJsonULongValue(getJsonField(item, "bitrateBps"), "setAudioStreams [bitrateBps]",
+                                                                    m_diagnostics);
             }
 
-            if (item["vendor"].is_string()) {
-                std::map<std::string, std::string> problems;
-
-                stream.vendor = getJsonStringValue(item["vendor"], "setAudioStreams [vendor]", problems);
-                reportProblems(problems);
+            if (getJsonField(item, "vendor").is_string()) {
+                stream.vendor = takeJsonStringValue(getJsonField(item, "vendor"), "setAudioStreams [vendor]", m_diagnostics);
             }
 
-            streams.push_back(stream);
+            streams.push_back(std::move(stream));
         }
 
-        setAudioStreams(streams);
+        setAudioStreams(std::move(streams));
     }
 
     unsigned long YoutubeVideo::getDurationMs() const {
@@ -1071,10 +895,7 @@ namespace sane {
 
     void YoutubeVideo::setDurationMs(nlohmann::json &t_durationMs) {
         if (isDigits(t_durationMs)) {
-            std::map<std::string, std::string> problems;
-
-            setDurationMs(getJsonULongValue(t_durationMs, "", problems));
-            reportProblems(problems);
+            setDurationMs(getJsonULongValue(t_durationMs, "setDurationMs", m_diagnostics));
         }
     }
 
@@ -1088,10 +909,7 @@ namespace sane {
 
     void YoutubeVideo::setBitrateBps(nlohmann::json &t_bitrateBps) {
         if (isDigits(t_bitrateBps)) {
-            std::map<std::string, std::string> problems;
-
-            setBitrateBps(getJsonULongValue(t_bitrateBps, "setBitrateBps", problems));
-            reportProblems(problems);
+            setBitrateBps(getJsonULongValue(t_bitrateBps, "setBitrateBps", m_diagnostics));
         }
     }
 
@@ -1099,16 +917,13 @@ namespace sane {
         return m_creationTime;
     }
 
-    void YoutubeVideo::setCreationTime(const std::string &t_creationTime) {
-        m_creationTime = t_creationTime;
+    void YoutubeVideo::setCreationTime(std::string t_creationTime) {
+        m_creationTime = std::move(t_creationTime);
     }
 
     void YoutubeVideo::setCreationTime(nlohmann::json & t_creationTime) {
         if (t_creationTime.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setCreationTime(getJsonStringValue(t_creationTime, "setCreationTime", problems));
-            reportProblems(problems);
+            setCreationTime(takeJsonStringValue(t_creationTime, "setCreationTime", m_diagnostics));
         }
     }
 
@@ -1116,16 +931,13 @@ namespace sane {
         return m_processingStatus;
     }
 
-    void YoutubeVideo::setProcessingStatus(const std::string &t_processingStatus) {
-        m_processingStatus = t_processingStatus;
+    void YoutubeVideo::setProcessingStatus(std::string t_processingStatus) {
+        m_processingStatus = std::move(t_processingStatus);
     }
 
     void YoutubeVideo::setProcessingStatus(nlohmann::json &t_processingStatus) {
         if (t_processingStatus.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setProcessingStatus(getJsonStringValue(t_processingStatus, "setProcessingStatus", problems));
-            reportProblems(problems);
+            setProcessingStatus(takeJsonStringValue(t_processingStatus, "setProcessingStatus", m_diagnostics));
         }
     }
 
@@ -1133,59 +945,43 @@ namespace sane {
         return m_processingProgress;
     }
 
-    void YoutubeVideo::setProcessingProgress(const processingProgress_t &t_processingProgress) {
-        m_processingProgress = t_processingProgress;
+    void YoutubeVideo::setProcessingProgress(processingProgress_t t_processingProgress) {
+        m_processingProgress = std::move(t_processingProgress);
     }
 
     void YoutubeVideo::setProcessingProgress(nlohmann::json &t_processingProgress) {
         processingProgress_t processingProgress = processingProgress_t();
 
         if (t_processingProgress["partsTotal"].is_string()) {
-            std::map<std::string, std::string> problems;
-
             processingProgress.partsTotal = getJsonULongValue(t_processingProgress["partsTotal"],
-                    "setProcessingProgress [partsTotal]", problems);
-
-            reportProblems(problems);
+                    "setProcessingProgress [partsTotal]", m_diagnostics);
         }
 
         if (t_processingProgress["partsProcessed"].is_string()) {
-            std::map<std::string, std::string> problems;
-
             processingProgress.partsProcessed = getJsonULongValue(t_processingProgress["partsProcessed"],
-                                                              "setProcessingProgress [partsProcessed]", problems);
-
-            reportProblems(problems);
+                                                              "setProcessingProgress [partsProcessed]", m_diagnostics);
         }
 
         if (t_processingProgress["timeLeftMs"].is_string()) {
-            std::map<std::string, std::string> problems;
-
             processingProgress.timeLeftMs = getJsonULongValue(t_processingProgress["timeLeftMs"],
-                                                              "setProcessingProgress [timeLeftMs]", problems);
-
-            reportProblems(problems);
+                                                              "setProcessingProgress [timeLeftMs]", m_diagnostics);
         }
 
-        setProcessingProgress(processingProgress);
+        setProcessingProgress(std::move(processingProgress));
     }
 
     const std::string &YoutubeVideo::getProcessingFailureReason() const {
         return m_processingFailureReason;
     }
 
-    void YoutubeVideo::setProcessingFailureReason(const std::string &t_processingFailureReason) {
-        m_processingFailureReason = t_processingFailureReason;
+    void YoutubeVideo::setProcessingFailureReason(std::string t_processingFailureReason) {
+        m_processingFailureReason = std::move(t_processingFailureReason);
     }
 
     void YoutubeVideo::setProcessingFailureReason(nlohmann::json &t_processingFailureReason) {
         if (t_processingFailureReason.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setProcessingFailureReason(getJsonStringValue(t_processingFailureReason,
-                    "setProcessingFailureReason", problems));
-
-            reportProblems(problems);
+            setProcessingFailureReason(takeJsonStringValue(t_processingFailureReason,
+                    "setProcessingFailureReason", m_diagnostics));
         }
     }
 
@@ -1193,18 +989,14 @@ namespace sane {
         return m_fileDetailsAvailability;
     }
 
-    void YoutubeVideo::setFileDetailsAvailability(const std::string &t_fileDetailsAvailability) {
-        m_fileDetailsAvailability = t_fileDetailsAvailability;
+    void YoutubeVideo::setFileDetailsAvailability(std::string t_fileDetailsAvailability) {
+        m_fileDetailsAvailability = std::move(t_fileDetailsAvailability);
     }
 
     void YoutubeVideo::setFileDetailsAvailability(nlohmann::json &t_fileDetailsAvailability) {
         if (t_fileDetailsAvailability.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setFileDetailsAvailability(getJsonStringValue(t_fileDetailsAvailability,
-                                                          "setFileDetailsAvailability", problems));
-
-            reportProblems(problems);
+            setFileDetailsAvailability(takeJsonStringValue(t_fileDetailsAvailability,
+                                                          "setFileDetailsAvailability", m_diagnostics));
         }
     }
 
@@ -1212,18 +1004,14 @@ namespace sane {
         return m_processingIssuesAvailability;
     }
 
-    void YoutubeVideo::setProcessingIssuesAvailability(const std::string &t_processingIssuesAvailability) {
-        m_processingIssuesAvailability = t_processingIssuesAvailability;
+    void YoutubeVideo::setProcessingIssuesAvailability(std::string t_processingIssuesAvailability) {
+        m_processingIssuesAvailability = std::move(t_processingIssuesAvailability);
     }
 
     void YoutubeVideo::setProcessingIssuesAvailability(nlohmann::json &t_processingIssuesAvailability) {
         if (t_processingIssuesAvailability.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setProcessingIssuesAvailability(getJsonStringValue(t_processingIssuesAvailability,
-                                                          "setProcessingIssuesAvailability", problems));
-
-            reportProblems(problems);
+            setProcessingIssuesAvailability(takeJsonStringValue(t_processingIssuesAvailability,
+                                                          "setProcessingIssuesAvailability", m_diagnostics));
         }
     }
 
@@ -1231,18 +1019,14 @@ namespace sane {
         return m_tagSuggestionsAvailability;
     }
 
-    void YoutubeVideo::setTagSuggestionsAvailability(const std::string &t_tagSuggestionsAvailability) {
-        m_tagSuggestionsAvailability = t_tagSuggestionsAvailability;
+    void YoutubeVideo::setTagSuggestionsAvailability(std::string t_tagSuggestionsAvailability) {
+        m_tagSuggestionsAvailability = std::move(t_tagSuggestionsAvailability);
     }
 
     void YoutubeVideo::setTagSuggestionsAvailability(nlohmann::json &t_tagSuggestionsAvailability) {
         if (t_tagSuggestionsAvailability.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setTagSuggestionsAvailability(getJsonStringValue(t_tagSuggestionsAvailability,
-                                                               "setTagSuggestionsAvailability", problems));
-
-            reportProblems(problems);
+            setTagSuggestionsAvailability(takeJsonStringValue(t_tagSuggestionsAvailability,
+                                                               "setTagSuggestionsAvailability", m_diagnostics));
         }
     }
 
@@ -1250,18 +1034,14 @@ namespace sane {
         return m_editorSuggestionsAvailability;
     }
 
-    void YoutubeVideo::setEditorSuggestionsAvailability(const std::string &t_editorSuggestionsAvailability) {
-        m_editorSuggestionsAvailability = t_editorSuggestionsAvailability;
+    void YoutubeVideo::setEditorSuggestionsAvailability(std::string t_editorSuggestionsAvailability) {
+        m_editorSuggestionsAvailability = std::move(t_editorSuggestionsAvailability);
     }
 
     void YoutubeVideo::setEditorSuggestionsAvailability(nlohmann::json &t_editorSuggestionsAvailability) {
         if (t_editorSuggestionsAvailability.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setEditorSuggestionsAvailability(getJsonStringValue(t_editorSuggestionsAvailability,
-                                                             "setEditorSuggestionsAvailability", problems));
-
-            reportProblems(problems);
+            setEditorSuggestionsAvailability(takeJsonStringValue(t_editorSuggestionsAvailability,
+                                                             "setEditorSuggestionsAvailability", m_diagnostics));
         }
     }
 
@@ -1269,136 +1049,125 @@ namespace sane {
         return m_thumbnailsAvailability;
     }
 
-    void YoutubeVideo::setThumbnailsAvailability(const std::string &t_thumbnailsAvailability) {
-        m_thumbnailsAvailability = t_thumbnailsAvailability;
+    void YoutubeVideo::setThumbnailsAvailability(std::string t_thumbnailsAvailability) {
+        m_thumbnailsAvailability = std::move(t_thumbnailsAvailability);
     }
 
     void YoutubeVideo::setThumbnailsAvailability(nlohmann::json &t_thumbnailsAvailability) {
         if (t_thumbnailsAvailability.is_string()) {
-            std::map<std::string, std::string> problems;
-
-            setThumbnailsAvailability(getJsonStringValue(t_thumbnailsAvailability,
-                                                                "setThumbnailsAvailability", problems));
-
-            reportProblems(problems);
+            setThumbnailsAvailability(takeJsonStringValue(t_thumbnailsAvailability,
+                                                                "setThumbnailsAvailability", m_diagnostics));
         }
     }
 
-    const std::list<std::string> &YoutubeVideo::getProcessingErrors() const {
+    const std::vector<std::string> &YoutubeVideo::getProcessingErrors() const {
         return m_processingErrors;
     }
 
-    void YoutubeVideo::setProcessingErrors(const std::list<std::string> &t_processingErrors) {
-        m_processingErrors = t_processingErrors;
+    void YoutubeVideo::setProcessingErrors(std::vector<std::string> t_processingErrors) {
+        m_processingErrors = std::move(t_processingErrors);
     }
 
     void YoutubeVideo::setProcessingErrors(nlohmann::json &t_processingErrors) {
-        std::list<std::string> processingErrors;
+        std::vector<std::string> processingErrors;
+        processingErrors.reserve(t_processingErrors.size());
 
-        for (nlohmann::json error : t_processingErrors) {
-            std::map<std::string, std::string> problems;
+        for (nlohmann::json &error : t_processingErrors) {
             if (error.is_string()) {
-                std::string parsedValue = getJsonStringValue(error, "setProcessingErrors", problems);
-
-                reportProblems(problems);
+                std::string parsedValue = takeJsonStringValue(error, "setProcessingErrors", m_diagnostics);
 
                 if (!parsedValue.empty()) {
-                    processingErrors.push_back(parsedValue);
+                    processingErrors.push_back(std::move(parsedValue));
                 }
             }
         }
 
-        setProcessingErrors(processingErrors);
+        setProcessingErrors(std::move(processingErrors));
     }
 
-    const std::list<std::string> &YoutubeVideo::getProcessingWarnings() const {
+    const std::vector<std::string> &YoutubeVideo::getProcessingWarnings() const {
         return m_processingWarnings;
     }
 
-    void YoutubeVideo::setProcessingWarnings(const std::list<std::string> &t_processingWarnings) {
-        m_processingWarnings = t_processingWarnings;
+    void YoutubeVideo::setProcessingWarnings(std::vector<std::string> t_processingWarnings) {
+        m_processingWarnings = std::move(t_processingWarnings);
     }
 
     void YoutubeVideo::setProcessingWarnings(nlohmann::json &t_processingWarnings) {
-        std::list<std::string> processingWarnings;
+        std::vector<std::string> processingWarnings;
+        processingWarnings.reserve(t_processingWarnings.size());
 
-        for (nlohmann::json warning : t_processingWarnings) {
-            std::map<std::string, std::string> problems;
+        for (nlohmann::json &warning : t_processingWarnings) {
             if (warning.is_string()) {
-                std::string parsedValue = getJsonStringValue(warning, "setProcessingWarnings", problems);
-
-                reportProblems(problems);
+                std::string parsedValue = takeJsonStringValue(warning, "setProcessingWarnings", m_diagnostics);
 
                 if (!parsedValue.empty()) {
-                    processingWarnings.push_back(parsedValue);
+                    processingWarnings.push_back(std::move(parsedValue));
                 }
             }
         }
 
-        setProcessingWarnings(processingWarnings);
+        setProcessingWarnings(std::move(processingWarnings));
     }
 
-    const std::list<std::string> &YoutubeVideo::getProcessingHints() const {
+    const std::vector<std::string> &YoutubeVideo::getProcessingHints() const {
         return m_processingHints;
     }
 
-    void YoutubeVideo::setProcessingHints(const std::list<std::string> &t_processingHints) {
-        m_processingHints = t_processingHints;
+    void YoutubeVideo::setProcessingHints(std::vector<std::string> t_processingHints) {
+        m_processingHints = std::move(t_processingHints);
     }
 
     void YoutubeVideo::setProcessingHints(nlohmann::json &t_processingHints) {
-        std::list<std::string> processingHints;
+        std::vector<std::string> processingHints;
+        processingHints.reserve(t_processingHints.size());
 
-        for (nlohmann::json hint : t_processingHints) {
-            std::map<std::string, std::string> problems;
+        for (nlohmann::json &hint : t_processingHints) {
             if (hint.is_string()) {
-                std::string parsedValue = getJsonStringValue(hint, "setProcessingHints", problems);
-
-                reportProblems(problems);
+                std::string parsedValue = takeJsonStringValue(hint, "setProcessingHints", m_diagnostics);
 
                 if (!parsedValue.empty()) {
-                    processingHints.push_back(parsedValue);
+                    processingHints.push_back(std::move(parsedValue));
                 }
             }
         }
 
-        setProcessingHints(processingHints);
+        setProcessingHints(std::move(processingHints));
     }
 
-    const std::list<tagSuggestion_t> &YoutubeVideo::getTagSuggestions() const {
+    const std::vector<tagSuggestion_t> &YoutubeVideo::getTagSuggestions() const {
         return m_tagSuggestions;
     }
 
-    void YoutubeVideo::setTagSuggestions(const std::list<tagSuggestion_t> &t_tagSuggestions) {
-        m_tagSuggestions = t_tagSuggestions;
+    void YoutubeVideo::setTagSuggestions(std::vector<tagSuggestion_t> t_tagSuggestions) {
+        m_tagSuggestions = std::move(t_tagSuggestions);
     }
 
     void YoutubeVideo::setTagSuggestions(nlohmann::json &t_tagSuggestions) {
-        std::list<tagSuggestion_t> tagSuggestions;
+        std::vector<tagSuggestion_t> tagSuggestions;
+        tagSuggestions.reserve(t_tagSuggestions.size());
 
         // For each tag, categoryRestricts[] in t_tagSuggestions.
-        for (nlohmann::json suggestion : t_tagSuggestions) {
-            if (suggestion["tag"].is_string()) {
-                std::map<std::string, std::string> tagProblems;
+        for (nlohmann::json &suggestion : t_tagSuggestions) {
+            nlohmann::json &tag = getJsonField(suggestion, "tag");
 
-                std::string parsedTag = getJsonStringValue(suggestion, "setTagSuggestions [parsedTag]", tagProblems);
-                reportProblems(tagProblems);
+            if (tag.is_string()) {
+                std::string parsedTag = takeJsonStringValue(tag, "setTagSuggestions [parsedTag]", m_diagnostics);
 
                 // If parsed tag is not empty, proceed to categoryRestricts list parsing.
                 if (!parsedTag.empty())
                 {
-                    std::list<std::string> categoryRestricts;
-
-                    for(const nlohmann::json& categoryRestrict : suggestion["categoryRestricts"]) {
-                        std::map<std::string, std::string> catProblems;
+                    nlohmann::json &categoryRestrictsJson = getJsonField(suggestion, "categoryRestricts");
+                    std::vector<std::string> categoryRestricts;
+                    categoryRestricts.reserve(categoryRestrictsJson.size());
 
+                    for (nlohmann::json &categoryRestrict : categoryRestrictsJson) {
                         if (categoryRestrict.is_string()) {
-                            std::string parsedCat = getJsonStringValue(suggestion,
-                                    "setTagSuggestions [categoryRestricts]", catProblems);
-                            reportProblems(catProblems);
+                            std::string parsedCat = takeJsonStringValue(categoryRestrict,
+                                    "setTagSuggestions [categoryRestricts]", m_diagnostics);
 
                             if (!parsedCat.empty()) {
-                                categoryRestricts.push_back(parsedCat);
+                                categoryRestricts.push_back(std::move(parsedCat));
                             }
                         }
                     } // for categoryRestricts
@@ -1406,112 +1175,98 @@ namespace sane {
                     // Create a tagSuggestion_t object.
                     tagSuggestion_t tagSuggestion = tagSuggestion_t();
 
-                    tagSuggestion.tag = parsedTag;
-                    tagSuggestion.categoryRestricts = categoryRestricts;
+                    tagSuggestion.tag = std::move(parsedTag);
+                    tagSuggestion.categoryRestricts = std::move(categoryRestricts);
 
                     // Add the tagSuggestion_t to the list.
-                    tagSuggestions.push_back(tagSuggestion);
+                    tagSuggestions.push_back(std::move(tagSuggestion));
                 } // if parsed tag is not empty
             } // if tag is string
         } // for suggestion
 
-        setTagSuggestions(tagSuggestions);
+        setTagSuggestions(std::move(tagSuggestions));
     }
 
-    const std::list<std::string> &YoutubeVideo::getEditorSuggestions() const {
+    const std::vector<std::string> &YoutubeVideo::getEditorSuggestions() const {
         return m_editorSuggestions;
     }
 
-    void YoutubeVideo::setEditorSuggestions(const std::list<std::string> &t_editorSuggestions) {
-        m_editorSuggestions = t_editorSuggestions;
+    void YoutubeVideo::setEditorSuggestions(std::vector<std::string> t_editorSuggestions) {
+        m_editorSuggestions = std::move(t_editorSuggestions);
     }
 
     void YoutubeVideo::setEditorSuggestions(nlohmann::json &t_editorSuggestions) {
-        std::list<std::string> editorSuggestions;
+        std::vector<std::string> editorSuggestions;
+        editorSuggestions.reserve(t_editorSuggestions.size());
 
-        for (nlohmann::json suggestion : t_editorSuggestions) {
-            std::map<std::string, std::string> problems;
+        for (nlohmann::json &suggestion : t_editorSuggestions) {
             if (suggestion.is_string()) {
-                std::string parsedValue = getJsonStringValue(suggestion, "setEditorSuggestions", problems);
-
-                reportProblems(problems);
+                std::string parsedValue = takeJsonStringValue(suggestion, "setEditorSuggestions", m_diagnostics);
 
                 if (!parsedValue.empty()) {
-                    editorSuggestions.push_back(parsedValue);
+                    editorSuggestions.push_back(std::move(parsedValue));
                 }
             }
         }
 
-        setEditorSuggestions(editorSuggestions);
+        setEditorSuggestions(std::move(editorSuggestions));
     }
 
     liveStreamingDetails_t YoutubeVideo::getLiveStreamingDetails() {
         return m_liveStreamingDetails;
     }
 
-    void YoutubeVideo::setLiveStreamingDetails(const liveStreamingDetails_t &t_liveStreamingDetails) {
-        m_liveStreamingDetails = t_liveStreamingDetails;
+    void YoutubeVideo::setLiveStreamingDetails(liveStreamingDetails_t t_liveStreamingDetails) {
+        m_liveStreamingDetails = std::move(t_liveStreamingDetails);
     }
 
     void YoutubeVideo::setLiveStreamingDetails(nlohmann::json &t_liveStreamingDetails) {
         liveStreamingDetails_t liveStreamingDetails = liveStreamingDetails_t();
 
         if (t_liveStreamingDetails["actualStartTime"].is_string()) {
-            std::map<std::string, std::string> problems;
-            liveStreamingDetails.actualStartTime = getJsonStringValue(t_liveStreamingDetails["actualStartTime"],
-                    "setLiveStreamingDetails [actualStartTime]", problems);
-            reportProblems(problems);
+            liveStreamingDetails.actualStartTime = takeJsonStringValue(t_liveStreamingDetails["actualStartTime"],
+                    "setLiveStreamingDetails [actualStartTime]", m_diagnostics);
         }
 
         if (t_liveStreamingDetails["actualEndTime"].is_string()) {
-            std::map<std::string, std::string> problems;
-            liveStreamingDetails.actualEndTime = getJsonStringValue(t_liveStreamingDetails["actualEndTime"],
+            liveStreamingDetails.actualEndTime = takeJsonStringValue(t_liveStreamingDetails["actualEndTime"],
                                                                       "setLiveStreamingDetails [actualEndTime]",
-                                                                      problems);
-            reportProblems(problems);
+                                                                      m_diagnostics);
         }
 
         if (t_liveStreamingDetails["scheduledStartTime"].is_string()) {
-            std::map<std::string, std::string> problems;
-            liveStreamingDetails.scheduledStartTime = getJsonStringValue(t_liveStreamingDetails["scheduledStartTime"],
+            liveStreamingDetails.scheduledStartTime = takeJsonStringValue(t_liveStreamingDetails["scheduledStartTime"],
                                                                        "setLiveStreamingDetails [scheduledStartTime]",
-                                                                        problems);
-            reportProblems(problems);
+                                                                        m_diagnostics);
         }
 
         if (t_liveStreamingDetails["scheduledEndTime"].is_string()) {
-            std::map<std::string, std::string> problems;
-            liveStreamingDetails.scheduledEndTime = getJsonStringValue(t_liveStreamingDetails["scheduledEndTime"],
+            liveStreamingDetails.scheduledEndTime = takeJsonStringValue(t_liveStreamingDetails["scheduledEndTime"],
                                                                        "setLiveStreamingDetails [scheduledEndTime]",
-                                                                       problems);
-            reportProblems(problems);
+                                                                       m_diagnostics);
         }
 
         if (t_liveStreamingDetails["concurrentViewers"].is_string()) {
-            std::map<std::string, std::string> problems;
             liveStreamingDetails.concurrentViewers = getJsonULongValue(t_liveStreamingDetails["concurrentViewers"],
                                                                        "setLiveStreamingDetails [concurrentViewers]",
-                                                                       problems);
-            reportProblems(problems);
+                                                                       m_diagnostics);
         }
 
         if (t_liveStreamingDetails["activeLiveChatId"].is_string()) {
-            std::map<std::string, std::string> problems;
-            liveStreamingDetails.activeLiveChatId = getJsonStringValue(t_liveStreamingDetails["activeLiveChatId"],
+            liveStreamingDetails.activeLiveChatId = takeJsonStringValue(t_liveStreamingDetails["activeLiveChatId"],
                                                                        "setLiveStreamingDetails [activeLiveChatId]",
-                                                                       problems);
-            reportProblems(problems);
+                                                                       m_diagnostics);
         }
 
-        setLiveStreamingDetails(liveStreamingDetails);
+        setLiveStreamingDetails(std::move(liveStreamingDetails));
     }
 
     const std::map<std::string, localization_t> &YoutubeVideo::getLocalizations() const {
         return m_localizations;
     }
 
-    void YoutubeVideo::setLocalizations(const std::map<std::string, localization_t> &t_localizations) {
-        m_localizations = t_localizations;
+    void YoutubeVideo::setLocalizations(std::map<std::string, localization_t> t_localizations) {
+        m_localizations = std::move(t_localizations);
     }
 
     void YoutubeVideo::setLocalizations(nlohmann::json &t_localizations) {
@@ -1521,42 +1276,31 @@ namespace sane {
         for (auto& localizationObject : t_localizations.items()) {
             // Assign the key, value to a new JSON object to avoid code inspection funkiness.
             nlohmann::json keyJson = localizationObject.key();
-            nlohmann::json valueJson = localizationObject.value();
+            nlohmann::json &valueJson = localizationObject.value();
 
             if (keyJson.is_string()) {
-                std::map<std::string, std::string> keyProblems;
-
-                std::string key = getJsonStringValue(keyJson, "setLocalizations [key]", keyProblems);
-
-                reportProblems(keyProblems);
+                std::string key = takeJsonStringValue(keyJson, "setLocalizations [key]", m_diagnostics);
 
                 // Create the localization_t object.
                 localization_t localization = localization_t();
 
-                if (valueJson["title"].is_string()) {
-                    std::map<std::string, std::string> titleProblems;
-
-                    localization.title = getJsonStringValue(valueJson["title"],
-                            "setLocalizations [title]", titleProblems);
-
-                    reportProblems(titleProblems);
+                nlohmann::json &title = getJsonField(valueJson, "title");
+                if (title.is_string()) {
+                    localization.title = takeJsonStringValue(title, "setLocalizations [title]", m_diagnostics);
                 }
 
-                if (valueJson["description"].is_string()) {
-                    std::map<std::string, std::string> descriptionProblems;
-
-                    localization.description = getJsonStringValue(valueJson["description"],
-                            "setLocalizations [description]", descriptionProblems);
-
-                    reportProblems(descriptionProblems);
+                nlohmann::json &description = getJsonField(valueJson, "description");
+                if (description.is_string()) {
+                    localization.description = takeJsonStringValue(description,
+                            "setLocalizations [description]", m_diagnostics);
                 }
 
                 // Add the BCP-47 language code key and its values to the localizations map.
-                localizations[key] = localization;
+                localizations[key] = std::move(localization);
             }
         }
 
-        setLocalizations(localizations);
+        setLocalizations(std::move(localizations));
     }
 
     // END: Getters & Setters.
@@ -1584,7 +1328,7 @@ namespace sane {
         if (!getDescription().empty() or t_printFullInfo) {
             printIndentedString(t_indentationSpacing, getDescription(), "Description: ");
         }
-        if (!getThumbnails().empty() or t_printFullInfo) {
+        if (!m_thumbnails.empty() or t_printFullInfo) {
             std::cout << indentation << "Thumbnails: " << std::endl;
             // For each category/key
             for (auto const& thumbnail : getThumbnails()) {
@@ -1641,22 +1385,22 @@ namespace sane {
         if (t_printFullInfo) {
             std::cout << indentation << "2-Dimensional: " << is2D() << std::endl;
             std::cout << indentation << "3-Dimensional: " << is3D() << std::endl;
-        } else if (hasPartContentDetails) {
+        } else if (m_parts.has(VideoPart::ContentDetails)) {
             std::cout << indentation << "Dimension: " << (is2D() ? "2D" : "3D") << std::endl;
         }
-        if (hasPartContentDetails or t_printFullInfo) {
+        if (m_parts.has(VideoPart::ContentDetails) or t_printFullInfo) {
             std::cout << indentation << "HD: " << isHD() << std::endl;
         }
         if (t_printFullInfo) {
             std::cout << indentation << "Rectangular: " << isRectangular() << std::endl;
             std::cout << indentation << "360 Degrees: " << is360() << std::endl;
-        } else if (hasPartContentDetails) {
+        } else if (m_parts.has(VideoPart::ContentDetails)) {
             std::cout << indentation << "Projection: " << (is360() ? "360 Degrees" : "Rectangular") << std::endl;
         }
-        if (hasPartContentDetails or t_printFullInfo) {
+        if (m_parts.has(VideoPart::ContentDetails) or t_printFullInfo) {
             std::cout << indentation << "Has Captions: " << hasCaptions() << std::endl;
         }
-        if (hasPartContentDetails or t_printFullInfo) {
+        if (m_parts.has(VideoPart::ContentDetails) or t_printFullInfo) {
             std::cout << indentation << "Licensed Content: " << isLicensedContent() << std::endl;
         }
         if (!getRegionRestrictionWhitelist().empty() or !getRegionRestrictionBlacklist().empty() or t_printFullInfo) {
@@ -1676,7 +1420,7 @@ namespace sane {
                 }
             }
         }
-        if (hasPartContentDetails or t_printFullInfo) {
+        if (m_parts.has(VideoPart::ContentDetails) or t_printFullInfo) {
             std::cout << indentation << "Has Custom Thumbnail: " << hasCustomThumbnail() << std::endl;
         }
         if (!getUploadStatus().empty() or t_printFullInfo) {
@@ -1697,25 +1441,25 @@ namespace sane {
         if (!getLicense().empty() or t_printFullInfo) {
             std::cout << indentation << "License: " << getLicense() << std::endl;
         }
-        if (hasPartStatus or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Status) or t_printFullInfo) {
             std::cout << indentation << "Embeddable: " << isEmbeddable() << std::endl;
         }
-        if (hasPartStatus or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Status) or t_printFullInfo) {
             std::cout << indentation << "Public Stats Viewable: " << isPublicStatsViewable() << std::endl;
         }
-        if (hasPartStatistics or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Statistics) or t_printFullInfo) {
             std::cout << indentation << "Views: " << getViewCount() << std::endl;
         }
-        if (hasPartStatistics or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Statistics) or t_printFullInfo) {
             std::cout << indentation << "Likes: " << getLikeCount() << std::endl;
         }
-        if (hasPartStatistics or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Statistics) or t_printFullInfo) {
             std::cout << indentation << "Dislikes: " << getDislikeCount() << std::endl;
         }
-        if (hasPartStatistics or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Statistics) or t_printFullInfo) {
             std::cout << indentation << "Comments: " << getCommentCount() << std::endl;
         }
-        if (hasPartPlayer or t_printFullInfo) {
+        if (m_parts.has(VideoPart::Player) or t_printFullInfo) {
             std::cout << indentation << "Player: " << std::endl;
             player_t player = getPlayer();
             if (player.embedWidth != 0 and player.embedHeight != 0) {
@@ -1737,7 +1481,7 @@ namespace sane {
         if (!getFileName().empty() or t_printFullInfo) {
             std::cout << indentation << "Filename: " << getFileName() << std::endl;
         }
-        if ( (hasPartFileDetails or t_printFullInfo) and getFileSize() != 0) {
+        if ( (m_parts.has(VideoPart::FileDetails) or t_printFullInfo) and getFileSize() != 0) {
             std::cout << indentation << "Filesize: " << getFileSize() << std::endl;
         }
         if (!getFileType().empty() or t_printFullInfo) {
@@ -1763,10 +1507,10 @@ namespace sane {
                           << " @ " << stream.bitrateBps << "Bps" << "." << std::endl;
             }
         }
-        if ( (hasPartFileDetails or t_printFullInfo) and getDurationMs() != 0 ) {
+        if ( (m_parts.has(VideoPart::FileDetails) or t_printFullInfo) and getDurationMs() != 0 ) {
             std::cout << indentation << "Duration (ms): " << getDurationMs() << std::endl;
         }
-        if ( (hasPartFileDetails or t_printFullInfo) and getBitrateBps() != 0 ) {
+        if ( (m_parts.has(VideoPart::FileDetails) or t_printFullInfo) and getBitrateBps() != 0 ) {
             std::cout << indentation << "Bitrate (Bps): " << getBitrateBps() << std::endl;
         }
         if (!getCreationTime().empty() or t_printFullInfo) {
@@ -1871,18 +1615,11 @@ namespace sane {
         if (t_printFullInfo) {
             std::vector<std::string> parts;
 
-            if (hasPartSnippet) parts.emplace_back("snippet");
-            if (hasPartContentDetails) parts.emplace_back("contentDetails");
-            if (hasPartStatus) parts.emplace_back("status");
-            if (hasPartStatistics) parts.emplace_back("statistics");
-            if (hasPartPlayer) parts.emplace_back("player");
-            if (hasPartTopicDetails) parts.emplace_back("topicDetails");
-            if (hasPartRecordingDetails) parts.emplace_back("recordingDetails");
-            if (hasPartFileDetails) parts.emplace_back("fileDetails");
-            if (hasPartProcessingDetails) parts.emplace_back("processingDetails");
-            if (hasPartSuggestions) parts.emplace_back("suggestions");
-            if (hasPartLiveStreamingDetails) parts.emplace_back("liveStreamingDetails");
-            if (hasPartLocalizations) parts.emplace_back("localizations");
+            for (size_t i = 0; i < VIDEO_PART_COUNT; i++) {
+                if (m_parts.has((VideoPart)i)) {
+                    parts.emplace_back(getVideoPartKey((VideoPart)i));
+                }
+            }
 
             std::cout << indentation << "Parts: ";
             for (size_t i = 0; i < parts.size(); ++i) {
@@ -1900,30 +1637,223 @@ namespace sane {
         }
     }
 
-    void YoutubeVideo::addFromJson(nlohmann::json t_json) {
+    /**
+     * Populates the snippet part.
+     *
+     * @param t_snippet  The resource's "snippet" object.
+     */
+    void YoutubeVideo::addSnippetFromJson(nlohmann::json &t_snippet) {
+        setTitle(getJsonField(t_snippet, "title"));
+        setChannelId(getJsonField(t_snippet, "channelId"));
+        setChannelTitle(getJsonField(t_snippet, "channelTitle"));
+        setTags(getJsonField(t_snippet, "tags"));
+        setDefaultLanguage(getJsonField(t_snippet, "defaultLanguage"));
+        setDefaultAudioLanguage(getJsonField(t_snippet, "defaultAudioLanguage"));
+        setDescription(getJsonField(t_snippet, "description"));
+        setCategoryId(getJsonField(t_snippet, "categoryId"));
+        setLiveBroadcastContent(getJsonField(t_snippet, "liveBroadcastContent"));
+        setPublishedAt(getJsonField(t_snippet, "publishedAt"));
+
+        if (t_snippet.find("localized") != t_snippet.end()) {
+            setLocalizedTitle(getJsonField(getJsonField(t_snippet, "localized"), "title"));
+            setLocalizedDescription(getJsonField(getJsonField(t_snippet, "localized"), "description"));
+        }
+
+        if (t_snippet.find("thumbnails") != t_snippet.end()) {
+            setThumbnails(getJsonField(t_snippet, "thumbnails"));
+        }
+    }
+
+    /**
+     * Populates the content details part.
+     *
+     * @param t_contentDetails  The resource's "contentDetails" object.
+     */
+    void YoutubeVideo::addContentDetailsFromJson(nlohmann::json &t_contentDetails) {
+        setDuration(getJsonField(t_contentDetails, "duration"));
+        setDimension(getJsonField(t_contentDetails, "dimension"));
+        setDefinition(getJsonField(t_contentDetails, "definition"));
+        setHasCaptions(getJsonField(t_contentDetails, "caption"));
+        setIsLicensedContent(getJsonField(t_contentDetails, "licensedContent"));
+        nlohmann::json &regionRestriction = getJsonField(t_contentDetails, "regionRestriction");
+        setRegionRestrictionWhitelist(getJsonField(regionRestriction, "allowed"));
+        setRegionRestrictionBlacklist(getJsonField(regionRestriction, "blocked"));
+        // TODO: Content rating is SKIPPED for now.
+        setProjection(getJsonField(t_contentDetails, "projection"));
+        setHasCustomThumbnail(getJsonField(t_contentDetails, "hasCustomThumbnail"));
+    }
+
+    /**
+     * Populates the status part.
+     *
+     * @param t_status  The resource's "status" object.
+     */
+    void YoutubeVideo::addStatusFromJson(nlohmann::json &t_status) {
+        setUploadStatus(getJsonField(t_status, "uploadStatus"));
+        if (t_status.find("failureReason") != t_status.end()) {
+            setFailureReason(getJsonField(t_status, "failureReason"));
+        }
+        if (t_status.find("rejectionReason") != t_status.end()) {
+            setRejectionReason(getJsonField(t_status, "rejectionReason"));
+        }
+        setPrivacyStatus(getJsonField(t_status, "privacyStatus"));
+        setPublishAt(getJsonField(t_status, "publishAt"));
+        setLicense(getJsonField(t_status, "license"));
+        setIsEmbeddable(getJsonField(t_status, "embeddable"));
+        setPublicStatsViewable(getJsonField(t_status, "publicStatsViewable"));
+    }
+
+    /**
+     * Populates the statistics part.
+     *
+     * @param t_statistics  The resource's "statistics" object.
+     */
+    void YoutubeVideo::addStatisticsFromJson(nlohmann::json &t_statistics) {
+        setViewCount(getJsonField(t_statistics, "viewCount"));
+        setLikeCount(getJsonField(t_statistics, "likeCount"));
+        setDislikeCount(getJsonField(t_statistics, "dislikeCount"));
+        setCommentCount(getJsonField(t_statistics, "commentCount"));
+    }
+
+    /**
+     * Populates the topic details part.
+     *
+     * @param t_topicDetails  The resource's "topicDetails" object.
+     */
+    void YoutubeVideo::addTopicDetailsFromJson(nlohmann::json &t_topicDetails) {
+        setTopicCategories(getJsonField(t_topicDetails, "topicCategories"));
+    }
+
+    /**
+     * Populates the recording details part.
+     *
+     * @param t_recordingDetails  The resource's "recordingDetails" object.
+     */
+    void YoutubeVideo::addRecordingDetailsFromJson(nlohmann::json &t_recordingDetails) {
+        setRecordingDate(getJsonField(t_recordingDetails, "recordingDate"));
+    }
+
+    /**
+     * Populates the file details part.
+     *
+     * @param t_fileDetails  The resource's "fileDetails" object.
+     */
+    void YoutubeVideo::addFileDetailsFromJson(nlohmann::json &t_fileDetails) {
+        setFileName(getJsonField(t_fileDetails, "fileName"));
+        setFileSize(getJsonField(t_fileDetails, "fileSize"));
+        setFileType(getJsonField(t_fileDetails, "fileType"));
+        setContainer(getJsonField(t_fileDetails, "container"));
+        setVideoStreams(getJsonField(t_fileDetails, "videoStreams"));
+        setAudioStreams(getJsonField(t_fileDetails, "audioStreams"));
+        setDurationMs(getJsonField(t_fileDetails, "durationMs"));
+        setBitrateBps(getJsonField(t_fileDetails, "bitrateBps"));
+        setCreationTime(getJsonField(t_fileDetails, "creationTime"));
+    }
+
+    /**
+     * Populates the processing details part.
+     *
+     * @param t_processingDetails  The resource's "processingDetails" object.
+     */
+    void YoutubeVideo::addProcessingDetailsFromJson(nlohmann::json &t_processingDetails) {
+        setProcessingStatus(getJsonField(t_processingDetails, "processingStatus"));
+
+        // These values are really only relevant in a certain video processing status.
+        if (getProcessingStatus() == "processing") {
+            setProcessingProgress(getJsonField(t_processingDetails, "processingProgress"));
+        } else if (getProcessingStatus() == "failed") {
+            setProcessingFailureReason(getJsonField(t_processingDetails, "processingFailureReason"));
+        }
+
+        setFileDetailsAvailability(getJsonField(t_processingDetails, "fileDetailsAvailability"));
+        setProcessingIssuesAvailability(getJsonField(t_processingDetails, "processingIssuesAvailability"));
+        setTagSuggestionsAvailability(getJsonField(t_processingDetails, "tagSuggestionsAvailability"));
+        setEditorSuggestionsAvailability(getJsonField(t_processingDetails, "editorSuggestionsAvailability"));
+        setThumbnailsAvailability(getJsonField(t_processingDetails, "thumbnailsAvailability"));
+    }
+
+    /**
+     * Populates the suggestions part.
+     *
+     * @param t_suggestions  The resource's "suggestions" object.
+     */
+    void YoutubeVideo::addSuggestionsFromJson(nlohmann::json &t_suggestions) {
+        setProcessingErrors(getJsonField(t_suggestions, "processingErrors"));
+        setProcessingWarnings(getJsonField(t_suggestions, "processingWarnings"));
+        setProcessingHints(getJsonField(t_suggestions, "processingHints"));
+        setTagSuggestions(getJsonField(t_suggestions, "tagSuggestions"));
+        setEditorSuggestions(getJsonField(t_suggestions, "editorSuggestions"));
+    }
+
+    typedef void (YoutubeVideo::*partParser_t)(nlohmann::json &);
+
+    // Parser of every part, in VideoPart order.
+    static const partParser_t VIDEO_PART_PARSERS[VIDEO_PART_COUNT] = {
+            &YoutubeVideo::addSnippetFromJson,
+            &YoutubeVideo::addContentDetailsFromJson,
+            &YoutubeVideo::addStatisticsFromJson,
+            &YoutubeVideo::addStatusFromJson,
+            &YoutubeVideo::setPlayer,
+            &YoutubeVideo::addTopicDetailsFromJson,
+            &YoutubeVideo::addRecordingDetailsFromJson,
+            &YoutubeVideo::addFileDetailsFromJson,
+            &YoutubeVideo::addProcessingDetailsFromJson,
+            &YoutubeVideo::addSuggestionsFromJson,
+            &YoutubeVideo::setLiveStreamingDetails,
+            &YoutubeVideo::setLocalizations
+    };
+
+    /**
+     * Populates the video from a video (or playlistItem) resource.
+     *
+     * @param t_json    The resource.
+     * @param t_parts   Parts to parse, the rest are ignored even if present (parts requested in the same
+     *                  videos.list() call, see VideoParts::parse).
+     */
+    void YoutubeVideo::addFromJson(const nlohmann::json &t_json, VideoParts t_parts) {
+        // The setters consume what they parse, so leave the caller's JSON alone.
+        addFromJson(nlohmann::json(t_json), t_parts);
+    }
+
+    /**
+     * Populates the video from a video (or playlistItem) resource, moving its strings instead of copying them.
+     *
+     * @param t_json    The resource, left with empty strings wherever values were taken.
+     * @param t_parts   Parts to parse, see above.
+     */
+    void YoutubeVideo::addFromJson(nlohmann::json &&t_json, VideoParts t_parts) {
         try {
             // General.
 
             // Set the Video ID (not as simple as it seems)
-            if (t_json["kind"] == "youtube#video") {
+            // (Compared as std::string, comparing the JSON to a literal converts the literal to JSON first.)
+            static const std::string noKind;
+            nlohmann::json &kind = getJsonField(t_json, "kind");
+            const std::string &kindName = kind.is_string() ? kind.get_ref<const std::string &>() : noKind;
+
+            if (kindName == "youtube#video") {
                 // Normal case: ID is easily available in the root.
-                setId(t_json["id"]);
-            } else if (t_json["kind"] == "youtube#playlistItem") {
+                setId(getJsonField(t_json, "id"));
+            } else if (kindName == "youtube#playlistItem") {
                 // The "id" field in playlistItem is the item's ID, not the video's.
 
                 // The actual video ID can be found inside of the parts.
                 if (t_json.find("contentDetails") != t_json.end()) {
-                    setId(t_json["contentDetails"]["videoId"]);
+                    setId(getJsonField(getJsonField(t_json, "contentDetails"), "videoId"));
                 } else if (t_json.find("snippet") != t_json.end()) {
+                    nlohmann::json &snippet = getJsonField(t_json, "snippet");
+
                     // Make sure the resourceId object exists.
-                    if (t_json["snippet"].find("resourceId") != t_json["snippet"].end()) {
+                    if (snippet.find("resourceId") != snippet.end()) {
+                        nlohmann::json &resourceId = getJsonField(snippet, "resourceId");
+
                         // Make sure it's of the expected kind.
-                        if (t_json["snippet"]["resourceId"]["kind"] == "youtube#video") {
-                            setId(t_json["snippet"]["resourceId"]["videoId"]);
+                        if (getJsonField(resourceId, "kind") == "youtube#video") {
+                            setId(getJsonField(resourceId, "videoId"));
                         } else{
                             addError("Unable to set video ID: "
                                      "['snippet']['resourceId']['kind'] == "
-                                     + t_json["snippet"]["resourceId"]["kind"].get<std::string>()
+                                     + getJsonField(resourceId, "kind").get<std::string>()
                                      + ", expected 'youtube#video'!");
                         }
                     }
@@ -1934,172 +1864,22 @@ namespace sane {
                 }
             } else {
                 // Kind is of unexpected type.
-                addError("Unable to set video ID: Unexpected kind: " + t_json["kind"].get<std::string>());
+                addError("Unable to set video ID: Unexpected kind: " + kind.get<std::string>());
             }
 
-            // Add properties to various parts (if they exist).
-
-            // Part: Snippet.
-            if (t_json.find("snippet") != t_json.end()) {
-                nlohmann::json snippet = t_json["snippet"];
-                hasPartSnippet = true;
-
-                setTitle(snippet["title"]);
-                setChannelId(snippet["channelId"]);
-                setChannelTitle(snippet["channelTitle"]);
-                setTags(snippet["tags"]);
-                setDefaultLanguage(snippet["defaultLanguage"]);
-                setDefaultAudioLanguage(snippet["defaultAudioLanguage"]);
-                setDescription(snippet["description"]);
-                setCategoryId(snippet["categoryId"]);
-                setLiveBroadcastContent(snippet["liveBroadcastContent"]);
-                setPublishedAt(snippet["publishedAt"]);
-
-                if (snippet.find("localized") != snippet.end()) {
-                    setLocalizedTitle(snippet["localized"]["title"]);
-                    setLocalizedDescription(snippet["localized"]["description"]);
+            // Add properties of the requested parts (if they exist).
+            for (size_t i = 0; i < VIDEO_PART_COUNT; i++) {
+                auto part = (VideoPart)i;
+                if (!t_parts.has(part)) {
+                    continue;
                 }
 
-                if (snippet.find("thumbnails") != snippet.end()) {
-                    setThumbnails(snippet["thumbnails"]);
+                auto partJson = t_json.find(getVideoPartKey(part));
+                if (partJson != t_json.end()) {
+                    m_parts = m_parts.with(part);
+                    (this->*VIDEO_PART_PARSERS[i])(*partJson);
                 }
             }
-
-            // Part: Content details.
-            if (t_json.find("contentDetails") != t_json.end()) {
-                nlohmann::json contentDetails = t_json["contentDetails"];
-                hasPartContentDetails = true;
-
-                setDuration(contentDetails["duration"]);
-                setDimension(contentDetails["dimension"]);
-                setDefinition(contentDetails["definition"]);
-                setHasCaptions(contentDetails["caption"]);
-                setIsLicensedContent(contentDetails["licensedContent"]);
-                setRegionRestrictionWhitelist(contentDetails["regionRestriction"]["allowed"]);
-                setRegionRestrictionBlacklist(contentDetails["regionRestriction"]["blocked"]);
-                // TODO: Content rating is SKIPPED for now.
-                setProjection(contentDetails["projection"]);
-                setHasCustomThumbnail(contentDetails["hasCustomThumbnail"]);
-            }
-
-            // Part: Status.
-            if (t_json.find("status") != t_json.end()) {
-                nlohmann::json status = t_json["status"];
-                hasPartStatus = true;
-
-                setUploadStatus(status["uploadStatus"]);
-                if (status.find("failureReason") != status.end()) {
-                    setFailureReason(status["failureReason"]);
-                }
-                if (status.find("rejectionReason") != status.end()) {
-                    setRejectionReason(status["rejectionReason"]);
-                }
-                setPrivacyStatus(status["privacyStatus"]);
-                setPublishAt(status["publishAt"]);
-                setLicense(status["license"]);
-                setIsEmbeddable(status["embeddable"]);
-                setPublicStatsViewable(status["publicStatsViewable"]);
-            }
-
-            // Part: Statistics
-            if (t_json.find("statistics") != t_json.end()) {
-                nlohmann::json statistics = t_json["statistics"];
-                hasPartStatistics = true;
-
-                setViewCount(statistics["viewCount"]);
-                setLikeCount(statistics["likeCount"]);
-                setDislikeCount(statistics["dislikeCount"]);
-                setCommentCount(statistics["commentCount"]);
-            }
-
-            // Part: Player
-            if (t_json.find("player") != t_json.end()) {
-                nlohmann::json player = t_json["player"];
-                hasPartPlayer = true;
-
-                setPlayer(player);
-            }
-
-            // Part: Topic details
-            if (t_json.find("topicDetails") != t_json.end()) {
-                nlohmann::json topicDetails = t_json["topicDetails"];
-                hasPartTopicDetails = true;
-
-                setTopicCategories(topicDetails["topicCategories"]);
-            }
-
-            // Part: Recording details.
-            if (t_json.find("recordingDetails") != t_json.end()) {
-                nlohmann::json recordingDetails = t_json["recordingDetails"];
-                hasPartRecordingDetails = true;
-
-                setRecordingDate(recordingDetails["recordingDate"]);
-            }
-
-            // Part: File details.
-            if (t_json.find("fileDetails") != t_json.end()) {
-                nlohmann::json fileDetails = t_json["fileDetails"];
-                hasPartFileDetails = true;
-
-                setFileName(fileDetails["fileName"]);
-                setFileSize(fileDetails["fileSize"]);
-                setFileType(fileDetails["fileType"]);
-                setContainer(fileDetails["container"]);
-                setVideoStreams(fileDetails["videoStreams"]);
-                setAudioStreams(fileDetails["audioStreams"]);
-                setDurationMs(fileDetails["durationMs"]);
-                setBitrateBps(fileDetails["bitrateBps"]);
-                setCreationTime(fileDetails["creationTime"]);
-            }
-
-            // Part: Processing details.
-            if (t_json.find("processingDetails") != t_json.end()) {
-                nlohmann::json processingDetails = t_json["processingDetails"];
-                hasPartProcessingDetails = true;
-
-                setProcessingStatus(processingDetails["processingStatus"]);
-
-                // These values are really only relevant in a certain video processing status.
-                if (getProcessingStatus() == "processing") {
-                    setProcessingProgress(processingDetails["processingProgress"]);
-                } else if (getProcessingStatus() == "failed") {
-                    setProcessingFailureReason(processingDetails["processingFailureReason"]);
-                }
-
-                setFileDetailsAvailability(processingDetails["fileDetailsAvailability"]);
-                setProcessingIssuesAvailability(processingDetails["processingIssuesAvailability"]);
-                setTagSuggestionsAvailability(processingDetails["tagSuggestionsAvailability"]);
-                setEditorSuggestionsAvailability(processingDetails["editorSuggestionsAvailability"]);
-                setThumbnailsAvailability(processingDetails["thumbnailsAvailability"]);
-            }
-
-            // Part: Suggestions
-            if (t_json.find("suggestions") != t_json.end()) {
-                nlohmann::json suggestions = t_json["suggestions"];
-                hasPartSuggestions = true;
-
-                setProcessingErrors(suggestions["processingErrors"]);
-                setProcessingWarnings(suggestions["processingWarnings"]);
-                setProcessingHints(suggestions["processingHints"]);
-                setTagSuggestions(suggestions["tagSuggestions"]);
-                setEditorSuggestions(suggestions["editorSuggestions"]);
-            }
-
-            // Part: Live streaming details.
-            if (t_json.find("liveStreamingDetails") != t_json.end()) {
-                nlohmann::json liveStreamingDetails = t_json["liveStreamingDetails"];
-                hasPartLiveStreamingDetails = true;
-
-                setLiveStreamingDetails(liveStreamingDetails);
-            }
-
-            // Part: Localizations.
-            if (t_json.find("localizations") != t_json.end()) {
-                nlohmann::json localizations = t_json["localizations"];
-                hasPartLocalizations = true;
-
-                setLocalizations(localizations);
-            }
         } catch (nlohmann::detail::type_error &exc) {
             addError("Skipping YoutubeVideo::addFromJson due to Exception: " + std::string(exc.what()), t_json);
         } catch (const std::exception &exc) {
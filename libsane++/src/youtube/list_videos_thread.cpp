@@ -4,89 +4,187 @@
 #include <youtube/toolkit.hpp>
 
 namespace sane {
-    ListVideosThread::ListVideosThread(const std::string &t_part, const std::map<std::string, std::string> &t_filter,
+    /**
+     * Replaces the playlistItems-specific filters with 'id=', the list of video IDs in a playlistItems response.
+     *
+     * @param t_playlistItemsJson   playlistItems.list() response (with the contentDetails part).
+     * @param t_filter              Filter to update.
+     */
+    static void setVideoIdFilter(const nlohmann::json &t_playlistItemsJson, std::map<std::string, std::string> &t_filter) {
+        // 1. Clear playlistItems-specific filters:
+        t_filter.erase("playlistId");
+
+        // 2. Populate filter 'id=' with list of video IDs from the playlistItems response.
+        bool firstItem = true;
+        for (const auto& playlistItemJson : t_playlistItemsJson["items"]) {
+            // The "id" field in playlistItem is the item's ID, not the video's.
+
+            // The actual video ID can be found inside of the parts.
+            if (playlistItemJson.find("contentDetails") != playlistItemJson.end()) {
+                if (firstItem) {
+                    // Don't prepend comma to first item.
+                    t_filter["id"] = playlistItemJson["contentDetails"]["videoId"].get<std::string>();
+
+                    firstItem = false;
+                } else {
+                    // Append id to string, prepended with comma.
+                    t_filter["id"] += "," + playlistItemJson["contentDetails"]["videoId"].get<std::string>();
+                }
+            } else {
+                // Kind is playlistItem, but no snippet or contentDetails were provided.
+                std::cerr << "listUploadedVideos Error: Unable to set video ID: Kind is youtube#playlistItem, "
+                          << "but contentDetails parts was not available!" << std::endl;
+            } // if contentDetails in playlistItemJson
+        } // for playlistItemJson in current playlistItemsJson
+    }
+
+    ListVideosThread::ListVideosThread(VideoParts t_parts, const std::map<std::string, std::string> &t_filter,
                                        const std::map<std::string, std::string> &t_optParams,
-                                       const std::string &t_playlistItemsPart) {
-        m_part = t_part;
+                                       const std::string &t_playlistItemsPart,
+                                       const requestContext_t &t_context,
+                                       std::shared_ptr<MPSCQueue<listVideosResult_t>> t_completionQueue,
+                                       std::shared_ptr<BoundedQueue<std::shared_ptr<const std::string>>> t_bodyQueue) {
+        m_parts = t_parts;
+        m_part = t_parts.toString();
         m_filter = t_filter;
         m_optParams = t_optParams;
         m_playlistItemsPart = t_playlistItemsPart;
+        m_context = t_context;
+        m_completionQueue = std::move(t_completionQueue);
+        m_bodyQueue = std::move(t_bodyQueue);
     }
 
     void ListVideosThread::listVideos() {
-        started = true;
+        // The playlistId filter is swapped out for video IDs further down.
+        const std::string playlistId = m_filter["playlistId"];
 
         nlohmann::json playlistItemsJson;
         nlohmann::json videoListJson;
+        std::shared_ptr<const std::string> videosBody;
 
-        // Instantiate API Handler
-        std::shared_ptr<sane::APIHandler> api = std::make_shared<sane::APIHandler>();
+        // Instantiate API Handler (bound to the refresh's deadline and cancellation token).
+        std::shared_ptr<sane::APIHandler> api = std::make_shared<sane::APIHandler>(m_context);
 
         // Make the SAPI request and retrieve (a rather limited) JSON.
         //
-        // NB: Note using t_playlistItemsPart (likely only contentDetails), not t_part.
+        // NB: Note using t_playlistItemsPart (likely only contentDetails), not t_parts.
         //
         // Due to the limited amount of info in youtube#playlistItems we only request the part that holds videoId,
         // and then we perform a separate videos.list() API request for those IDs further down the line.
         try {
             playlistItemsJson = api->youtubeListPlaylistItems(m_playlistItemsPart, m_filter, m_optParams);
 
-            // Make sure the playlistItemsJson response was valid and contains items.
-            if (hasItems(playlistItemsJson)) {
+            // Make sure the playlistItemsJson response was valid and contains items
+            // (and that there is still time left to make use of them).
+            if (hasItems(playlistItemsJson) and !m_context.shouldAbort()) {
                 // Do some separate videos.list() API request for current playlist items to actually obtain useful info:
 
-                // 1. Clear playlistItems-specific filters:
-                m_filter.erase("playlistId");
-
-                // 2. Populate filter 'id=' with list of video IDs from the playlistItems response.
-                bool firstItem = true;
-                for (const auto& playlistItemJson : playlistItemsJson["items"]) {
-                    // The "id" field in playlistItem is the item's ID, not the video's.
-
-                    // The actual video ID can be found inside of the parts.
-                    if (playlistItemJson.find("contentDetails") != playlistItemJson.end()) {
-                        if (firstItem) {
-                            // Don't prepend comma to first item.
-                            m_filter["id"] = playlistItemJson["contentDetails"]["videoId"].get<std::string>();
-
-                            firstItem = false;
-                        } else {
-                            // Append id to string, prepended with comma.
-                            m_filter["id"] += "," + playlistItemJson["contentDetails"]["videoId"].get<std::string>();
-                        }
-                    } else {
-                        // Kind is playlistItem, but no snippet or contentDetails were provided.
-                        std::cerr << "listUploadedVideos Error: Unable to set video ID: Kind is youtube#playlistItem, "
-                                  << "but contentDetails parts was not available!" << std::endl;
-                    } // if contentDetails in playlistItemJson
-                } // for playlistItemJson in current playlistItemsJson
+                // 1.-2. Swap the playlistId filter for the video IDs in the playlistItems response.
+                setVideoIdFilter(playlistItemsJson, m_filter);
 
                 // 3. Request proper information for the current video IDs using the API's videos.list().
     //                std::cout << "\tRetrieving additional video info... " << std::endl;
                 try {
-                    videoListJson = api->youtubeListVideos(m_part, m_filter, m_optParams);
-
-                    // Make sure the videoListJson response was valid.
-                    if (!videoListJson.empty()) {
-                        // FIXME: No pagination support, will cutoff at 50 max.
-                        videosJson = videoListJson["items"];
-                    } // if videoListJson not empty
+                    if (m_bodyQueue) {
+                        // Parsing is left to the pipeline's parse stage, this thread is for network I/O.
+                        videosBody = api->youtubeListVideosBody(m_part, m_filter, m_optParams);
+                    } else {
+                        videoListJson = api->youtubeListVideos(m_part, m_filter, m_optParams);
+
+                        // Make sure the videoListJson response was valid.
+                        if (!videoListJson.empty()) {
+                            // FIXME: No pagination support, will cutoff at 50 max.
+                            videosJson = videoListJson["items"];
+                        } // if videoListJson not empty
+                    }
                 } catch (std::exception &exc) {
-                std::cerr << "Exception occurred while videoListJson thread "
-                          << getThreadId() << ": " << std::string(exc.what())  << "\n" << std::endl;
+                    std::cerr << "Exception occurred while listing videos of playlist " << playlistId << ": "
+                              << std::string(exc.what()) << "\n" << std::endl;
                 } // try/catch: videoListJson
 
             } // if playlistItemsJson not empty
         } catch (std::exception &exc) {
-            std::cerr << "Exception occurred while playlistItemsJson thread "
-                      << getThreadId() << ": " << std::string(exc.what())  << "\n" << std::endl;
+            std::cerr << "Exception occurred while listing playlist items of playlist " << playlistId << ": "
+                      << std::string(exc.what()) << "\n" << std::endl;
         } // try/catch: playlistItemsJson
-        // Thread info
-        finished = true;
+        // Feedback for adaptive concurrency control: how fast the API answered, not how long quota and retries took.
+        m_latencyMs = api->getAverageTransferMs();
+        m_overloaded = api->getOverloadSignalCount() > 0;
+
+        // Pass the body on, this blocks (after the latency was taken) while the parse stage is backed up.
+        if (m_bodyQueue and videosBody and !videosBody->empty()) {
+            m_bodyQueue->push(std::move(videosBody));
+        }
+
+        // Hand the result over to whoever is harvesting, this is the last thing the thread does.
+        if (m_completionQueue) {
+            listVideosResult_t result;
+            result.playlistId = playlistId;
+            result.latencyMs = m_latencyMs;
+            result.overloaded = m_overloaded;
+            result.aborted = m_context.shouldAbort();
+
+            m_completionQueue->push(std::move(result));
+        }
+    }
+
+#ifdef SANE_ENABLE_COROUTINES
+    /**
+     * Coroutine version of listVideos: the same playlistItems -> videos.list() flow, awaited on t_loop so that any
+     * number of playlists can be in flight on one thread.
+     *
+     * The videos end up in get() (the body queue, which could block the loop, is not used), and the result is
+     * pushed to the completion queue as usual.
+     *
+     * @param t_loop    Event loop to run the requests on.
+     */
+    Task<void> ListVideosThread::listVideosAsync(EventLoop &t_loop) {
+        if (m_started.exchange(true)) {
+            std::cerr << "ERROR: ListVideosThread is ALREADY RUNNING for playlist: "
+                      << m_filter["playlistId"] << std::endl;
+            co_return;
+        }
+
+        const std::string playlistId = m_filter["playlistId"];
+        APIHandler api(m_context);
+
+        try {
+            nlohmann::json playlistItemsJson = co_await api.youtubeListPlaylistItemsAsync(
+                    t_loop, m_playlistItemsPart, m_filter, m_optParams);
+
+            if (hasItems(playlistItemsJson) and !m_context.shouldAbort()) {
+                setVideoIdFilter(playlistItemsJson, m_filter);
+
+                nlohmann::json videoListJson = co_await api.youtubeListVideosAsync(t_loop, m_part, m_filter,
+                                                                                   m_optParams);
+
+                // FIXME: No pagination support, will cutoff at 50 max.
+                if (hasItems(videoListJson)) {
+                    videosJson = videoListJson["items"];
+                }
+            }
+        } catch (std::exception &exc) {
+            std::cerr << "Exception occurred while listing videos of playlist " << playlistId << ": "
+                      << std::string(exc.what()) << "\n" << std::endl;
+        }
+
+        m_latencyMs = api.getAverageTransferMs();
+        m_overloaded = api.getOverloadSignalCount() > 0;
+
+        if (m_completionQueue) {
+            listVideosResult_t result;
+            result.playlistId = playlistId;
+            result.latencyMs = m_latencyMs;
+            result.overloaded = m_overloaded;
+            result.aborted = m_context.shouldAbort();
+
+            m_completionQueue->push(std::move(result));
+        }
     }
+#endif
 
     void ListVideosThread::run() {
-        if (started) {
+        if (m_started.exchange(true)) {
             std::cerr << "ERROR: ListVideosThread is ALREADY RUNNING for playlist: "
                       << m_filter["playlistId"] << std::endl;
         } else {
@@ -94,6 +192,9 @@ namespace sane {
         }
     }
 
+    /**
+     * @return  The videos, unless the response body was handed over to a pipeline to be parsed.
+     */
     nlohmann::json ListVideosThread::get() {
         return videosJson;
     }
@@ -102,11 +203,11 @@ namespace sane {
         return m_filter["playlistId"];
     }
 
-    void ListVideosThread::setThreadId(std::thread::id id) {
-        m_threadId = id;
+    long ListVideosThread::getLatency() {
+        return m_latencyMs;
     }
 
-    std::thread::id ListVideosThread::getThreadId() {
-        return m_threadId;
+    bool ListVideosThread::wasOverloaded() {
+        return m_overloaded;
     }
 } // namespace sane
\ No newline at end of file
@@ -5,16 +5,24 @@
 #include <thread>
 #include <future>
 #include <chrono>
+#include <algorithm>
+#include <unordered_set>
 
 #include <entities/common.hpp>
 #include <entities/youtube_channel.hpp>
 #include <entities/youtube_video.hpp>
+#include <entities/packed_ids.hpp>
+#include <entities/feed_item.hpp>
 #include <api_handler/api_handler.hpp>
 
 #include <youtube/subfeed.hpp>
 #include <db_handler/db_youtube_channels.hpp>
 #include <youtube/list_videos_thread.hpp>
 #include <config_handler/config_handler.hpp>
+#include <concurrency/aimd_limiter.hpp>
+#include <concurrency/mpsc_queue.hpp>
+#include <concurrency/bounded_queue.hpp>
+#include <concurrency/work_stealing_scheduler.hpp>
 
 namespace sane {
     void updateProgressLine(size_t total, int current) {
@@ -34,31 +42,60 @@ namespace sane {
         std::cout << "\r" << "Retrieving " << "\"Uploaded Videos\" playlists... "
                   << progressPercentString << "% " << "(" << progressLine << ")" << std::flush;
     }
-    std::list<std::shared_ptr<YoutubeVideo>> listUploadedVideos(const std::list<std::string> &t_playlists,
-
-                                                                const std::string &t_part,
-                                                                const std::map<std::string, std::string> &t_filter,
-                                                                const std::map<std::string, std::string> &t_optParams,
-                                                                const std::string &t_playlistItemsPart) {
-        using std::chrono_literals::operator""s;
+    /**
+     * Fetch stage of the threaded refreshes: fetches every given playlist's videos, a fetch task per playlist,
+     * and hands the videos.list() response bodies to t_bodyQueue. Returns once every fetch is done, leaving the
+     * queue open for the caller to close.
+     *
+     * Fetch tasks run on a work-stealing scheduler sized to the concurrency ceiling. The number of tasks in flight
+     * is adapted to how well the API copes: it grows while latency stays flat and is cut back on rate limiting,
+     * server errors or latency spikes.
+     *
+     * If t_context expires before all playlists are done, in-flight requests are cancelled and
+     * pending playlists are skipped.
+     *
+     * @param t_playlists           Playlist IDs.
+     * @param t_parts               Part(s) to request in videos.list().
+     * @param t_filter              Filter, playlistId is overridden per playlist.
+     * @param t_optParams           Optional parameters.
+     * @param t_playlistItemsPart   Part(s) to request in playlistItems.list() (must contain videoId).
+     * @param t_context             Refresh-wide deadline and cancellation token.
+     * @param t_bodyQueue           Queue the response bodies are pushed to.
+     * @param t_stats               Pointer to a refreshStats_t to fill in (all but elapsedMs), nullptr to disable.
+     */
+    static void fetchUploadedPlaylists(const std::list<std::string> &t_playlists,
+                                       VideoParts t_parts,
+                                       const std::map<std::string, std::string> &t_filter,
+                                       const std::map<std::string, std::string> &t_optParams,
+                                       const std::string &t_playlistItemsPart,
+                                       const requestContext_t &t_context,
+                                       const std::shared_ptr<BoundedQueue<std::shared_ptr<const std::string>>>
+                                               &t_bodyQueue,
+                                       refreshStats_t *t_stats) {
         using std::chrono_literals::operator""ms;
 
         int playlistCounter = 0;
-        int activeThreads = 0;
-        int threadLimit = 1;
-        std::list<std::map<std::string, std::string>> filters;
-        std::list<std::thread> threads;
-        std::map<std::thread::id, int> exceptionThreads = std::map<std::thread::id, int>();
-        std::list<std::shared_ptr<ListVideosThread>> videoThreadObjects;
-        std::map<std::thread::id, std::shared_ptr<ListVideosThread>> idMap;
-        std::list<std::shared_ptr<YoutubeVideo>> videos;
-        nlohmann::json playlistItemsJson;
-        nlohmann::json videoListJson;
+        size_t playlistsCompleted = 0;
+        std::list<std::shared_ptr<ListVideosThread>> pendingThreadObjects;
+        size_t inFlight = 0;
+        bool budgetExceeded = false;
+        size_t playlistsSkipped = 0;
+
+        // Fetch tasks push their result here when done.
+        auto completionQueue = std::make_shared<MPSCQueue<listVideosResult_t>>();
 
+        // Concurrency starts out at threading/subsfeed_refresh and is then adapted (AIMD) between 1 and
+        // threading/subsfeed_refresh_max, unless threading/subsfeed_refresh_adaptive is set to 0.
         std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
-        if (cfg->isNumber("threading/subsfeed_refresh")) {
-            threadLimit = cfg->getInt("threading/subsfeed_refresh");
-        }
+        int initialLimit = std::max(cfg->getInt("threading/subsfeed_refresh", 1), 1);
+        bool adaptive = cfg->getInt("threading/subsfeed_refresh_adaptive", 1) != 0;
+        int maxLimit = cfg->getInt("threading/subsfeed_refresh_max", SUBFEED_DEFAULT_MAX_CONCURRENCY);
+
+        AIMDLimiter limiter(initialLimit, adaptive ? 1 : initialLimit, adaptive ? maxLimit : initialLimit);
+
+        // Playlists differ wildly in cost (one has 50 new videos, another none), so fetches run on reused workers
+        // that steal from each other rather than on a thread apiece. The limiter decides how many are in flight.
+        WorkStealingScheduler fetchScheduler((size_t)(adaptive ? std::max(maxLimit, initialLimit) : initialLimit));
 
         // This print can be anything as long as it's shorter than the progress line print below.
         updateProgressLine(t_playlists.size(), playlistCounter);
@@ -87,132 +124,453 @@ namespace sane {
             filter["playlistId"] = playlist;
 
             // Initialize a ListVideosThread object
-            std::shared_ptr<ListVideosThread> p =
-                    std::make_shared<ListVideosThread>(t_part, filter, t_optParams, t_playlistItemsPart);
+            std::shared_ptr<ListVideosThread> p = std::make_shared<ListVideosThread>(
+                    t_parts, filter, t_optParams, t_playlistItemsPart, t_context, completionQueue, t_bodyQueue);
 
             // Add it to the list.
-            videoThreadObjects.emplace_back(p);
+            pendingThreadObjects.emplace_back(p);
         } // for playlist in t_playlists
 
         // Do threading
-        bool threadingDone = false;
-        while (!threadingDone) {
-            // Only iterate through ListVideoThread objects if there's open thread slots (slight speedup).
-            if (activeThreads < threadLimit) {
-                // Iterate ListVideoThread objects until an un-started one is found.
-                for (auto &videoThreadObject : videoThreadObjects) {
-                    // Spawn a new thread unless limit is reached
-                    if (activeThreads < threadLimit) {
-                        if (!videoThreadObject->started) {
-                            // Spawn thread and run task on the new thread:
-                            // - Use a heap-allocated object and a reference-counted pointer
-                            //   to ensure that the object stays around as long as the thread does.
-                            std::thread thread(&ListVideosThread::run, videoThreadObject);
-                            std::thread::id threadId = thread.get_id();
-
-                            // Associate the thread ID with videoThreadObject.
-                            idMap[threadId] = videoThreadObject;
-
-//                            std::cout << "Started thread: " << threadId
-//                                      << " [" << videoThreadObject->getPlaylist() << "]" << std::endl;
-
-                            // Append thread to list of threads.
-                            threads.push_back(std::move(thread));
-
-                            // Increment active threads counter.
-                            ++activeThreads;
-                        }
-                    }
+        while (!pendingThreadObjects.empty() or inFlight > 0) {
+            // Refresh budget exhausted: abort in-flight requests and drop playlists that never got a thread.
+            if (!budgetExceeded and t_context.shouldAbort()) {
+                budgetExceeded = true;
+
+                if (t_context.cancellationToken) {
+                    t_context.cancellationToken->cancel();
                 }
+
+                playlistsSkipped += pendingThreadObjects.size();
+                pendingThreadObjects.clear();
+            }
+
+            // Submit pending playlists while there are open slots.
+            while (!pendingThreadObjects.empty() and (int)inFlight < limiter.getLimit()) {
+                // The task holds a reference-counted pointer to ensure that the object stays around as long as
+                // the task does.
+                std::shared_ptr<ListVideosThread> listVideosThread = pendingThreadObjects.front();
+                pendingThreadObjects.pop_front();
+
+                fetchScheduler.submit([listVideosThread]() { listVideosThread->run(); });
+                inFlight++;
             }
 
-            // Join threads (if any).
-            // Use iterator and while loop in order to delete joined items as we traverse.
-            auto threadIter = threads.begin();
-            while (threadIter != threads.end()) {
-                // Check the ID map If thread is associated with a finished object.
-                if (idMap[threadIter->get_id()]->finished) {
-                    // Attempt to synchronize the thread.
+            if (inFlight == 0) {
+                continue;
+            }
+
+            // Sleep until a fetch is done, waking up now and then to keep an eye on the refresh budget.
+            listVideosResult_t result;
+            if (!completionQueue->waitPop(result, 100ms)) {
+                continue;
+            }
+
+            // Harvest everything that has completed by now.
+            do {
+                inFlight--;
+
+                // Let the limiter know how the API coped (aborted requests say nothing about that).
+                if (!budgetExceeded) {
+                    limiter.onResult(result.latencyMs, result.overloaded);
+                }
+
+                // Cut short by the refresh budget, whatever it got is still used, but it doesn't count as completed.
+                if (!result.aborted) {
+                    playlistsCompleted++;
+                }
+
+                // Update progress info.
+                updateProgressLine(t_playlists.size(), playlistCounter++);
+            } while (completionQueue->tryPop(result));
+        } // while fetches are pending or running
+
+        fetchScheduler.wait();
+
+        std::cout << std::endl;  // Newline after playlist counter is done.
+
+        if (budgetExceeded) {
+            std::cerr << "listUploadedVideos WARNING: Refresh budget exceeded, returning a partial feed ("
+                      << playlistsSkipped << " of " << t_playlists.size() << " playlists were skipped)." << std::endl;
+        }
+
+        if (t_stats != nullptr) {
+            t_stats->playlistsTotal = t_playlists.size();
+            t_stats->playlistsSkipped = playlistsSkipped;
+            t_stats->playlistsCompleted = playlistsCompleted;
+            t_stats->budgetExceeded = budgetExceeded;
+            t_stats->concurrency = limiter.getLimit();
+            t_stats->peakConcurrency = limiter.getPeakLimit();
+            t_stats->concurrencyDecreases = limiter.getDecreaseCount();
+        }
+    }
+
+    /**
+     * Retrieves the videos of every given playlist (see fetchUploadedPlaylists).
+     *
+     * Response bodies are parsed and turned into YoutubeVideo entities on separate pipeline stages,
+     * see threading/subsfeed_parse_workers, subsfeed_build_workers and subsfeed_pipeline_capacity.
+     *
+     * If t_context expires before all playlists are done, the videos retrieved so far are returned.
+     *
+     * @param t_playlists           Playlist IDs.
+     * @param t_part                Part(s) to request in videos.list().
+     * @param t_filter              Filter, playlistId is overridden per playlist.
+     * @param t_optParams           Optional parameters.
+     * @param t_playlistItemsPart   Part(s) to request in playlistItems.list() (must contain videoId).
+     * @param t_context             Refresh-wide deadline and cancellation token.
+     * @param t_stats               Pointer to a refreshStats_t to fill in, send in nullptr to disable.
+     * @return                      List of videos.
+     */
+    std::list<std::shared_ptr<YoutubeVideo>> listUploadedVideos(const std::list<std::string> &t_playlists,
+                                                                const std::string &t_part,
+                                                                const std::map<std::string, std::string> &t_filter,
+                                                                const std::map<std::string, std::string> &t_optParams,
+                                                                const std::string &t_playlistItemsPart,
+                                                                const requestContext_t &t_context,
+                                                                refreshStats_t *t_stats) {
+        std::list<std::shared_ptr<YoutubeVideo>> videos;
+        auto refreshStart = std::chrono::steady_clock::now();
+
+        // Parsed once, the same parts then drive both the videos.list() requests and parsing their responses.
+        VideoParts parts = VideoParts::parse(t_part);
+
+        std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+
+        // The refresh is a pipeline: fetch (ListVideosThreads) -> parse -> entity build -> merge.
+        // Every stage has its own workers and the stages are connected by bounded queues, so network waits don't
+        // hold up parsing, parsing doesn't hold up the network, and at most pipelineCapacity items pile up
+        // between any two stages.
+        int parseWorkers = std::max(cfg->getInt("threading/subsfeed_parse_workers", SUBFEED_DEFAULT_PARSE_WORKERS), 1);
+        int buildWorkers = std::max(cfg->getInt("threading/subsfeed_build_workers", SUBFEED_DEFAULT_BUILD_WORKERS), 1);
+        size_t pipelineCapacity = (size_t)std::max(cfg->getInt("threading/subsfeed_pipeline_capacity",
+                                                               SUBFEED_DEFAULT_PIPELINE_CAPACITY), 1);
+
+        auto bodyQueue = std::make_shared<BoundedQueue<std::shared_ptr<const std::string>>>(pipelineCapacity);
+        BoundedQueue<nlohmann::json> itemsQueue(pipelineCapacity);
+        BoundedQueue<std::list<std::shared_ptr<YoutubeVideo>>> videosQueue(pipelineCapacity);
+        std::vector<std::thread> parseThreads;
+        std::vector<std::thread> buildThreads;
+
+        // Parse stage: videos.list() response body -> its items.
+        for (int i = 0; i < parseWorkers; i++) {
+            parseThreads.emplace_back([&bodyQueue, &itemsQueue]() {
+                std::shared_ptr<const std::string> body;
+                while (bodyQueue->pop(body)) {
                     try {
-                        std::thread::id id = threadIter->get_id();
-                        threadIter->join();
-//                        std::cout << "Joined thread: " << id << std::endl;
-
-                        // Append videos
-                        nlohmann::json videosJson = idMap[id]->get();
-
-                        // For video item in response // FIXME: No pagination support, will cutoff at 50 max.
-                        for (auto videoJson : videosJson) {
-                            // Create the YoutubeVideo entity.
-                            std::shared_ptr<YoutubeVideo> video = std::make_shared<YoutubeVideo>(videoJson);
-
-                            // Finally append the video to the list.
-                            videos.push_back(video);
-                        } // for video in videoListJson
-
-                        // Update progress info.
-                        updateProgressLine(t_playlists.size(), playlistCounter++);
-
-                        // Decrement active threads counter.
-                        --activeThreads;
-
-                        // Cleanup!
-
-                        // Remove associated ListVideoThread object from its list.
-                        auto vtoIter = std::find(videoThreadObjects.begin(), videoThreadObjects.end(), idMap[id]);
-                        videoThreadObjects.erase(vtoIter);
-
-                        // Clear the idMap entry
-                        idMap.erase(id);
-
-                        // Remove thread from threads list (to avoid running into NULL)
-                        // erase() makes the passed iterator invalid, but returns the iterator to
-                        // the next of deleted element
-                        threadIter = threads.erase(threadIter);
-                    } catch (std::exception &exc) {
-                        std::cerr << "Exception occurred while joining thread "
-                                  << threadIter->get_id() << ": " << std::string(exc.what())  << "\n" << std::endl;
-
-                        // Bad thread tracker/scoreboard.
-                        if (exceptionThreads.find(threadIter->get_id()) != exceptionThreads.end()) {
-                            exceptionThreads[threadIter->get_id()]++;
-                        } else {
-                            exceptionThreads[threadIter->get_id()] = 0;
+                        nlohmann::json response = nlohmann::json::parse(*body);
+
+                        // FIXME: No pagination support, will cutoff at 50 max.
+                        if (response.find("items") != response.end() and response["items"].is_array()) {
+                            itemsQueue.push(std::move(response["items"]));
                         }
+                    } catch (nlohmann::detail::parse_error &exc) {
+                        std::cerr << "listUploadedVideos: Skipping unparsable videos response: "
+                                  << std::string(exc.what()) << std::endl;
+                    }
+                }
+            });
+        }
 
-                        std::cerr << "Bad threads: " << std::endl;
-                        std::cerr << "\tScore\tID " << std::endl;
+        // Entity build stage: items -> YoutubeVideo entities.
+        for (int i = 0; i < buildWorkers; i++) {
+            buildThreads.emplace_back([&itemsQueue, &videosQueue, parts]() {
+                nlohmann::json items;
+                while (itemsQueue.pop(items)) {
+                    std::list<std::shared_ptr<YoutubeVideo>> batch;
 
-                        for (const auto &baddie : exceptionThreads) {
-                            std::cerr << "\t" << baddie.second << "\t" << baddie.first << std::endl;
-                        }
-                    } // try/catch
+                    for (auto &videoJson : items) {
+                        batch.push_back(std::make_shared<YoutubeVideo>(std::move(videoJson), parts));
+                    }
+                    videosQueue.push(std::move(batch));
                 }
-            }
+            });
+        }
 
-            // If there's no more ListVideoThread objects, our job here is done.
-            if (videoThreadObjects.empty()) {
-                threadingDone = true;
+        // Merge stage: the one thread that touches the result list.
+        std::thread mergeThread([&videosQueue, &videos]() {
+            std::list<std::shared_ptr<YoutubeVideo>> batch;
+            while (videosQueue.pop(batch)) {
+                videos.splice(videos.end(), batch);
             }
-        } // while !threadingDone
+        });
 
-        std::cout << std::endl;  // Newline after playlist counter is done.
+        fetchUploadedPlaylists(t_playlists, parts, t_filter, t_optParams, t_playlistItemsPart, t_context, bodyQueue,
+                               t_stats);
+
+        // Every fetch is done, let the remaining stages drain in order.
+        bodyQueue->close();
+        for (auto &thread : parseThreads) {
+            thread.join();
+        }
+        itemsQueue.close();
+        for (auto &thread : buildThreads) {
+            thread.join();
+        }
+        videosQueue.close();
+        mergeThread.join();
+
+        if (t_stats != nullptr) {
+            t_stats->elapsedMs = (long)std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - refreshStart).count();
+        }
 
         return videos;
     }
 
     /**
-     * Create subs-feed from a list of channel uploaded videos playlists.
+     * Retrieves the videos of every given playlist (see fetchUploadedPlaylists) as FeedItems.
      *
-     * @param t_playlists
-     * @param t_part
-     * @param t_filter
-     * @param t_optParams
-     * @return
+     * The parse stage turns response bodies straight into FeedItems (parseFeedItems) instead of building a JSON
+     * DOM and YoutubeVideo entities, so there is no entity build stage. Videos are requested with the parts
+     * FeedItem is made of (snippet,contentDetails).
+     *
+     * If t_context expires before all playlists are done, the videos retrieved so far are returned.
+     *
+     * @param t_playlists           Playlist IDs.
+     * @param t_filter              Filter, playlistId is overridden per playlist.
+     * @param t_optParams           Optional parameters.
+     * @param t_playlistItemsPart   Part(s) to request in playlistItems.list() (must contain videoId).
+     * @param t_context             Refresh-wide deadline and cancellation token.
+     * @param t_channels            Table the items' channels are interned in.
+     * @param t_stats               Pointer to a refreshStats_t to fill in, send in nullptr to disable.
+     * @return                      Feed items, in no particular order.
      */
-    std::list<std::shared_ptr<YoutubeVideo>> createSubscriptionsFeed(const std::string &t_part,
-            const std::map<std::string, std::string> &t_filter,
-            const std::map<std::string, std::string> &t_optParams) {
+    std::vector<FeedItem> listUploadedFeedItems(const std::list<std::string> &t_playlists,
+                                                const std::map<std::string, std::string> &t_filter,
+                                                const std::map<std::string, std::string> &t_optParams,
+                                                const std::string &t_playlistItemsPart,
+                                                const requestContext_t &t_context,
+                                                FeedChannelTable &t_channels,
+                                                refreshStats_t *t_stats) {
+        std::vector<FeedItem> items;
+        auto refreshStart = std::chrono::steady_clock::now();
+
+        std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+        int parseWorkers = std::max(cfg->getInt("threading/subsfeed_parse_workers", SUBFEED_DEFAULT_PARSE_WORKERS), 1);
+        size_t pipelineCapacity = (size_t)std::max(cfg->getInt("threading/subsfeed_pipeline_capacity",
+                                                               SUBFEED_DEFAULT_PIPELINE_CAPACITY), 1);
+
+        // FeedChannelTable isn't thread-safe: every body gets a table of its own, merged into t_channels by the
+        // merge thread.
+        struct feedBatch_t {
+            FeedChannelTable channels;
+            std::vector<FeedItem> items;
+        };
+
+        auto bodyQueue = std::make_shared<BoundedQueue<std::shared_ptr<const std::string>>>(pipelineCapacity);
+        BoundedQueue<feedBatch_t> batchQueue(pipelineCapacity);
+        std::vector<std::thread> parseThreads;
+
+        // Parse stage: videos.list() response body -> its feed items.
+        for (int i = 0; i < parseWorkers; i++) {
+            parseThreads.emplace_back([&bodyQueue, &batchQueue]() {
+                std::shared_ptr<const std::string> body;
+                while (bodyQueue->pop(body)) {
+                    feedBatch_t batch;
+
+                    // FIXME: No pagination support, will cutoff at 50 max.
+                    parseFeedItems(*body, batch.channels, batch.items);
+                    if (!batch.items.empty()) {
+                        batchQueue.push(std::move(batch));
+                    }
+                }
+            });
+        }
+
+        // Merge stage: the one thread that touches the result and t_channels.
+        std::thread mergeThread([&batchQueue, &items, &t_channels]() {
+            feedBatch_t batch;
+            while (batchQueue.pop(batch)) {
+                for (auto &item : batch.items) {
+                    uint32_t channel = t_channels.intern(batch.channels.getPackedChannelId(item.getChannel()),
+                                                         batch.channels.getChannelTitle(item.getChannel()));
+
+                    items.emplace_back(item.getVideoId(), item.getPublishedAtMs(), channel, item.getTitle(),
+                                       item.getDurationSeconds(), item.getFlags());
+                }
+            }
+        });
+
+        fetchUploadedPlaylists(t_playlists, VideoParts().with(VideoPart::Snippet).with(VideoPart::ContentDetails),
+                               t_filter, t_optParams, t_playlistItemsPart, t_context, bodyQueue, t_stats);
+
+        // Every fetch is done, let the remaining stages drain in order.
+        bodyQueue->close();
+        for (auto &thread : parseThreads) {
+            thread.join();
+        }
+        batchQueue.close();
+        mergeThread.join();
+
+        if (t_stats != nullptr) {
+            t_stats->elapsedMs = (long)std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - refreshStart).count();
+        }
+
+        return items;
+    }
+
+#ifdef SANE_ENABLE_COROUTINES
+    /**
+     * Runs one playlist's flow, then reports progress unless the refresh budget ran out before it was done.
+     */
+    static Task<void> runListVideosFlow(EventLoop &t_loop, std::shared_ptr<ListVideosThread> t_flow,
+                                        requestContext_t t_context, size_t *t_completed, size_t t_total,
+                                        refreshProgressCallback_t t_progress) {
+        co_await t_flow->listVideosAsync(t_loop);
+
+        // Cut short, whatever it got is still used, but it doesn't count as completed.
+        if (t_context.shouldAbort()) {
+            co_return;
+        }
+
+        (*t_completed)++;
+        if (t_progress) {
+            t_progress(*t_completed, t_total);
+        }
+    }
+
+    /**
+     * Coroutine version of listUploadedVideos: every playlist's playlistItems -> videos.list() flow runs as a
+     * coroutine on the given event loop, all of them in flight at once (paced by the quota token bucket rather
+     * than by a thread count).
+     *
+     * @param t_loop                Event loop to run on, whoever drives it (run() or a host loop).
+     * @param t_playlists           Playlist IDs.
+     * @param t_part                Part(s) to request in videos.list().
+     * @param t_filter              Filter, playlistId is overridden per playlist.
+     * @param t_optParams           Optional parameters.
+     * @param t_playlistItemsPart   Part(s) to request in playlistItems.list() (must contain videoId).
+     * @param t_context             Refresh-wide deadline and cancellation token.
+     * @param t_stats               Pointer to a refreshStats_t to fill in, send in nullptr to disable.
+     * @param t_progress            Called on the loop's thread as every playlist completes, may be nullptr.
+     * @return                      Task resulting in the list of videos.
+     */
+    Task<std::list<std::shared_ptr<YoutubeVideo>>> listUploadedVideosAsync(EventLoop &t_loop,
+                                                                           std::list<std::string> t_playlists,
+                                                                           std::string t_part,
+                                                                           std::map<std::string, std::string> t_filter,
+                                                                           std::map<std::string, std::string> t_optParams,
+                                                                           std::string t_playlistItemsPart,
+                                                                           requestContext_t t_context,
+                                                                           refreshStats_t *t_stats,
+                                                                           refreshProgressCallback_t t_progress) {
+        std::list<std::shared_ptr<ListVideosThread>> flows;
+        std::vector<Task<void>> flowTasks;
+        std::list<std::shared_ptr<YoutubeVideo>> videos;
+        size_t completed = 0;
+        auto refreshStart = std::chrono::steady_clock::now();
+
+        // The loop may have served other refreshes before, only this one's transfers count towards its peak.
+        t_loop.resetPeakTransferCount();
+
+        // Parsed once, the same parts then drive both the videos.list() requests and parsing their responses.
+        VideoParts parts = VideoParts::parse(t_part);
+
+        for (const auto &playlist : t_playlists) {
+            std::map<std::string, std::string> filter = t_filter;
+
+            // There can only be one id filter, and it is the videos' (set once the playlist's items are known).
+            filter.erase("id");
+            filter["playlistId"] = playlist;
+
+            flows.push_back(std::make_shared<ListVideosThread>(parts, filter, t_optParams, t_playlistItemsPart,
+                                                               t_context));
+            flowTasks.push_back(runListVideosFlow(t_loop, flows.back(), t_context, &completed, t_playlists.size(),
+                                                  t_progress));
+        }
+
+        // Done once every flow is (or has given up on the refresh budget).
+        co_await whenAll(std::move(flowTasks));
+
+        for (const auto &flow : flows) {
+            nlohmann::json items = flow->get();
+
+            if (items.is_array()) {
+                for (auto &videoJson : items) {
+                    videos.push_back(std::make_shared<YoutubeVideo>(std::move(videoJson), parts));
+                }
+            }
+        }
+
+        if (t_stats != nullptr) {
+            t_stats->playlistsTotal = t_playlists.size();
+            t_stats->playlistsCompleted = completed;
+            t_stats->budgetExceeded = t_context.shouldAbort();
+            // There is no limiter to choose a concurrency (concurrency is left unset), every flow is started at
+            // once and the quota token bucket decides how many of their transfers actually overlap.
+            t_stats->peakConcurrency = (int)t_loop.getPeakTransferCount();
+            t_stats->elapsedMs = (long)std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - refreshStart).count();
+        }
+
+        co_return videos;
+    }
+#endif
+
+    /**
+     * Drops videos that are already in the list, keeping the first one, compared by their packed VideoId.
+     *
+     * Videos whose ID doesn't parse are kept as they are.
+     *
+     * @param t_videos  Videos to deduplicate, in place.
+     * @return          Number of videos dropped.
+     */
+    size_t removeDuplicateVideos(std::list<std::shared_ptr<YoutubeVideo>> &t_videos) {
+        std::unordered_set<VideoId> seen;
+        size_t removed = 0;
+
+        for (auto it = t_videos.begin(); it != t_videos.end(); ) {
+            VideoId videoId;
+
+            if (VideoId::tryParse((*it)->getId(), videoId) and !seen.insert(videoId).second) {
+                it = t_videos.erase(it);
+                removed++;
+            } else {
+                ++it;
+            }
+        }
+
+        return removed;
+    }
+
+    /**
+     * Same as removeDuplicateVideos() for a list of YoutubeVideo, for feed items.
+     *
+     * @param t_items   Items to deduplicate, in place.
+     * @return          Number of items dropped.
+     */
+    size_t removeDuplicateVideos(std::vector<FeedItem> &t_items) {
+        std::unordered_set<VideoId> seen;
+        size_t size = t_items.size();
+
+        t_items.erase(std::remove_if(t_items.begin(), t_items.end(), [&seen](const FeedItem &t_item) {
+            return !seen.insert(t_item.getVideoId()).second;
+        }), t_items.end());
+
+        return size - t_items.size();
+    }
+
+    /**
+     * What a subscriptions feed refresh is about to do: which playlists to refresh and within what budgets.
+     */
+    struct feedRefreshPlan_t {
+        std::list<std::string> playlists;
+        requestContext_t context;
+        long projectedQuotaCost = 0;
+        long quotaRemaining = -1;
+        size_t playlistsOverQuota = 0;
+    };
+
+    /**
+     * Collects the subscriptions' uploads playlists, leaving out what today's quota can't afford.
+     */
+    static feedRefreshPlan_t planSubscriptionsFeed() {
+        std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
+        feedRefreshPlan_t plan;
+        plan.context = makeRequestContext(std::chrono::milliseconds(cfg->getLongInt("subsfeed/refresh_budget_ms", 0)));
+
         // Get subscriptions from DB.
         std::list<std::string> errors;
 //        std::cout << "Retrieving subscriptions from DB..." << std::endl;
@@ -227,22 +585,216 @@ namespace sane {
 
         // Retrieve uploaded videos playlist IDs.
 //        std::cout << "Retrieving \"uploaded videos\" playlists..." << std::endl;
-        std::list<std::string> playlists;
+        std::unordered_set<ChannelId> seenPlaylists;
         for (const auto &channel : channels) {
-            // Get the uploads playlist.
-            playlists.push_back(channel->getUploadsPlaylist());
+            // Get the uploads playlist, a channel listed twice only costs quota once.
+            if (!channel->hasUploadsPlaylist()) {
+                continue;
+            }
+
+            ChannelId uploadsPlaylistId = channel->getUploadsPlaylistId();
+
+            if (channel->getPackedId() == ChannelId()) {
+                // Not a well-formed channel ID, pass it on as is and let the API sort it out.
+                plan.playlists.push_back(channel->getUploadsPlaylist());
+            } else if (seenPlaylists.insert(uploadsPlaylistId).second) {
+                plan.playlists.push_back(uploadsPlaylistId.toString());
+            }
+        }
+
+        // Every playlist costs a playlistItems.list() and (as long as it has items) a videos.list() call.
+        long costPerPlaylist = getQuotaCost(YOUTUBE_API_PLAYLIST_ITEMS) + getQuotaCost(YOUTUBE_API_VIDEOS);
+        plan.projectedQuotaCost = (long)plan.playlists.size() * costPerPlaylist;
+        plan.quotaRemaining = getRemainingQuota();
+
+        std::cout << "Refreshing " << plan.playlists.size() << " playlists, projected quota cost: "
+                  << plan.projectedQuotaCost << " units";
+        if (plan.quotaRemaining >= 0) {
+            std::cout << " (" << plan.quotaRemaining << " of " << getQuotaSettings().dailyLimit << " left today)";
         }
+        std::cout << "." << std::endl;
+
+        // Pace the refresh to the remaining budget: refresh what fits, rather than running dry halfway through.
+        if (plan.quotaRemaining >= 0 and plan.projectedQuotaCost > plan.quotaRemaining) {
+            size_t affordable = (size_t)(plan.quotaRemaining / costPerPlaylist);
+
+            plan.playlistsOverQuota = plan.playlists.size() - affordable;
+            plan.playlists.resize(affordable);
+
+            std::cerr << "createSubscriptionsFeed WARNING: Not enough quota left today, only refreshing "
+                      << affordable << " playlists (skipping " << plan.playlistsOverQuota << ")." << std::endl;
+        }
+
+        return plan;
+    }
+
+    /**
+     * Wraps up a subscriptions feed refresh: persists the quota spent and fills in the plan's share of t_stats.
+     */
+    static void finishSubscriptionsFeed(const feedRefreshPlan_t &t_plan, size_t t_duplicates,
+                                        refreshStats_t *t_stats) {
+        // Worker threads only count quota in memory, persist it now that they're done.
+        flushQuotaLedger();
+
+        if (t_stats != nullptr) {
+            t_stats->projectedQuotaCost = t_plan.projectedQuotaCost;
+            t_stats->quotaRemaining = t_plan.quotaRemaining;
+            t_stats->playlistsOverQuota = t_plan.playlistsOverQuota;
+            t_stats->duplicateVideos = t_duplicates;
+        }
+    }
+
+    /**
+     * Wraps up a subscriptions feed refresh: persists the quota spent, drops duplicates and sorts the videos.
+     */
+    static void finishSubscriptionsFeed(std::list<std::shared_ptr<YoutubeVideo>> &t_videos,
+                                        const feedRefreshPlan_t &t_plan, refreshStats_t *t_stats) {
+        finishSubscriptionsFeed(t_plan, removeDuplicateVideos(t_videos), t_stats);
+
+        // Sort by publishedAt date.
+//        std::cout << "Sorting subs-feed videos by publishedAt datetime..." << std::endl;
+        t_videos.sort(sortYoutubeVideoDateDescending());
+    }
+
+    /**
+     * Create subs-feed from a list of channel uploaded videos playlists.
+     *
+     * The whole refresh is bounded by the optional "subsfeed/refresh_budget_ms" config setting.
+     *
+     * Builds with coroutine support refresh on an event loop (listUploadedVideosAsync) unless
+     * "threading/subsfeed_coroutines" is set to 0.
+     *
+     * @param t_playlists
+     * @param t_part
+     * @param t_filter
+     * @param t_optParams
+     * @param t_stats       Pointer to a refreshStats_t to fill in, send in nullptr to disable.
+     * @return
+     */
+    std::list<std::shared_ptr<YoutubeVideo>> createSubscriptionsFeed(const std::string &t_part,
+            const std::map<std::string, std::string> &t_filter,
+            const std::map<std::string, std::string> &t_optParams,
+            refreshStats_t *t_stats) {
+        feedRefreshPlan_t plan = planSubscriptionsFeed();
 
         // Video uploads
         std::list<std::shared_ptr<YoutubeVideo>> videos;
 
         // Get list of uploaded videos for every given channel/playlist.
-        videos = listUploadedVideos(playlists, t_part, t_filter, t_optParams);
+#ifdef SANE_ENABLE_COROUTINES
+        std::shared_ptr<ConfigHandler> cfg = std::make_shared<ConfigHandler>();
 
-        // Sort by publishedAt date.
-//        std::cout << "Sorting subs-feed videos by publishedAt datetime..." << std::endl;
-        videos.sort(sortYoutubeVideoDateDescending());
+        if (cfg->getInt("threading/subsfeed_coroutines", 1) != 0) {
+            EventLoop loop;
+
+            videos = loop.runUntilComplete(listUploadedVideosAsync(
+                    loop, plan.playlists, t_part, t_filter, t_optParams, "contentDetails", plan.context, t_stats,
+                    [](size_t t_completed, size_t t_total) { updateProgressLine(t_total, (int)t_completed); }));
+            std::cout << std::endl;  // Newline after playlist counter is done.
+        } else {
+            videos = listUploadedVideos(plan.playlists, t_part, t_filter, t_optParams, "contentDetails",
+                                        plan.context, t_stats);
+        }
+#else
+        videos = listUploadedVideos(plan.playlists, t_part, t_filter, t_optParams, "contentDetails", plan.context,
+                                    t_stats);
+#endif
+
+        finishSubscriptionsFeed(videos, plan, t_stats);
 
         return videos;
     }
+
+    /**
+     * Same as createSubscriptionsFeed, but only with what a feed listing shows: the videos are parsed straight into
+     * FeedItems (see listUploadedFeedItems) rather than built as YoutubeVideo entities.
+     *
+     * Always refreshes on threads, the event loop refresh hands over parsed JSON rather than response bodies.
+     *
+     * @param t_channels    Table the items' channels are interned in.
+     * @param t_filter
+     * @param t_optParams
+     * @param t_stats       Pointer to a refreshStats_t to fill in, send in nullptr to disable.
+     * @return              Feed items, newest first.
+     */
+    std::vector<FeedItem> createSubscriptionsFeedItems(FeedChannelTable &t_channels,
+            const std::map<std::string, std::string> &t_filter,
+            const std::map<std::string, std::string> &t_optParams,
+            refreshStats_t *t_stats) {
+        feedRefreshPlan_t plan = planSubscriptionsFeed();
+
+        std::vector<FeedItem> items = listUploadedFeedItems(plan.playlists, t_filter, t_optParams, "contentDetails",
+                                                            plan.context, t_channels, t_stats);
+
+        finishSubscriptionsFeed(plan, removeDuplicateVideos(items), t_stats);
+        std::stable_sort(items.begin(), items.end(), sortFeedItemDateDescending());
+
+        return items;
+    }
+
+#ifdef SANE_ENABLE_COROUTINES
+    /**
+     * Event loop version of createSubscriptionsFeed, for refreshing without blocking e.g. a GUI's main loop.
+     *
+     * @param t_loop        Event loop to run on, typically embedded in the host's (see EventLoop).
+     * @param t_part        Part(s) to request in videos.list().
+     * @param t_filter      Filter.
+     * @param t_optParams   Optional parameters.
+     * @param t_stats       Pointer to a refreshStats_t to fill in (must outlive the task), nullptr to disable.
+     * @param t_progress    Called on the loop's thread as every playlist completes, may be nullptr.
+     * @return              Task resulting in the feed, newest first.
+     */
+    Task<std::list<std::shared_ptr<YoutubeVideo>>> createSubscriptionsFeedAsync(EventLoop &t_loop,
+            std::string t_part,
+            std::map<std::string, std::string> t_filter,
+            std::map<std::string, std::string> t_optParams,
+            refreshStats_t *t_stats,
+            refreshProgressCallback_t t_progress) {
+        feedRefreshPlan_t plan = planSubscriptionsFeed();
+
+        std::list<std::shared_ptr<YoutubeVideo>> videos = co_await listUploadedVideosAsync(
+                t_loop, plan.playlists, t_part, t_filter, t_optParams, "contentDetails", plan.context, t_stats,
+                t_progress);
+
+        finishSubscriptionsFeed(videos, plan, t_stats);
+
+        co_return videos;
+    }
+
+    static Task<void> runSubscriptionsFeedRefresh(EventLoop &t_loop, std::string t_part,
+                                                  std::map<std::string, std::string> t_filter,
+                                                  std::map<std::string, std::string> t_optParams,
+                                                  refreshProgressCallback_t t_progress,
+                                                  refreshDoneCallback_t t_done) {
+        refreshStats_t stats;
+
+        std::list<std::shared_ptr<YoutubeVideo>> videos = co_await createSubscriptionsFeedAsync(
+                t_loop, t_part, t_filter, t_optParams, &stats, t_progress);
+
+        if (t_done) {
+            t_done(std::move(videos), stats);
+        }
+    }
+
+    /**
+     * Starts a subscriptions feed refresh on an event loop and returns right away.
+     *
+     * The refresh advances as the loop's owner drives it, with both callbacks called on that thread, so no
+     * locking is needed to update e.g. a progress bar and a feed view from them.
+     *
+     * @param t_loop        Event loop to run on.
+     * @param t_part        Part(s) to request in videos.list().
+     * @param t_filter      Filter.
+     * @param t_optParams   Optional parameters.
+     * @param t_progress    Called as every playlist completes, may be nullptr.
+     * @param t_done        Called with the feed (newest first) and refresh stats once done.
+     */
+    void startSubscriptionsFeedRefresh(EventLoop &t_loop, const std::string &t_part,
+                                       const std::map<std::string, std::string> &t_filter,
+                                       const std::map<std::string, std::string> &t_optParams,
+                                       refreshProgressCallback_t t_progress, refreshDoneCallback_t t_done) {
+        t_loop.spawn(runSubscriptionsFeedRefresh(t_loop, t_part, t_filter, t_optParams, std::move(t_progress),
+                                                 std::move(t_done)));
+    }
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include <catch2/catch.hpp>
+
+#include <api_handler/hedging.hpp>
+
+#define API_TEST_001_ENDPOINT       "https://www.googleapis.com/youtube/v3/playlistItems"
+#define API_TEST_001_OTHER_ENDPOINT "https://www.googleapis.com/youtube/v3/videos"
+
+TEST_CASE ("1: Testing sane::api_handler: Per-endpoint latency percentiles and hedging budget.") {
+    sane::resetLatencyTracking();
+
+    SECTION("Too few samples yields no percentile") {
+        sane::recordLatency(API_TEST_001_ENDPOINT, 100);
+
+        REQUIRE( sane::getLatencyPercentile(API_TEST_001_ENDPOINT, 95, 20) == -1 );
+        REQUIRE( sane::getLatencyPercentile(API_TEST_001_OTHER_ENDPOINT, 95) == -1 );
+    }
+
+    SECTION("Nearest-rank percentile over the window") {
+        // 1, 2, ..., 100 ms.
+        for (long latency = 100; latency > 0; latency--) {
+            sane::recordLatency(API_TEST_001_ENDPOINT, latency);
+        }
+
+        REQUIRE( sane::getLatencyPercentile(API_TEST_001_ENDPOINT, 95, 20) == 95  );
+        REQUIRE( sane::getLatencyPercentile(API_TEST_001_ENDPOINT, 50, 20) == 50  );
+        REQUIRE( sane::getLatencyPercentile(API_TEST_001_ENDPOINT, 100)    == 100 );
+    }
+
+    SECTION("Window only keeps the most recent samples") {
+        for (int i = 0; i < LATENCY_WINDOW_SIZE; i++) {
+            sane::recordLatency(API_TEST_001_ENDPOINT, 5000);
+        }
+        for (int i = 0; i < LATENCY_WINDOW_SIZE; i++) {
+            sane::recordLatency(API_TEST_001_ENDPOINT, 10);
+        }
+
+        REQUIRE( sane::getLatencyPercentile(API_TEST_001_ENDPOINT, 95) == 10 );
+    }
+
+    SECTION("Hedges are refused once the extra quota budget is spent") {
+        REQUIRE( sane::tryAcquireHedge(1, 2) );
+        REQUIRE( sane::tryAcquireHedge(1, 2) );
+        REQUIRE_FALSE( sane::tryAcquireHedge(1, 2) );
+
+        sane::hedgingStats_t stats = sane::getHedgingStats();
+        REQUIRE( stats.hedgesIssued == 2 );
+        REQUIRE( stats.quotaSpent   == 2 );
+    }
+
+    SECTION("A hedge that wasn't sent after all is refunded") {
+        REQUIRE( sane::tryAcquireHedge(1, 1) );
+        sane::refundHedge(1);
+
+        REQUIRE( sane::getHedgingStats().hedgesIssued == 0 );
+        REQUIRE( sane::getHedgingStats().quotaSpent   == 0 );
+        REQUIRE( sane::tryAcquireHedge(1, 1) );
+    }
+}
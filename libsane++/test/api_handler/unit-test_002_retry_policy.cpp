@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+
+#include <api_handler/retry_policy.hpp>
+
+#define API_TEST_002_QUOTA_EXCEEDED_BODY R"({"error": {"code": 403, "message": "The request cannot be completed because you have exceeded your quota.", "errors": [{"message": "The request cannot be completed because you have exceeded your quota.", "domain": "youtube.quota", "reason": "quotaExceeded"}]}})"
+#define API_TEST_002_RATE_LIMITED_BODY   R"({"error": {"code": 403, "message": "Rate Limit Exceeded", "errors": [{"message": "Rate Limit Exceeded", "domain": "usageLimits", "reason": "rateLimitExceeded"}]}})"
+#define API_TEST_002_NOT_FOUND_BODY      R"({"error": {"code": 404, "message": "Not Found", "errors": [{"message": "Not Found", "domain": "youtube.playlistItem", "reason": "playlistNotFound"}]}})"
+
+TEST_CASE ("2: Testing sane::api_handler: Retry policy failure classification and backoff.") {
+    SECTION("Error reason is read from the Google API error body") {
+        REQUIRE( sane::getApiErrorReason(API_TEST_002_QUOTA_EXCEEDED_BODY) == "quotaExceeded" );
+        REQUIRE( sane::getApiErrorReason("not json at all").empty() );
+        REQUIRE( sane::getApiErrorReason("{}").empty() );
+    }
+
+    SECTION("Quota exhaustion is told apart from rate limiting") {
+        REQUIRE( sane::classifyFailure(CURLE_OK, 403, API_TEST_002_QUOTA_EXCEEDED_BODY)
+                 == sane::FailureKind::QuotaExceeded );
+        REQUIRE( sane::classifyFailure(CURLE_OK, 403, API_TEST_002_RATE_LIMITED_BODY)
+                 == sane::FailureKind::RateLimited );
+        REQUIRE( sane::classifyFailure(CURLE_OK, 429, "") == sane::FailureKind::RateLimited );
+
+        REQUIRE_FALSE( sane::isRetryable(sane::FailureKind::QuotaExceeded) );
+        REQUIRE( sane::isRetryable(sane::FailureKind::RateLimited) );
+    }
+
+    SECTION("Server and transport errors are transient, other client errors are fatal") {
+        REQUIRE( sane::classifyFailure(CURLE_OK, 200, "{}")        == sane::FailureKind::None      );
+        REQUIRE( sane::classifyFailure(CURLE_OK, 503, "")          == sane::FailureKind::Transient );
+        REQUIRE( sane::classifyFailure(CURLE_OPERATION_TIMEDOUT, 0, "") == sane::FailureKind::Transient );
+        REQUIRE( sane::classifyFailure(CURLE_ABORTED_BY_CALLBACK, 0, "") == sane::FailureKind::Fatal );
+        REQUIRE( sane::classifyFailure(CURLE_OK, 404, API_TEST_002_NOT_FOUND_BODY) == sane::FailureKind::Fatal );
+    }
+
+    SECTION("Backoff is full jitter, bounded by an exponentially growing (capped) ceiling") {
+        sane::retryPolicy_t policy;
+        policy.baseDelayMs = 100;
+        policy.maxDelayMs = 1000;
+        std::mt19937 rng(1337);
+
+        for (int i = 0; i < 1000; i++) {
+            long firstDelay = sane::computeBackoffMs(policy, 0, rng);
+            long thirdDelay = sane::computeBackoffMs(policy, 2, rng);
+            long cappedDelay = sane::computeBackoffMs(policy, 30, rng);
+
+            REQUIRE( (firstDelay >= 0 and firstDelay <= 100) );
+            REQUIRE( (thirdDelay >= 0 and thirdDelay <= 400) );
+            REQUIRE( (cappedDelay >= 0 and cappedDelay <= 1000) );
+        }
+    }
+
+    SECTION("Retry-After is honoured up to the longest delay, beyond that it is not worth waiting") {
+        sane::retryPolicy_t policy;
+        policy.maxDelayMs = 32000;
+
+        REQUIRE( sane::computeRetryAfterMs(policy, 1) == 1000 );
+        REQUIRE( sane::computeRetryAfterMs(policy, 32) == 32000 );
+        REQUIRE( sane::computeRetryAfterMs(policy, 33) == -1 );
+        REQUIRE( sane::computeRetryAfterMs(policy, 3600) == -1 );
+    }
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+
+#include <api_handler/api_handler.hpp>
+#include <api_handler/quota.hpp>
+
+TEST_CASE ("3: Testing sane::api_handler: Quota costs, quota day and token bucket.") {
+    SECTION("Costs are looked up by API resource, regardless of query string") {
+        REQUIRE( sane::getQuotaEndpoint(std::string(YOUTUBE_API_PLAYLIST_ITEMS) + "?part=id&maxResults=50")
+                 == "playlistItems" );
+        REQUIRE( sane::getQuotaEndpoint(YOUTUBE_API_VIDEOS_RATE) == "videos/rate" );
+
+        REQUIRE( sane::getQuotaCost(std::string(YOUTUBE_API_PLAYLIST_ITEMS) + "?part=contentDetails") == 1 );
+        REQUIRE( sane::getQuotaCost(YOUTUBE_API_VIDEOS) == 1 );
+        REQUIRE( sane::getQuotaCost(std::string(YOUTUBE_API_SEARCH) + "?q=sane") == 100 );
+        REQUIRE( sane::getQuotaCost("https://accounts.google.com/o/oauth2/token") == 0 );
+    }
+
+    SECTION("The quota day rolls over at midnight Pacific Time") {
+        // 1970-01-01 00:00 UTC is still the previous day in California.
+        REQUIRE( sane::getQuotaDay(0) == "1969-12-31" );
+        REQUIRE( sane::getQuotaDay(8 * 3600 - 1) == "1969-12-31" );
+        REQUIRE( sane::getQuotaDay(8 * 3600) == "1970-01-01" );
+    }
+
+    SECTION("Bursts are limited to the bucket capacity") {
+        sane::QuotaBucket bucket(5, 1);
+
+        REQUIRE( bucket.tryAcquire(3) );
+        REQUIRE_FALSE( bucket.tryAcquire(3) );
+        REQUIRE( bucket.tryAcquire(2) );
+        REQUIRE( bucket.getAvailable() < 1.0 );
+    }
+
+    SECTION("A cost larger than the capacity is let through once the bucket is full") {
+        sane::QuotaBucket bucket(5, 1);
+
+        REQUIRE( bucket.tryAcquire(100) );
+        REQUIRE_FALSE( bucket.tryAcquire(1) );
+    }
+
+    SECTION("Waiting for tokens gives up when cancelled or out of time") {
+        sane::QuotaBucket bucket(1, 1);
+        REQUIRE( bucket.tryAcquire(1) );
+
+        std::shared_ptr<sane::CancellationToken> token = std::make_shared<sane::CancellationToken>();
+        token->cancel();
+        REQUIRE_FALSE( bucket.acquire(1, sane::makeRequestContext(std::chrono::milliseconds(0), token)) );
+
+        // The next token is a second away, well past the deadline.
+        REQUIRE_FALSE( bucket.acquire(1, sane::makeRequestContext(std::chrono::milliseconds(20))) );
+    }
+
+    SECTION("A refill rate of 0 disables the bucket") {
+        sane::QuotaBucket bucket(1, 0);
+
+        REQUIRE( bucket.tryAcquire(1000) );
+        REQUIRE( bucket.tryAcquire(1000) );
+    }
+}
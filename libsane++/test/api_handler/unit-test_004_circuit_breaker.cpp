@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <memory>
+#include <thread>
+
+#include <api_handler/circuit_breaker.hpp>
+
+TEST_CASE ("4: Testing sane::api_handler: Circuit breaker and stale response cache.") {
+    sane::circuitBreakerSettings_t settings;
+    settings.windowSize = 10;
+    settings.minRequests = 4;
+    settings.failureRate = 50;
+    settings.openMs = 20;
+    settings.halfOpenProbes = 1;
+
+    sane::CircuitBreaker breaker("test", settings);
+
+    SECTION("Failures below the minimum number of requests don't open the circuit") {
+        for (int i = 0; i < 3; i++) {
+            REQUIRE( breaker.allowRequest() );
+            breaker.recordFailure();
+        }
+        REQUIRE( breaker.getState() == sane::CircuitState::Closed );
+    }
+
+    SECTION("The circuit opens at the failure rate and fails fast while open") {
+        for (int i = 0; i < 2; i++) {
+            REQUIRE( breaker.allowRequest() );
+            breaker.recordSuccess();
+        }
+        REQUIRE( breaker.allowRequest() );
+        breaker.recordFailure();
+        REQUIRE( breaker.getState() == sane::CircuitState::Closed );
+
+        REQUIRE( breaker.allowRequest() );
+        breaker.recordFailure();
+        REQUIRE( breaker.getState() == sane::CircuitState::Open );
+
+        REQUIRE_FALSE( breaker.allowRequest() );
+        REQUIRE_FALSE( breaker.allowRequest() );
+        REQUIRE( breaker.getShortCircuitCount() == 2 );
+    }
+
+    SECTION("Half-open lets a single probe through, which closes or re-opens the circuit") {
+        for (int i = 0; i < 4; i++) {
+            REQUIRE( breaker.allowRequest() );
+            breaker.recordFailure();
+        }
+        REQUIRE( breaker.getState() == sane::CircuitState::Open );
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        REQUIRE( breaker.allowRequest() );
+        REQUIRE( breaker.getState() == sane::CircuitState::HalfOpen );
+        REQUIRE_FALSE( breaker.allowRequest() );
+        breaker.recordFailure();
+        REQUIRE( breaker.getState() == sane::CircuitState::Open );
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        REQUIRE( breaker.allowRequest() );
+        breaker.recordSuccess();
+        REQUIRE( breaker.getState() == sane::CircuitState::Closed );
+        REQUIRE( breaker.allowRequest() );
+    }
+
+    SECTION("An abandoned probe frees its slot") {
+        for (int i = 0; i < 4; i++) {
+            REQUIRE( breaker.allowRequest() );
+            breaker.recordFailure();
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+
+        REQUIRE( breaker.allowRequest() );
+        breaker.recordAbandoned();
+        REQUIRE( breaker.allowRequest() );
+    }
+
+    SECTION("The response cache keeps the newest entries") {
+        sane::ResponseCache cache(2);
+
+        cache.put("a", std::make_shared<const nlohmann::json>(nlohmann::json{{"id", "a"}}));
+        cache.put("b", std::make_shared<const nlohmann::json>(nlohmann::json{{"id", "b"}}));
+        cache.put("c", std::make_shared<const nlohmann::json>(nlohmann::json{{"id", "c"}}));
+
+        REQUIRE( cache.size() == 2 );
+        REQUIRE( cache.get("a") == nullptr );
+        REQUIRE( (*cache.get("c"))["id"] == "c" );
+    }
+
+    SECTION("Raw bodies are cached the same way") {
+        sane::ResponseBodyCache cache(1);
+        auto body = std::make_shared<const std::string>("{\"items\": []}");
+
+        cache.put("a", body);
+        REQUIRE( cache.get("a") == body );
+
+        cache.put("b", std::make_shared<const std::string>("{}"));
+        REQUIRE( cache.size() == 1 );
+        REQUIRE( cache.get("a") == nullptr );
+        REQUIRE( *cache.get("b") == "{}" );
+    }
+
+    SECTION("The response cache is also bounded by the memory its responses hold") {
+        const size_t entryBytes = 1 + sane::getResponseSize(std::string(1000, 'x'));
+        sane::ResponseBodyCache cache(100, 2 * entryBytes);
+
+        cache.put("a", std::make_shared<const std::string>(1000, 'a'));
+        cache.put("b", std::make_shared<const std::string>(1000, 'b'));
+        REQUIRE( cache.getBytes() == 2 * entryBytes );
+
+        // Over the byte limit long before the entry limit.
+        cache.put("c", std::make_shared<const std::string>(1000, 'c'));
+        REQUIRE( cache.size() == 2 );
+        REQUIRE( cache.get("a") == nullptr );
+        REQUIRE( cache.getBytes() == 2 * entryBytes );
+
+        // Replacing an entry releases what the old response held.
+        cache.put("c", std::make_shared<const std::string>("{}"));
+        REQUIRE( cache.getBytes() < 2 * entryBytes );
+
+        // Too big to be kept at all, and it doesn't flush everything else out either.
+        cache.put("d", std::make_shared<const std::string>(10000, 'd'));
+        REQUIRE( cache.get("d") == nullptr );
+        REQUIRE( cache.size() == 2 );
+    }
+}
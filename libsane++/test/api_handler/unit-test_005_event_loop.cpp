@@ -0,0 +1,234 @@
+#include <catch2/catch.hpp>
+
+// Only built into the opt-in C++20 configuration (-DSanePP_EnableCoroutines=ON).
+#ifdef SANE_ENABLE_COROUTINES
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <map>
+#include <memory>
+
+#include <poll.h>
+#include <curl/curl.h>
+#include <yhirose/httplib.h>
+
+#include <api_handler/event_loop.hpp>
+
+TEST_CASE ("5: Testing sane::api_handler: Coroutine event loop.") {
+    using std::chrono_literals::operator""ms;
+
+    sane::EventLoop loop;
+    std::vector<std::string> order;
+
+    auto step = [&](std::string t_name, std::chrono::milliseconds t_delay) -> sane::Task<std::string> {
+        co_await loop.sleepFor(t_delay);
+        order.push_back(t_name);
+        co_return t_name;
+    };
+
+    SECTION("A multi-step flow reads sequentially") {
+        auto flow = [&]() -> sane::Task<std::string> {
+            std::string first = co_await step("playlistItems", 5ms);
+            std::string second = co_await step("videos", 1ms);
+            co_return first + "->" + second;
+        };
+
+        REQUIRE( loop.runUntilComplete(flow()) == "playlistItems->videos" );
+        REQUIRE( order == std::vector<std::string>{"playlistItems", "videos"} );
+    }
+
+    SECTION("Flows run concurrently on the one thread") {
+        std::vector<sane::Task<std::string>> flows;
+        flows.push_back(step("slow", 30ms));
+        flows.push_back(step("fast", 1ms));
+
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::string> results = loop.runUntilComplete(sane::whenAll(std::move(flows)));
+
+        // Results keep their order, completion doesn't.
+        REQUIRE( results == std::vector<std::string>{"slow", "fast"} );
+        REQUIRE( order == std::vector<std::string>{"fast", "slow"} );
+        REQUIRE( std::chrono::steady_clock::now() - start < 200ms );
+    }
+
+    SECTION("Spawned tasks run until done, exceptions are contained") {
+        auto failing = [&]() -> sane::Task<void> {
+            co_await loop.sleepFor(1ms);
+            throw std::runtime_error("flow failed");
+        };
+        auto succeeding = [&]() -> sane::Task<void> {
+            co_await step("spawned", 2ms);
+        };
+
+        loop.spawn(failing());
+        loop.spawn(succeeding());
+        REQUIRE( loop.getPendingTaskCount() == 2 );
+
+        loop.run();
+
+        REQUIRE( loop.getPendingTaskCount() == 0 );
+        REQUIRE( order == std::vector<std::string>{"spawned"} );
+    }
+
+    SECTION("An exception escaping an awaited task reaches the awaiting one") {
+        auto failing = [&]() -> sane::Task<int> {
+            co_await loop.sleepFor(1ms);
+            throw std::runtime_error("flow failed");
+        };
+
+        REQUIRE_THROWS_AS( loop.runUntilComplete(failing()), std::runtime_error );
+    }
+
+    SECTION("whenAll lets every flow finish before passing on the first failure") {
+        auto failing = [&]() -> sane::Task<std::string> {
+            co_await loop.sleepFor(1ms);
+            throw std::runtime_error("flow failed");
+        };
+        std::vector<sane::Task<std::string>> flows;
+        flows.push_back(failing());
+        flows.push_back(step("sibling", 20ms));
+
+        REQUIRE_THROWS_AS( loop.runUntilComplete(sane::whenAll(std::move(flows))), std::runtime_error );
+        REQUIRE( order == std::vector<std::string>{"sibling"} );
+        REQUIRE_FALSE( loop.hasPendingWork() );
+    }
+
+    SECTION("Destroying a sleeping task takes its timer off the loop") {
+        {
+            sane::Task<std::string> sleeper = step("never", 10000ms);
+            sleeper.start();
+            REQUIRE( loop.hasPendingWork() );
+        }
+
+        REQUIRE_FALSE( loop.hasPendingWork() );
+    }
+
+    SECTION("A host loop drives transfers through the poll descriptors") {
+        httplib::Server server;
+        server.Get("/feed", [](const httplib::Request &, httplib::Response &t_response) {
+            t_response.set_content("videos", "text/plain");
+        });
+        int port = server.bind_to_any_port("127.0.0.1");
+        std::thread serverThread([&]() { server.listen_after_bind(); });
+        while (!server.is_running()) {
+            std::this_thread::sleep_for(1ms);
+        }
+
+        // What a GUI would keep socket notifiers for.
+        std::map<int, int> watched;
+        size_t socketsSeen = 0;
+        loop.setWatchCallback([&](int t_fd, int t_events) {
+            if (t_events == 0) {
+                watched.erase(t_fd);
+            } else {
+                socketsSeen += watched.count(t_fd) == 0 ? 1 : 0;
+                watched[t_fd] = t_events;
+            }
+        });
+        // The wakeup descriptor is reported right away.
+        REQUIRE( watched.size() == 1 );
+
+        std::string body;
+        CURL *curl = curl_easy_init();
+        curl_easy_setopt(curl, CURLOPT_URL, ("http://127.0.0.1:" + std::to_string(port) + "/feed").c_str());
+        curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, +[](char *t_data, size_t t_size, size_t t_count,
+                                                          void *t_body) {
+            static_cast<std::string*>(t_body)->append(t_data, t_size * t_count);
+            return t_size * t_count;
+        });
+        curl_easy_setopt(curl, CURLOPT_WRITEDATA, &body);
+        // Otherwise the server waits out keep-alive on the pooled connection before it can stop.
+        curl_easy_setopt(curl, CURLOPT_FORBID_REUSE, 1L);
+
+        auto fetch = [&]() -> sane::Task<void> {
+            CURLcode result = co_await loop.transfer(curl);
+            order.push_back(result == CURLE_OK ? body : "failed");
+        };
+        loop.spawn(fetch());
+
+        // Stand-in for the host's main loop: poll what the loop asks for, hand it whatever happened.
+        while (loop.hasPendingWork()) {
+            std::vector<pollfd> pollFds;
+            for (const auto &descriptor : watched) {
+                short events = (descriptor.second & EVENT_LOOP_POLL_IN ? POLLIN : 0)
+                               | (descriptor.second & EVENT_LOOP_POLL_OUT ? POLLOUT : 0);
+                pollFds.push_back({descriptor.first, events, 0});
+            }
+
+            long timeoutMs = loop.getTimeoutMs();
+            poll(pollFds.data(), pollFds.size(), timeoutMs < 0 ? 100 : (int)timeoutMs);
+
+            for (const pollfd &pollFd : pollFds) {
+                if (pollFd.revents != 0) {
+                    loop.processEvents(pollFd.fd, (pollFd.revents & POLLOUT ? EVENT_LOOP_POLL_OUT : 0)
+                                                  | (pollFd.revents & ~POLLOUT ? EVENT_LOOP_POLL_IN : 0));
+                }
+            }
+            loop.processEvents();
+        }
+
+        curl_easy_cleanup(curl);
+        server.stop();
+        serverThread.join();
+
+        REQUIRE( order == std::vector<std::string>{"videos"} );
+        REQUIRE( socketsSeen >= 1 );
+        REQUIRE( loop.getActiveTransferCount() == 0 );
+    }
+
+    SECTION("Destroying a task mid-transfer takes the transfer off the loop") {
+        httplib::Server server;
+        server.Get("/slow", [](const httplib::Request &, httplib::Response &t_response) {
+            std::this_thread::sleep_for(200ms);
+            t_response.set_content("videos", "text/plain");
+        });
+        int port = server.bind_to_any_port("127.0.0.1");
+        std::thread serverThread([&]() { server.listen_after_bind(); });
+        while (!server.is_running()) {
+            std::this_thread::sleep_for(1ms);
+        }
+
+        {
+            // Owns its easy handle, like APIHandler's flows do, so it is cleaned up along with the task.
+            auto fetch = [&]() -> sane::Task<void> {
+                std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl(curl_easy_init(), curl_easy_cleanup);
+                curl_easy_setopt(curl.get(), CURLOPT_URL,
+                                 ("http://127.0.0.1:" + std::to_string(port) + "/slow").c_str());
+                curl_easy_setopt(curl.get(), CURLOPT_FORBID_REUSE, 1L);
+
+                co_await loop.transfer(curl.get());
+                order.push_back("done");
+            };
+
+            sane::Task<void> task = fetch();
+            task.start();
+            REQUIRE( loop.getActiveTransferCount() == 1 );
+            loop.processEvents();
+        }
+
+        REQUIRE( loop.getActiveTransferCount() == 0 );
+        REQUIRE_FALSE( loop.hasPendingWork() );
+
+        server.stop();
+        serverThread.join();
+
+        REQUIRE( order.empty() );
+    }
+
+    SECTION("wakeup() makes the wakeup descriptor readable until processed") {
+        std::vector<sane::pollDescriptor_t> descriptors = loop.getPollDescriptors();
+        REQUIRE( descriptors.size() == 1 );
+
+        pollfd pollFd = {descriptors.front().fd, POLLIN, 0};
+        loop.wakeup();
+        REQUIRE( poll(&pollFd, 1, 0) == 1 );
+
+        loop.processEvents(pollFd.fd, EVENT_LOOP_POLL_IN);
+        REQUIRE( poll(&pollFd, 1, 0) == 0 );
+    }
+}
+
+#endif // SANE_ENABLE_COROUTINES
@@ -0,0 +1,44 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <map>
+
+#include <api_handler/transfer_stats.hpp>
+
+TEST_CASE ("6: Testing sane::api_handler: Per-endpoint transfer statistics.") {
+    const std::string videos = "https://www.googleapis.com/youtube/v3/videos";
+    const std::string playlistItems = "https://www.googleapis.com/youtube/v3/playlistItems";
+
+    SECTION("The endpoint is the URL without its query string") {
+        REQUIRE( sane::getEndpointFromUrl(videos + "?part=snippet&id=dQw4w9WgXcQ") == videos );
+        REQUIRE( sane::getEndpointFromUrl(videos) == videos );
+        REQUIRE( sane::getEndpointFromUrl(videos + "?") == videos );
+
+        // Only the query string goes, a trailing path is part of the endpoint.
+        REQUIRE( sane::getEndpointFromUrl(videos + "/getRating?id=dQw4w9WgXcQ") == videos + "/getRating" );
+        REQUIRE( sane::getEndpointFromUrl(videos + "/") == videos + "/" );
+        REQUIRE( sane::getEndpointFromUrl(videos + "?redirect=https://example.com/?a=b") == videos );
+    }
+
+    SECTION("Wire and decoded bytes accumulate per endpoint") {
+        sane::resetTransferStats();
+
+        sane::recordTransfer(videos + "?part=snippet&id=a", 1000, 8000);
+        sane::recordTransfer(videos + "?part=snippet&id=b", 500, 4500);
+        sane::recordTransfer(playlistItems + "?part=contentDetails", 300, 300);
+
+        std::map<std::string, sane::transferStats_t> stats = sane::getTransferStats();
+        REQUIRE( stats.size() == 2 );
+
+        REQUIRE( stats[videos].requests == 2 );
+        REQUIRE( stats[videos].wireBytes == 1500 );
+        REQUIRE( stats[videos].decodedBytes == 12500 );
+
+        // An uncompressed response is the same size on the wire as decoded.
+        REQUIRE( stats[playlistItems].requests == 1 );
+        REQUIRE( stats[playlistItems].wireBytes == stats[playlistItems].decodedBytes );
+
+        sane::resetTransferStats();
+        REQUIRE( sane::getTransferStats().empty() );
+    }
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch.hpp>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include <api_handler/request_context.hpp>
+
+TEST_CASE ("7: Testing sane::api_handler: Request deadlines and cancellation.") {
+    using std::chrono_literals::operator""ms;
+    using std::chrono_literals::operator""s;
+
+    SECTION("A default context never expires and can't be cancelled") {
+        sane::requestContext_t context;
+
+        REQUIRE_FALSE( context.hasDeadline() );
+        REQUIRE_FALSE( context.shouldAbort() );
+        REQUIRE( context.remainingMilliseconds() == -1 );
+        REQUIRE( context.sleepFor(1ms) );
+
+        // No budget means no deadline, but a token to cancel with all the same.
+        sane::requestContext_t unbounded = sane::makeRequestContext(0ms);
+        REQUIRE_FALSE( unbounded.hasDeadline() );
+        REQUIRE( unbounded.cancellationToken != nullptr );
+    }
+
+    SECTION("A context expires at its deadline") {
+        sane::requestContext_t context = sane::makeRequestContext(30ms);
+
+        REQUIRE( context.hasDeadline() );
+        REQUIRE_FALSE( context.isExpired() );
+        REQUIRE( context.remainingMilliseconds() > 0 );
+        REQUIRE( context.remainingMilliseconds() <= 30 );
+
+        std::this_thread::sleep_for(40ms);
+        REQUIRE( context.isExpired() );
+        REQUIRE( context.shouldAbort() );
+        REQUIRE( context.remainingMilliseconds() == 0 );
+    }
+
+    SECTION("Cancelling is shared by every copy of the token") {
+        auto token = std::make_shared<sane::CancellationToken>();
+        sane::requestContext_t context = sane::makeRequestContext(10s, token);
+        sane::requestContext_t copy = context;
+
+        REQUIRE( context.cancellationToken == token );
+        REQUIRE_FALSE( copy.shouldAbort() );
+
+        token->cancel();
+        REQUIRE( context.isCancelled() );
+        REQUIRE( copy.shouldAbort() );
+        REQUIRE_FALSE( copy.isExpired() );
+    }
+
+    SECTION("Sleeping stops early when cancelled") {
+        sane::requestContext_t context = sane::makeRequestContext(10s);
+
+        std::thread canceller([&context]() {
+            std::this_thread::sleep_for(20ms);
+            context.cancellationToken->cancel();
+        });
+
+        auto start = std::chrono::steady_clock::now();
+        bool slept = context.sleepFor(5s);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        canceller.join();
+
+        REQUIRE_FALSE( slept );
+        REQUIRE( elapsed < 2s );
+    }
+
+    SECTION("Sleeping past the deadline doesn't even start") {
+        sane::requestContext_t context = sane::makeRequestContext(50ms);
+
+        auto start = std::chrono::steady_clock::now();
+        REQUIRE_FALSE( context.sleepFor(1s) );
+        REQUIRE( std::chrono::steady_clock::now() - start < 50ms );
+
+        REQUIRE( context.sleepFor(1ms) );
+    }
+}
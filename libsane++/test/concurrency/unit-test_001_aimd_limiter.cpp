@@ -0,0 +1,74 @@
+#include <catch2/catch.hpp>
+
+#include <concurrency/aimd_limiter.hpp>
+
+TEST_CASE ("1: Testing sane::concurrency: AIMD concurrency limiter.") {
+    sane::AIMDLimiter limiter(1, 1, 32);
+
+    SECTION("Slow start grows the limit by one per success, up to the maximum") {
+        for (int i = 0; i < 10; i++) {
+            limiter.onSuccess(100);
+        }
+        REQUIRE( limiter.getLimit() == 11 );
+
+        for (int i = 0; i < 100; i++) {
+            limiter.onSuccess(100);
+        }
+        REQUIRE( limiter.getLimit() == 32 );
+        REQUIRE( limiter.getPeakLimit() == 32 );
+    }
+
+    SECTION("Overload halves the limit once per round, then growth is additive") {
+        for (int i = 0; i < 15; i++) {
+            limiter.onSuccess(100);
+        }
+        REQUIRE( limiter.getLimit() == 16 );
+
+        // A whole round of in-flight requests reporting the same 429 only backs off once.
+        for (int i = 0; i < 16; i++) {
+            limiter.onOverload();
+        }
+        REQUIRE( limiter.getLimit() == 8 );
+        REQUIRE( limiter.getDecreaseCount() == 1 );
+
+        // Congestion avoidance: roughly +1 per round (~8 successes), not per success.
+        for (int i = 0; i < 4; i++) {
+            limiter.onSuccess(100);
+        }
+        REQUIRE( limiter.getLimit() == 8 );
+
+        for (int i = 0; i < 5; i++) {
+            limiter.onSuccess(100);
+        }
+        REQUIRE( limiter.getLimit() == 9 );
+    }
+
+    SECTION("Latency spikes count as overload") {
+        for (int i = 0; i < 7; i++) {
+            limiter.onSuccess(100);
+        }
+        REQUIRE( limiter.getLimit() == 8 );
+        REQUIRE( limiter.getBaselineLatency() == 100 );
+
+        limiter.onSuccess(1000);
+        REQUIRE( limiter.getLimit() == 4 );
+    }
+
+    SECTION("Successes without a timed transfer don't touch the baseline") {
+        limiter.onSuccess(-1);
+        REQUIRE( limiter.getBaselineLatency() == -1 );
+
+        limiter.onSuccess(100);
+        limiter.onSuccess(-1);
+        REQUIRE( limiter.getBaselineLatency() == 100 );
+        REQUIRE( limiter.getLimit() == 4 );
+        REQUIRE( limiter.getDecreaseCount() == 0 );
+    }
+
+    SECTION("Never drops below the minimum") {
+        for (int i = 0; i < 100; i++) {
+            limiter.onResult(100, true);
+        }
+        REQUIRE( limiter.getLimit() == 1 );
+    }
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <atomic>
+#include <vector>
+
+#include <concurrency/single_flight.hpp>
+#include <api_handler/api_handler.hpp>
+
+TEST_CASE ("2: Testing sane::concurrency: Single-flight request coalescing.") {
+    sane::SingleFlight<std::string> singleFlight;
+    std::atomic<int> calls{0};
+
+    SECTION("Concurrent callers for the same key share one call and one result") {
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::vector<std::shared_ptr<const std::string>> results(4);
+        std::vector<std::thread> callers;
+
+        auto call = [&]() {
+            calls++;
+            released.wait();
+            return std::make_shared<const std::string>("response");
+        };
+
+        for (size_t i = 0; i < results.size(); i++) {
+            callers.emplace_back([&, i]() { results[i] = singleFlight.run("playlistItems?id=1", call); });
+        }
+
+        // Hold the leader's call until everyone else has attached to it.
+        while (singleFlight.getCoalescedCount() < results.size() - 1) {
+            std::this_thread::yield();
+        }
+        release.set_value();
+
+        for (auto &caller : callers) {
+            caller.join();
+        }
+
+        REQUIRE( calls == 1 );
+        for (const auto &result : results) {
+            REQUIRE( result == results[0] );
+        }
+        REQUIRE( *results[0] == "response" );
+        REQUIRE( singleFlight.getInFlightCount() == 0 );
+    }
+
+    SECTION("Results are not cached once the call is done") {
+        auto call = [&]() {
+            calls++;
+            return std::make_shared<const std::string>(std::to_string(calls));
+        };
+
+        bool shared = true;
+        REQUIRE( *singleFlight.run("videos?id=1", call, sane::requestContext_t(), &shared) == "1" );
+        REQUIRE_FALSE( shared );
+        REQUIRE( *singleFlight.run("videos?id=1", call) == "2" );
+    }
+
+    SECTION("A leader giving up doesn't leave the callers waiting on it empty-handed") {
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        auto isAborted = [](const std::string &t_result) { return t_result.empty(); };
+
+        // The leader is cancelled mid-call, which is all its (empty) result says.
+        std::thread leader([&]() {
+            singleFlight.run("videos?id=1", [&]() {
+                calls++;
+                released.wait();
+                return std::make_shared<const std::string>();
+            });
+        });
+        while (calls < 1) {
+            std::this_thread::yield();
+        }
+
+        std::shared_ptr<const std::string> result;
+        std::thread follower([&]() {
+            result = singleFlight.run("videos?id=1", [&]() {
+                calls++;
+                return std::make_shared<const std::string>("response");
+            }, sane::requestContext_t(), nullptr, isAborted);
+        });
+        while (singleFlight.getCoalescedCount() < 1) {
+            std::this_thread::yield();
+        }
+        release.set_value();
+
+        leader.join();
+        follower.join();
+
+        REQUIRE( calls == 2 );
+        REQUIRE( *result == "response" );
+        REQUIRE( singleFlight.getRetriedCount() == 1 );
+    }
+
+    SECTION("Query parameter order doesn't make requests different") {
+        REQUIRE( sane::APIHandler::normalizeRequestUrl(std::string(YOUTUBE_API_CHANNELS) + "?part=snippet&mine=true&id=UC1")
+                 == sane::APIHandler::normalizeRequestUrl(std::string(YOUTUBE_API_CHANNELS) + "?id=UC1&part=snippet&mine=true") );
+        REQUIRE( sane::APIHandler::normalizeRequestUrl(std::string(YOUTUBE_API_CHANNELS) + "?part=snippet&id=UC1")
+                 != sane::APIHandler::normalizeRequestUrl(std::string(YOUTUBE_API_CHANNELS) + "?part=snippet&id=UC2") );
+        REQUIRE( sane::APIHandler::normalizeRequestUrl(YOUTUBE_API_CHANNELS) == YOUTUBE_API_CHANNELS );
+    }
+}
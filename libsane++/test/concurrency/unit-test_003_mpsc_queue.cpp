@@ -0,0 +1,55 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <concurrency/mpsc_queue.hpp>
+
+TEST_CASE ("3: Testing sane::concurrency: Lock-free MPSC completion queue.") {
+    sane::MPSCQueue<std::pair<int, int>> queue;
+
+    SECTION("An empty queue times out instead of blocking forever") {
+        std::pair<int, int> value;
+
+        REQUIRE( queue.empty() );
+        REQUIRE_FALSE( queue.tryPop(value) );
+        REQUIRE_FALSE( queue.waitPop(value, std::chrono::milliseconds(10)) );
+    }
+
+    SECTION("Everything pushed by concurrent producers is popped, in per-producer order") {
+        const int producerCount = 4;
+        const int itemsPerProducer = 10000;
+        std::vector<std::thread> producers;
+
+        for (int producer = 0; producer < producerCount; producer++) {
+            producers.emplace_back([&queue, producer]() {
+                for (int item = 0; item < itemsPerProducer; item++) {
+                    queue.push(std::make_pair(producer, item));
+                }
+            });
+        }
+
+        std::vector<int> nextItem(producerCount, 0);
+        int popped = 0;
+        bool ordered = true;
+        std::pair<int, int> value;
+
+        while (popped < producerCount * itemsPerProducer) {
+            if (queue.waitPop(value, std::chrono::seconds(5))) {
+                ordered = ordered and value.second == nextItem[value.first];
+                nextItem[value.first] = value.second + 1;
+                popped++;
+            } else {
+                break;
+            }
+        }
+
+        for (auto &producer : producers) {
+            producer.join();
+        }
+
+        REQUIRE( popped == producerCount * itemsPerProducer );
+        REQUIRE( ordered );
+        REQUIRE( queue.empty() );
+    }
+}
@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <atomic>
+
+#include <concurrency/bounded_queue.hpp>
+
+TEST_CASE ("4: Testing sane::concurrency: Bounded pipeline queue.") {
+    sane::BoundedQueue<int> queue(2);
+
+    SECTION("A full queue holds producers back until a consumer makes room") {
+        std::atomic<bool> thirdPushed{false};
+
+        REQUIRE( queue.push(1) );
+        REQUIRE( queue.push(2) );
+
+        std::thread producer([&]() {
+            queue.push(3);
+            thirdPushed = true;
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        REQUIRE_FALSE( thirdPushed );
+        REQUIRE( queue.size() == 2 );
+
+        int value;
+        REQUIRE( queue.pop(value) );
+        REQUIRE( value == 1 );
+
+        producer.join();
+        REQUIRE( thirdPushed );
+        REQUIRE( queue.size() == 2 );
+    }
+
+    SECTION("Closing lets consumers drain what is left, then stop") {
+        int value;
+
+        REQUIRE( queue.push(1) );
+        queue.close();
+        REQUIRE_FALSE( queue.push(2) );
+
+        REQUIRE( queue.pop(value) );
+        REQUIRE( value == 1 );
+        REQUIRE_FALSE( queue.pop(value) );
+    }
+
+    SECTION("Closing wakes up a blocked consumer") {
+        std::atomic<bool> popped{true};
+
+        std::thread consumer([&]() {
+            int value;
+            popped = queue.pop(value);
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.close();
+        consumer.join();
+
+        REQUIRE_FALSE( popped );
+    }
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch.hpp>
+
+#include <thread>
+#include <atomic>
+#include <chrono>
+
+#include <concurrency/work_stealing_scheduler.hpp>
+
+TEST_CASE ("5: Testing sane::concurrency: Work-stealing scheduler.") {
+    using std::chrono_literals::operator""ms;
+
+    std::atomic<int> done{0};
+
+    SECTION("wait() returns once every task, including tasks submitted by tasks, has run") {
+        sane::WorkStealingScheduler scheduler(4);
+
+        for (int i = 0; i < 100; i++) {
+            scheduler.submit([&]() {
+                scheduler.submit([&]() { done++; });
+                done++;
+            });
+        }
+        scheduler.wait();
+
+        REQUIRE( done == 200 );
+        REQUIRE( scheduler.getExecutedCount() == 200 );
+    }
+
+    SECTION("Idle workers steal from a worker that is stuck on a long task") {
+        sane::WorkStealingScheduler scheduler(2);
+
+        // Everything lands on the first task's worker, which is busy for a while.
+        scheduler.submit([&]() {
+            for (int i = 0; i < 10; i++) {
+                scheduler.submit([&]() { done++; });
+            }
+            while (done < 10) {
+                std::this_thread::sleep_for(1ms);
+            }
+        });
+        scheduler.wait();
+
+        REQUIRE( done == 10 );
+        REQUIRE( scheduler.getStolenCount() >= 10 );
+    }
+
+    SECTION("An exception in a task doesn't take the worker down") {
+        sane::WorkStealingScheduler scheduler(1);
+
+        scheduler.submit([]() { throw std::runtime_error("task failed"); });
+        scheduler.submit([&]() { done++; });
+        scheduler.wait();
+
+        REQUIRE( done == 1 );
+        REQUIRE( scheduler.getWorkerCount() == 1 );
+    }
+
+    SECTION("A task throwing something that isn't a std::exception still counts as run") {
+        sane::WorkStealingScheduler scheduler(1);
+
+        scheduler.submit([]() { throw 42; });
+        scheduler.submit([&]() { done++; });
+        scheduler.wait();
+
+        REQUIRE( done == 1 );
+        REQUIRE( scheduler.getExecutedCount() == 2 );
+    }
+}
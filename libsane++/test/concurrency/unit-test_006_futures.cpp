@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+#include <tuple>
+#include <stdexcept>
+
+#include <concurrency/futures.hpp>
+
+TEST_CASE ("6: Testing sane::concurrency: Futures and whenAll combinators.") {
+    sane::WorkStealingScheduler executor(4);
+
+    SECTION("submitFuture() delivers the function's result") {
+        std::future<int> answer = sane::submitFuture(executor, []() { return 6 * 7; });
+
+        REQUIRE( answer.get() == 42 );
+    }
+
+    SECTION("whenAll() collects results in submission order") {
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 50; i++) {
+            futures.push_back(sane::submitFuture(executor, [i]() { return i * i; }));
+        }
+
+        std::vector<int> results = sane::whenAll(std::move(futures)).get();
+
+        REQUIRE( results.size() == 50 );
+        for (int i = 0; i < 50; i++) {
+            REQUIRE( results[i] == i * i );
+        }
+    }
+
+    SECTION("whenAll() combines futures of different types into a tuple") {
+        auto combined = sane::whenAll(sane::submitFuture(executor, []() { return 1; }),
+                                      sane::submitFuture(executor, []() { return std::string("two"); }));
+
+        std::tuple<int, std::string> results = combined.get();
+
+        REQUIRE( std::get<0>(results) == 1 );
+        REQUIRE( std::get<1>(results) == "two" );
+    }
+
+    SECTION("Exceptions propagate through the combined future") {
+        std::vector<std::future<int>> futures;
+        futures.push_back(sane::submitFuture(executor, []() { return 1; }));
+        futures.push_back(sane::submitFuture(executor, []() -> int { throw std::runtime_error("request failed"); }));
+
+        auto combined = sane::whenAll(std::move(futures));
+
+        REQUIRE_THROWS_AS( combined.get(), std::runtime_error );
+    }
+}
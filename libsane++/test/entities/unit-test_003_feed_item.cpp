@@ -0,0 +1,114 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include <entities/feed_item.hpp>
+
+TEST_CASE ("3: Testing sane::entities: Parse FeedItems straight from a videos.list() response.") {
+    // Raw string literal JSON of a (trimmed) YouTube API videos.list() response.
+    const std::string body =
+    R"(
+        {
+            "kind": "youtube#videoListResponse",
+            "items": [
+                {
+                    "kind": "youtube#video",
+                    "id": "dQw4w9WgXcQ",
+                    "snippet": {
+                        "publishedAt": "2009-10-25T06:57:33.000Z",
+                        "channelId": "UCuAXFkgsw1L7xaCfnd5JJOw",
+                        "title": "Never Gonna Give You Up",
+                        "thumbnails": {"default": {"url": "https://i.ytimg.com/vi/dQw4w9WgXcQ/default.jpg"}},
+                        "channelTitle": "Rick Astley",
+                        "tags": ["title", "id"],
+                        "liveBroadcastContent": "none"
+                    },
+                    "contentDetails": {
+                        "duration": "PT3M33S",
+                        "definition": "hd",
+                        "caption": "true",
+                        "licensedContent": true
+                    }
+                },
+                {
+                    "kind": "youtube#video",
+                    "id": "jNQXAC9IVRw",
+                    "snippet": {
+                        "publishedAt": "2005-04-24T03:31:52Z",
+                        "channelId": "UC4QobU6STFB0P71PMvOGN5A",
+                        "title": "Me at the zoo",
+                        "channelTitle": "jawed",
+                        "liveBroadcastContent": "live"
+                    },
+                    "contentDetails": {
+                        "duration": "P1DT1H",
+                        "definition": "sd",
+                        "caption": "false"
+                    }
+                },
+                {
+                    "kind": "youtube#video",
+                    "id": "dQw4w9WgXcU",
+                    "snippet": {
+                        "publishedAt": "2009-10-26T00:00:00.000Z",
+                        "channelId": "UCuAXFkgsw1L7xaCfnd5JJOw",
+                        "title": "Never Gonna Give You Up, again",
+                        "channelTitle": "Rick Astley"
+                    }
+                },
+                {
+                    "kind": "youtube#video",
+                    "id": "missingsnippet"
+                }
+            ]
+        }
+    )";
+
+    sane::FeedChannelTable channels;
+    std::vector<sane::FeedItem> items;
+
+    SECTION("Fields, flags and interned channels") {
+        REQUIRE( sane::parseFeedItems(body, channels, items) );
+
+        // The item without a snippet is skipped.
+        REQUIRE( items.size() == 3 );
+        REQUIRE( channels.size() == 2 );
+
+        REQUIRE( items[0].getId() == "dQw4w9WgXcQ" );
+        REQUIRE( items[0].getTitle() == "Never Gonna Give You Up" );
+        REQUIRE( items[0].getPublishedAtMs() == 1256453853000 );
+        REQUIRE( items[0].getDurationSeconds() == 213 );
+        REQUIRE( items[0].isHD() );
+        REQUIRE( items[0].hasCaptions() );
+        REQUIRE_FALSE( items[0].isLive() );
+        REQUIRE( channels.getChannelTitle(items[0].getChannel()) == "Rick Astley" );
+
+        REQUIRE( items[1].getPublishedAtMs() == 1114313512000 );
+        REQUIRE( items[1].getDurationSeconds() == 90000 );
+        REQUIRE_FALSE( items[1].isHD() );
+        REQUIRE_FALSE( items[1].hasCaptions() );
+        REQUIRE( items[1].isLive() );
+        REQUIRE( channels.getChannelId(items[1].getChannel()) == "UC4QobU6STFB0P71PMvOGN5A" );
+
+        // Same channel, same index.
+        REQUIRE( items[2].getChannel() == items[0].getChannel() );
+
+        std::sort(items.begin(), items.end(), sane::sortFeedItemDateDescending());
+        REQUIRE( items.front().getId() == "dQw4w9WgXcU" );
+        REQUIRE( items.back().getId() == "jNQXAC9IVRw" );
+    }
+
+    SECTION("Malformed bodies and values") {
+        REQUIRE_FALSE( sane::parseFeedItems("{\"items\": [", channels, items) );
+        REQUIRE( items.empty() );
+
+        REQUIRE( sane::FeedItem::parsePublishedAtMs("1970-01-01T00:00:01.5Z") == 1500 );
+        REQUIRE( sane::FeedItem::parsePublishedAtMs("yesterday") == -1 );
+        REQUIRE( sane::FeedItem::parseDurationSeconds("P0D") == 0 );
+        REQUIRE( sane::FeedItem::parseDurationSeconds("PT1H2M3S") == 3723 );
+        REQUIRE( sane::FeedItem::parseDurationSeconds("PT5") == -1 );
+        REQUIRE( sane::FeedItem::parseDurationSeconds("3M") == -1 );
+    }
+}
@@ -0,0 +1,57 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+#include <entities/video_table.hpp>
+
+TEST_CASE ("4: Testing sane::entities: Columnar VideoTable scan/filter kernels.") {
+    sane::VideoTable table;
+    uint32_t rick = table.internChannel("UCuAXFkgsw1L7xaCfnd5JJOw", "Rick Astley");
+    uint32_t jawed = table.internChannel("UC4QobU6STFB0P71PMvOGN5A", "jawed");
+
+    table.append("dQw4w9WgXcQ", 1256453853000, rick, "Never Gonna Give You Up", 213,
+                 FEED_ITEM_FLAG_HD | FEED_ITEM_FLAG_CAPTIONS);
+    table.append("jNQXAC9IVRw", 1114313512000, jawed, "Me at the zoo", 19, 0);
+    table.append("yPYZpwSpKmA", 1300000000000, rick, "Together Forever", 205, FEED_ITEM_FLAG_HD);
+    table.append("lXMskKTw3Bc", 1400000000000, rick, "Live", 0, FEED_ITEM_FLAG_LIVE);
+
+    SECTION("Rows read back from the columns and the title arena") {
+        REQUIRE( table.size() == 4 );
+        REQUIRE( table.getId(1) == "jNQXAC9IVRw" );
+        REQUIRE( table.getTitle(1) == "Me at the zoo" );
+        REQUIRE( table.getTitle(2) == "Together Forever" );
+        REQUIRE( table.getChannels().getChannelTitle(table.getChannel(2)) == "Rick Astley" );
+        REQUIRE( table.getDurationSeconds(0) == 213 );
+    }
+
+    SECTION("Filters narrow down a selection") {
+        sane::selection_t selection = table.selectAll();
+        table.filterChannel(rick, selection);
+        REQUIRE( sane::VideoTable::countSelected(selection) == 3 );
+
+        table.filterFlags(FEED_ITEM_FLAG_HD, FEED_ITEM_FLAG_LIVE, selection);
+        REQUIRE( sane::VideoTable::getSelectedRows(selection) == std::vector<uint32_t>{0, 2} );
+
+        table.filterPublishedBetween(1200000000000, 1290000000000, selection);
+        REQUIRE( sane::VideoTable::getSelectedRows(selection) == std::vector<uint32_t>{0} );
+
+        selection = table.selectAll();
+        table.filterDurationBetween(1, 210, selection);
+        REQUIRE( sane::VideoTable::getSelectedRows(selection) == std::vector<uint32_t>{1, 2} );
+    }
+
+    SECTION("Sorting and appending API responses") {
+        std::vector<uint32_t> rows = table.sortByPublishedDescending({0, 1, 2, 3});
+        REQUIRE( rows == std::vector<uint32_t>{3, 2, 0, 1} );
+
+        REQUIRE( table.appendResponse(R"({"items": [{"id": "9bZkp7q19f0", "snippet": {
+            "publishedAt": "2012-07-15T07:46:32.000Z", "channelId": "UCrDkAvwZum-UTjHmzDI2iIw",
+            "title": "Gangnam Style", "channelTitle": "officialpsy"},
+            "contentDetails": {"duration": "PT4M13S", "definition": "hd", "caption": "false"}}]})") );
+        REQUIRE( table.size() == 5 );
+        REQUIRE( table.getChannels().size() == 3 );
+        REQUIRE( table.getDurationSeconds(4) == 253 );
+        REQUIRE( table.getFlags(4) == FEED_ITEM_FLAG_HD );
+    }
+}
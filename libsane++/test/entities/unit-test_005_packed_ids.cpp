@@ -0,0 +1,68 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <cstdint>
+#include <unordered_set>
+
+#include <entities/packed_ids.hpp>
+
+// Packing is constexpr, so IDs can be compile time constants.
+static constexpr sane::VideoId RICK_ROLL = sane::VideoId::encode("dQw4w9WgXcQ");
+static_assert(sane::VideoId::isValid("dQw4w9WgXcQ", 11), "valid video ID");
+static_assert(!sane::VideoId::isValid("dQw4w9WgXcR", 11), "last character carries bits a video ID doesn't have");
+static_assert(!sane::VideoId::isValid("dQw4w9WgX!Q", 11), "not base64url");
+
+TEST_CASE ("5: Testing sane::entities: Packed VideoId and ChannelId.") {
+    SECTION("Video IDs round trip through 64 bits") {
+        for (const std::string id : {"dQw4w9WgXcQ", "jNQXAC9IVRw", "9bZkp7q19f0", "AAAAAAAAAAA", "__________w"}) {
+            sane::VideoId videoId;
+            REQUIRE( sane::VideoId::tryParse(id, videoId) );
+            REQUIRE( videoId.toString() == id );
+            REQUIRE( sane::VideoId::fromInt64(videoId.toInt64()) == videoId );
+        }
+
+        REQUIRE( RICK_ROLL == sane::VideoId::fromString("dQw4w9WgXcQ") );
+        REQUIRE( sane::VideoId(UINT64_MAX).toString() == "__________8" );
+
+        sane::VideoId untouched(42);
+        REQUIRE_FALSE( sane::VideoId::tryParse("dQw4w9WgXc", untouched) );
+        REQUIRE_FALSE( sane::VideoId::tryParse("dQw4w9WgXcR", untouched) );
+        REQUIRE( untouched.getValue() == 42 );
+    }
+
+    SECTION("Channel IDs round trip through 128 bits plus a tag") {
+        sane::ChannelId channelId;
+        REQUIRE( sane::ChannelId::tryParse("UCuAXFkgsw1L7xaCfnd5JJOw", channelId) );
+        REQUIRE( channelId.getTag() == sane::ChannelIdTag::Channel );
+        REQUIRE( channelId.toString() == "UCuAXFkgsw1L7xaCfnd5JJOw" );
+        REQUIRE( channelId.toBodyString() == "uAXFkgsw1L7xaCfnd5JJOw" );
+
+        // A channel and its playlists only differ by tag.
+        sane::ChannelId uploads = channelId.withTag(sane::ChannelIdTag::Uploads);
+        REQUIRE( uploads.toString() == "UUuAXFkgsw1L7xaCfnd5JJOw" );
+        REQUIRE( uploads != channelId );
+        REQUIRE( sane::ChannelId::fromString("UUuAXFkgsw1L7xaCfnd5JJOw") == uploads );
+        REQUIRE( sane::ChannelId::fromString("LL4QobU6STFB0P71PMvOGN5A").getTag() == sane::ChannelIdTag::Likes );
+
+        uint8_t bytes[CHANNEL_ID_BYTES];
+        channelId.toBytes(bytes);
+        REQUIRE( sane::ChannelId::fromBytes(bytes) == channelId );
+
+        REQUIRE( sane::ChannelId(UINT64_MAX, UINT64_MAX).toBodyString() == "_____________________w" );
+
+        REQUIRE_FALSE( sane::ChannelId::isValid("PLuAXFkgsw1L7xaCfnd5JJOw") );
+        REQUIRE_FALSE( sane::ChannelId::isValid("UCuAXFkgsw1L7xaCfnd5JJOx") );
+        REQUIRE_FALSE( sane::ChannelId::isValid("UCuAXFkgsw1L7xaCfnd5JJ") );
+    }
+
+    SECTION("Packed IDs work as hash keys") {
+        std::unordered_set<sane::VideoId> videos{RICK_ROLL, sane::VideoId::fromString("jNQXAC9IVRw")};
+        REQUIRE( videos.count(sane::VideoId::fromString("dQw4w9WgXcQ")) == 1 );
+        REQUIRE( videos.count(sane::VideoId()) == 0 );
+
+        sane::ChannelId channelId = sane::ChannelId::fromString("UC4QobU6STFB0P71PMvOGN5A");
+        std::unordered_set<sane::ChannelId> channels{channelId};
+        REQUIRE( channels.count(channelId) == 1 );
+        REQUIRE( channels.count(channelId.withTag(sane::ChannelIdTag::Uploads)) == 0 );
+    }
+}
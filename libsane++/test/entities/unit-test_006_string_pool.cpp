@@ -0,0 +1,62 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <entities/string_pool.hpp>
+#include <entities/youtube_video.hpp>
+
+TEST_CASE ("6: Testing sane::entities: String interning pool.") {
+    SECTION("Equal strings share one pooled copy") {
+        sane::StringPool pool;
+        sane::InternedString first = pool.intern("Rick Astley");
+        sane::InternedString second = pool.intern(std::string("Rick ") + "Astley");
+
+        REQUIRE( first == second );
+        REQUIRE( &first.get() == &second.get() );
+        REQUIRE( first != pool.intern("jawed") );
+        REQUIRE( pool.size() == 2 );
+
+        REQUIRE( pool.intern("") == sane::InternedString() );
+        REQUIRE( sane::InternedString().empty() );
+        REQUIRE( pool.size() == 2 );
+    }
+
+    SECTION("Concurrent interning hands out the same handles") {
+        sane::StringPool pool;
+        std::vector<std::vector<sane::InternedString>> results(4);
+        std::vector<std::thread> threads;
+
+        for (auto &result : results) {
+            threads.emplace_back([&pool, &result]() {
+                for (int i = 0; i < 1000; i++) {
+                    result.push_back(pool.intern("value " + std::to_string(i % 100)));
+                }
+            });
+        }
+        for (std::thread &thread : threads) {
+            thread.join();
+        }
+
+        REQUIRE( pool.size() == 100 );
+        for (const auto &result : results) {
+            REQUIRE( result == results.front() );
+        }
+    }
+
+    SECTION("YoutubeVideo interns its repeated fields") {
+        sane::YoutubeVideo video1;
+        sane::YoutubeVideo video2;
+        video1.setChannelTitle("Rick Astley");
+        video2.setChannelTitle("Rick Astley");
+        video1.setTags(std::vector<std::string>{"rick", "astley"});
+        video2.setTags(std::vector<std::string>{"astley"});
+
+        REQUIRE( video1.getChannelTitle() == "Rick Astley" );
+        REQUIRE( &video1.getChannelTitle() == &video2.getChannelTitle() );
+        REQUIRE( video1.getTags().size() == 2 );
+        REQUIRE( video1.getTags()[1] == video2.getTags()[0] );
+        REQUIRE( video2.getTags()[0].get() == "astley" );
+    }
+}
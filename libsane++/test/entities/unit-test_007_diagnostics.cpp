@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/common.hpp>
+#include <entities/diagnostics.hpp>
+#include <entities/youtube_video.hpp>
+
+TEST_CASE ("7: Testing sane::entities: Entity diagnostics.") {
+    SECTION("Valid JSON values report nothing") {
+        sane::Diagnostics diagnostics;
+        nlohmann::json string = "Never Gonna Give You Up";
+        nlohmann::json digits = "1337";
+        nlohmann::json number = 42;
+        nlohmann::json boolean = true;
+
+        REQUIRE( sane::getJsonStringValue(string, "string", diagnostics) == "Never Gonna Give You Up" );
+        REQUIRE( sane::getJsonULongValue(digits, "digits", diagnostics) == 1337 );
+        REQUIRE( sane::getJsonLongValue(number, "number", diagnostics) == 42 );
+        REQUIRE( sane::getJsonBoolValue(boolean, "boolean", diagnostics) );
+        REQUIRE( diagnostics.empty() );
+    }
+
+    SECTION("Invalid JSON values are reported with a code") {
+        sane::Diagnostics diagnostics;
+        nlohmann::json nullString = "null";
+        nlohmann::json null;
+        nlohmann::json letters = "abc";
+        nlohmann::json array = nlohmann::json::array({1, 2});
+
+        REQUIRE( sane::getJsonStringValue(nullString, "setTitle", diagnostics).empty() );
+        REQUIRE( sane::getJsonStringValue(null, "setDescription", diagnostics).empty() );
+        REQUIRE( sane::getJsonULongValue(letters, "setViewCount", diagnostics) == 0 );
+        REQUIRE( sane::getJsonLongValue(array, "setEmbedWidth", diagnostics) == 0 );
+
+        REQUIRE( diagnostics.count(sane::DiagnosticSeverity::Warning) == 1 );
+        REQUIRE( diagnostics.count(sane::DiagnosticSeverity::Error) == 3 );
+
+        const auto &all = diagnostics.getAll();
+        REQUIRE( all.size() == 4 );
+        REQUIRE( all[0].code == sane::DiagnosticCode::NullString );
+        REQUIRE( all[1].code == sane::DiagnosticCode::MissingValue );
+        REQUIRE( all[2].code == sane::DiagnosticCode::NonDigitString );
+        REQUIRE( all[3].code == sane::DiagnosticCode::WrongType );
+
+        REQUIRE( all[0].getMessage() == "setTitle: expected string, got the \"null\" string!" );
+        REQUIRE( all[2].getMessage() == "setViewCount: expected unsigned long, got non-digit string! JSON: \"abc\"" );
+        REQUIRE( all[3].getMessage() == "setEmbedWidth: expected long, got array! JSON: [1,2]" );
+
+        diagnostics.clear(sane::DiagnosticSeverity::Error);
+        REQUIRE( diagnostics.getAll().size() == 1 );
+        diagnostics.clear();
+        REQUIRE( diagnostics.empty() );
+    }
+
+    SECTION("Entities count their warnings and errors") {
+        nlohmann::json videoJson = {
+                {"kind", "youtube#video"},
+                {"id", "dQw4w9WgXcQ"},
+                {"snippet", {{"title", "Never Gonna Give You Up"}, {"channelTitle", "RickAstleyVEVO"}}}
+        };
+        sane::YoutubeVideo video(videoJson);
+
+        REQUIRE( video.getDiagnostics().empty() );
+        REQUIRE( video.getErrorCount() == 0 );
+        REQUIRE( video.getWarningCount() == 0 );
+
+        video.addWarning("Something odd");
+        video.addError("Something wrong", videoJson);
+        REQUIRE( video.getWarningCount() == 1 );
+        REQUIRE( video.getErrorCount() == 1 );
+        REQUIRE( video.getDiagnostics().getAll().back().getMessage() == "Something wrong" );
+
+        video.clearErrorsAndWarnings();
+        REQUIRE( video.getDiagnostics().empty() );
+    }
+}
@@ -0,0 +1,101 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <entities/lazy_video.hpp>
+
+TEST_CASE ("8: Testing sane::entities: Lazily decoded videos.") {
+    auto body = std::make_shared<const std::string>(R"json(
+        {
+            "kind": "youtube#videoListResponse",
+            "pageInfo": {"totalResults": 2, "resultsPerPage": 2},
+            "items": [
+                {
+                    "kind": "youtube#video",
+                    "id": "dQw4w9WgXcQ",
+                    "snippet": {
+                        "publishedAt": "2009-10-25T06:57:33.000Z",
+                        "channelId": "UCuAXFkgsw1L7xaCfnd5JJOw",
+                        "title": "Rick Astley - Never Gonna Give You Up (Video)",
+                        "description": "\"Never Gonna Give You Up\"\nBlåbær \u00e6 \ud83c\udfb5 [{]}",
+                        "channelTitle": "RickAstleyVEVO",
+                        "tags": ["rick", "astley"]
+                    },
+                    "contentDetails": {"duration": "PT3M33S", "licensedContent": true, "caption": "false"},
+                    "statistics": {"viewCount": "600000000", "likeCount": 4000000}
+                },
+                {
+                    "kind": "youtube#video",
+                    "id": "jNQXAC9IVRw",
+                    "snippet": {"title": "Me at the zoo", "channelTitle": "jawed"}
+                }
+            ]
+        }
+    )json");
+
+    std::vector<sane::LazyVideo> videos;
+
+    SECTION("Fields are decoded on access") {
+        REQUIRE( sane::parseLazyVideos(body, videos) );
+        REQUIRE( videos.size() == 2 );
+        REQUIRE( body.use_count() == 3 );
+
+        const sane::LazyVideo &video = videos[0];
+        REQUIRE( video.isValid() );
+        REQUIRE( video.getId() == "dQw4w9WgXcQ" );
+        REQUIRE( video.getTitle() == "Rick Astley - Never Gonna Give You Up (Video)" );
+        REQUIRE( video.getChannelId() == "UCuAXFkgsw1L7xaCfnd5JJOw" );
+        REQUIRE( video.getChannelTitle() == "RickAstleyVEVO" );
+        REQUIRE( video.getPublishedAt() == "2009-10-25T06:57:33.000Z" );
+        REQUIRE( video.getDescription() == "\"Never Gonna Give You Up\"\nBlåbær \xc3\xa6 \xf0\x9f\x8e\xb5 [{]}" );
+        REQUIRE( video.getDuration() == "PT3M33S" );
+        REQUIRE( video.getViewCount() == 600000000 );
+        REQUIRE( video.getULong(sane::VideoPart::Statistics, "likeCount") == 4000000 );
+        REQUIRE( video.getBool(sane::VideoPart::ContentDetails, "licensedContent") );
+        REQUIRE_FALSE( video.getBool(sane::VideoPart::ContentDetails, "caption") );
+
+        REQUIRE( video.hasPart(sane::VideoPart::Statistics) );
+        REQUIRE_FALSE( video.hasPart(sane::VideoPart::Player) );
+        REQUIRE( video.getString(sane::VideoPart::Player, "embedHtml").empty() );
+        REQUIRE( video.getPart(sane::VideoPart::Snippet)["tags"].size() == 2 );
+
+        REQUIRE( videos[1].getTitle() == "Me at the zoo" );
+        REQUIRE( videos[1].getDuration().empty() );
+        REQUIRE( videos[1].getViewCount() == 0 );
+    }
+
+    SECTION("Raw strings point into the buffer") {
+        REQUIRE( sane::parseLazyVideos(body, videos) );
+
+        const char *data = nullptr;
+        size_t length = 0;
+        REQUIRE( videos[0].getRawString(sane::VideoPart::Snippet, "channelTitle", data, length) );
+        REQUIRE( std::string(data, length) == "RickAstleyVEVO" );
+        REQUIRE( data > body->data() );
+        REQUIRE( data < body->data() + body->size() );
+
+        // Escaped strings have to be decoded.
+        REQUIRE_FALSE( videos[0].getRawString(sane::VideoPart::Snippet, "description", data, length) );
+    }
+
+    SECTION("Materializing a full YoutubeVideo") {
+        REQUIRE( sane::parseLazyVideos(body, videos) );
+
+        std::shared_ptr<sane::YoutubeVideo> video = videos[0].materialize();
+        REQUIRE( video->getId() == "dQw4w9WgXcQ" );
+        REQUIRE( video->getTitle() == videos[0].getTitle() );
+        REQUIRE( video->getDescription() == videos[0].getDescription() );
+    }
+
+    SECTION("Malformed bodies") {
+        REQUIRE_FALSE( sane::parseLazyVideos(std::make_shared<const std::string>("{\"items\": ["), videos) );
+        REQUIRE_FALSE( sane::parseLazyVideos(std::make_shared<const std::string>("[1, 2"), videos) );
+        REQUIRE( videos.empty() );
+
+        REQUIRE( sane::parseLazyVideos(std::make_shared<const std::string>("{\"items\": []}"), videos) );
+        REQUIRE( sane::parseLazyVideos(std::make_shared<const std::string>("{}"), videos) );
+        REQUIRE( videos.empty() );
+    }
+}
@@ -0,0 +1,48 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/video_parts.hpp>
+#include <entities/youtube_video.hpp>
+
+TEST_CASE ("9: Testing sane::entities: Video part sets.") {
+    SECTION("Parsing and building the part parameter") {
+        sane::VideoParts parts = sane::VideoParts::parse("id,snippet, contentDetails,bogus");
+
+        REQUIRE( parts.has(sane::VideoPart::Snippet) );
+        REQUIRE( parts.has(sane::VideoPart::ContentDetails) );
+        REQUIRE_FALSE( parts.has(sane::VideoPart::Statistics) );
+        REQUIRE( parts.toString() == "snippet,contentDetails" );
+        REQUIRE( sane::VideoParts::parse(parts.toString()) == parts );
+
+        REQUIRE( sane::VideoParts::parse("id").empty() );
+        REQUIRE( sane::VideoParts::parse("id").toString() == "id" );
+        REQUIRE( sane::VideoParts::parse(sane::VideoParts::all().toString()) == sane::VideoParts::all() );
+
+        static_assert(sane::VideoParts().with(sane::VideoPart::Player).has(sane::VideoPart::Player),
+                      "VideoParts is usable at compile time");
+    }
+
+    SECTION("Only the requested parts are parsed") {
+        nlohmann::json videoJson = {
+                {"kind", "youtube#video"},
+                {"id", "dQw4w9WgXcQ"},
+                {"snippet", {{"title", "Never Gonna Give You Up"}}},
+                {"contentDetails", {{"duration", "PT3M33S"}}},
+                {"statistics", {{"viewCount", "1337"}}}
+        };
+
+        sane::YoutubeVideo everything(videoJson);
+        REQUIRE( everything.getParts() == sane::VideoParts::parse("snippet,contentDetails,statistics") );
+        REQUIRE( everything.getViewCount() == 1337 );
+
+        sane::YoutubeVideo requested(videoJson, sane::VideoParts::parse("snippet"));
+        REQUIRE( requested.getId() == "dQw4w9WgXcQ" );
+        REQUIRE( requested.getTitle() == "Never Gonna Give You Up" );
+        REQUIRE( requested.hasPart(sane::VideoPart::Snippet) );
+        REQUIRE_FALSE( requested.hasPart(sane::VideoPart::Statistics) );
+        REQUIRE( requested.getViewCount() == 0 );
+    }
+}
@@ -0,0 +1,78 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/youtube_video.hpp>
+#include <entities/youtube_channel.hpp>
+
+// Strings long enough to never fit in a std::string's small buffer.
+static nlohmann::json createVideoJson() {
+    return {
+        {"kind", "youtube#video"},
+        {"id", "dQw4w9WgXcQ"},
+        {"snippet", {
+            {"channelId", "UCuAXFkgsw1L7xaCfnd5JJOw"},
+            {"title", "Rick Astley - Never Gonna Give You Up (Video)"},
+            {"description", "Rick Astley's official music video for \"Never Gonna Give You Up\""},
+            {"channelTitle", "RickAstleyVEVO"},
+            {"tags", {"rick astley", "never gonna give you up", "rickroll"}},
+            {"categoryId", "10"},
+            {"localized", {
+                {"title", "Rick Astley - Never Gonna Give You Up (Vidéo)"},
+                {"description", "Le clip officiel de \"Never Gonna Give You Up\" par Rick Astley"}
+            }}
+        }},
+        {"contentDetails", {{"duration", "PT3M33S"}, {"dimension", "2d"}, {"definition", "hd"}}},
+        {"topicDetails", {{"topicCategories", {
+            "https://en.wikipedia.org/wiki/Music",
+            "https://en.wikipedia.org/wiki/Pop_music",
+            "https://en.wikipedia.org/wiki/Electronic_music"
+        }}}}
+    };
+}
+
+TEST_CASE ("10: Testing sane::entities: Constructing entities from JSON that is moved in.") {
+    SECTION("Moved JSON is parsed without copying its strings") {
+        nlohmann::json videoJson = createVideoJson();
+        const char *description = videoJson["snippet"]["description"].get_ref<const std::string &>().data();
+
+        sane::YoutubeVideo video;
+        video.addFromJson(std::move(videoJson));
+
+        REQUIRE( video.getDiagnostics().empty() );
+        REQUIRE( video.getDescription().data() == description );
+        REQUIRE( video.getTopicCategories().size() == 3 );
+        REQUIRE( video.getLocalizedTitle() == "Rick Astley - Never Gonna Give You Up (Vidéo)" );
+
+        // The JSON is left behind with the strings taken out of it.
+        REQUIRE( videoJson["snippet"]["description"].get_ref<const std::string &>().empty() );
+    }
+
+    SECTION("Copied JSON is left alone") {
+        const nlohmann::json videoJson = createVideoJson();
+        sane::YoutubeVideo video(videoJson);
+
+        REQUIRE( video.getDescription() == videoJson["snippet"]["description"] );
+        REQUIRE( videoJson["snippet"]["description"] == createVideoJson()["snippet"]["description"] );
+    }
+
+    SECTION("Channels take their strings too") {
+        nlohmann::json channelJson = {
+            {"kind", "youtube#channel"},
+            {"id", "UCuAXFkgsw1L7xaCfnd5JJOw"},
+            {"snippet", {
+                {"title", "Rick Astley and the Never Gonna Give You Up channel"},
+                {"description", "Official YouTube channel of Rick Astley, the one and only"}
+            }}
+        };
+        const char *description = channelJson["snippet"]["description"].get_ref<const std::string &>().data();
+
+        sane::YoutubeChannel channel;
+        channel.addFromJson(std::move(channelJson));
+
+        REQUIRE( channel.getId() == "uAXFkgsw1L7xaCfnd5JJOw" );
+        REQUIRE( channel.getDescription().data() == description );
+    }
+}
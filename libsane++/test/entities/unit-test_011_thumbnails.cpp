@@ -0,0 +1,105 @@
+#include <catch2/catch.hpp>
+
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/thumbnails.hpp>
+#include <entities/youtube_video.hpp>
+#include <entities/youtube_channel.hpp>
+
+TEST_CASE ("11: Testing sane::entities: Thumbnail slots and their encoding.") {
+    const std::string videoId = "dQw4w9WgXcQ";
+    const std::string channelThumbnail = "https://yt3.ggpht.com/a/AGF-l7-default=s88-c-k-c0xffffffff-no-rj-mo";
+
+    SECTION("Video thumbnail URLs are rebuilt from the video ID") {
+        sane::Thumbnails thumbnails;
+        thumbnails.set(sane::ThumbnailSize::High, "https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg", 480, 360,
+                       videoId);
+        thumbnails.set(sane::ThumbnailSize::Default, "https://i.ytimg.com/vi_webp/dQw4w9WgXcQ/default_live.webp",
+                       120, 90, videoId);
+
+        REQUIRE( thumbnails.has(sane::ThumbnailSize::High) );
+        REQUIRE_FALSE( thumbnails.has(sane::ThumbnailSize::Medium) );
+        REQUIRE( thumbnails.getPresence() == 0x05 );
+        REQUIRE_FALSE( thumbnails.isUrlStored(sane::ThumbnailSize::High) );
+        REQUIRE( thumbnails.isUrlStored(sane::ThumbnailSize::Default) );
+
+        REQUIRE( thumbnails.getUrl(sane::ThumbnailSize::High, videoId)
+                 == "https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg" );
+        REQUIRE( thumbnails.get(sane::ThumbnailSize::High, videoId).width == 480 );
+        REQUIRE( thumbnails.getUrl(sane::ThumbnailSize::Default, videoId)
+                 == "https://i.ytimg.com/vi_webp/dQw4w9WgXcQ/default_live.webp" );
+        REQUIRE( thumbnails.toMap(videoId).size() == 2 );
+
+        thumbnails.erase(sane::ThumbnailSize::Default);
+        REQUIRE( thumbnails.getPresence() == 0x04 );
+        REQUIRE( thumbnails.encode() == "h" );
+
+        thumbnails.set(sane::ThumbnailSize::High, "", 0, 0);
+        REQUIRE( thumbnails.empty() );
+    }
+
+    SECTION("Encoding round trip") {
+        sane::Thumbnails thumbnails;
+        thumbnails.set(sane::ThumbnailSize::Default, channelThumbnail, 88, 88);
+        thumbnails.set(sane::ThumbnailSize::Medium, "https://yt3.ggpht.com/a/medium;=s240", 240, 240);
+        thumbnails.set(sane::ThumbnailSize::High, "https://yt3.ggpht.com/a/high", 0, 0);
+
+        std::string encoded = thumbnails.encode();
+        sane::Thumbnails decoded;
+        REQUIRE( sane::Thumbnails::tryDecode(encoded, decoded) );
+        REQUIRE( decoded == thumbnails );
+        REQUIRE( decoded.getUrl(sane::ThumbnailSize::Medium) == "https://yt3.ggpht.com/a/medium;=s240" );
+
+        sane::Thumbnails empty;
+        REQUIRE( sane::Thumbnails::tryDecode("", empty) );
+        REQUIRE( empty.empty() );
+    }
+
+    SECTION("Malformed encodings are rejected") {
+        sane::Thumbnails decoded;
+        decoded.set(sane::ThumbnailSize::Maxres, channelThumbnail, 1, 1);
+
+        REQUIRE_FALSE( sane::Thumbnails::tryDecode("q", decoded) );
+        REQUIRE( decoded.empty() );
+        REQUIRE_FALSE( sane::Thumbnails::tryDecode("h;d", decoded) );
+        REQUIRE_FALSE( sane::Thumbnails::tryDecode("d;d", decoded) );
+        REQUIRE_FALSE( sane::Thumbnails::tryDecode("d88", decoded) );
+        REQUIRE_FALSE( sane::Thumbnails::tryDecode("d=99:short", decoded) );
+        REQUIRE_FALSE( sane::Thumbnails::tryDecode("d;", decoded) );
+    }
+
+    SECTION("Entities keep their thumbnails packed") {
+        nlohmann::json videoJson = {
+                {"kind", "youtube#video"},
+                {"id", videoId},
+                {"snippet", {{"thumbnails", {
+                        {"default", {{"url", "https://i.ytimg.com/vi/dQw4w9WgXcQ/default.jpg"},
+                                     {"width", 120}, {"height", 90}}},
+                        {"medium", {{"url", "https://i.ytimg.com/vi/dQw4w9WgXcQ/mqdefault.jpg"},
+                                    {"width", 320}, {"height", 180}}},
+                        {"high", {{"url", "https://i.ytimg.com/vi/dQw4w9WgXcQ/hqdefault.jpg"},
+                                  {"width", 480}, {"height", 360}}},
+                        {"standard", {{"url", "https://i.ytimg.com/vi/dQw4w9WgXcQ/sddefault.jpg"},
+                                      {"width", 640}, {"height", 480}}},
+                        {"maxres", {{"url", "https://i.ytimg.com/vi/dQw4w9WgXcQ/maxresdefault.jpg"},
+                                    {"width", 1280}, {"height", 720}}}
+                }}}}
+        };
+
+        sane::YoutubeVideo video(videoJson);
+        REQUIRE( video.getDiagnostics().empty() );
+        REQUIRE( video.getPackedThumbnails().encode() == "d;m;h;s;x" );
+        REQUIRE( video.getThumbnail(sane::ThumbnailSize::Maxres).url
+                 == "https://i.ytimg.com/vi/dQw4w9WgXcQ/maxresdefault.jpg" );
+        REQUIRE( video.getThumbnails()["medium"].height == 180 );
+
+        sane::YoutubeChannel channel;
+        channel.addFromValues("UCuAXFkgsw1L7xaCfnd5JJOw", true, false, false, "Rick Astley", "",
+                              channelThumbnail.c_str(), "", "", true, false);
+        REQUIRE( channel.getThumbnail(sane::ThumbnailSize::Default).url == channelThumbnail );
+        REQUIRE( channel.getPackedThumbnails().getPresence() == 0x01 );
+        REQUIRE( channel.getThumbnails().size() == 1 );
+    }
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch.hpp>
+
+// Built into test_allocations, which counts heap allocations (see tests/allocation_counter.hpp).
+
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/youtube_video.hpp>
+
+#include <allocation_counter.hpp>
+
+// Strings long enough to never fit in a std::string's small buffer (and no publishedAt, the datetime parser
+// allocates on its own).
+static nlohmann::json createVideoJson() {
+    return {
+        {"kind", "youtube#video"},
+        {"id", "dQw4w9WgXcQ"},
+        {"snippet", {
+            {"channelId", "UCuAXFkgsw1L7xaCfnd5JJOw"},
+            {"title", "Rick Astley - Never Gonna Give You Up (Video)"},
+            {"description", "Rick Astley's official music video for \"Never Gonna Give You Up\""},
+            {"channelTitle", "RickAstleyVEVO"},
+            {"tags", {"rick astley", "never gonna give you up", "rickroll"}},
+            {"categoryId", "10"},
+            {"localized", {
+                {"title", "Rick Astley - Never Gonna Give You Up (Vidéo)"},
+                {"description", "Le clip officiel de \"Never Gonna Give You Up\" par Rick Astley"}
+            }}
+        }},
+        {"contentDetails", {{"duration", "PT3M33S"}, {"dimension", "2d"}, {"definition", "hd"}}},
+        {"topicDetails", {{"topicCategories", {
+            "https://en.wikipedia.org/wiki/Music",
+            "https://en.wikipedia.org/wiki/Pop_music",
+            "https://en.wikipedia.org/wiki/Electronic_music"
+        }}}}
+    };
+}
+
+TEST_CASE ("12: Testing sane::entities: Heap allocations of entities built from moved JSON.") {
+    // Fields of createVideoJson() that end up in a heap buffer of the entity: title, description, the
+    // localized title and description and the three topic categories (interned fields are pooled).
+    const size_t ownedStrings = 7;
+
+    // Warm up, so the string pool already holds the repeated values for both runs.
+    sane::YoutubeVideo warmUp(createVideoJson());
+
+    SECTION("Moving saves (at least) the allocation of every owned string") {
+        const nlohmann::json videoJson = createVideoJson();
+        nlohmann::json movedJson = createVideoJson();
+        size_t copyAllocations;
+        size_t moveAllocations;
+
+        {
+            ScopedAllocationCounter counter;
+            sane::YoutubeVideo copied(videoJson);
+            copyAllocations = counter.getCount();
+        }
+        {
+            ScopedAllocationCounter counter;
+            sane::YoutubeVideo moved(std::move(movedJson));
+            moveAllocations = counter.getCount();
+        }
+
+        INFO( "copied: " << copyAllocations << " allocations, moved: " << moveAllocations );
+        REQUIRE( moveAllocations + ownedStrings <= copyAllocations );
+    }
+}
@@ -0,0 +1,54 @@
+#include <catch2/catch.hpp>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <entities/youtube_video.hpp>
+#include <entities/feed_item.hpp>
+#include <youtube/subfeed.hpp>
+
+static std::shared_ptr<sane::YoutubeVideo> makeVideo(const std::string &t_id, const std::string &t_title) {
+    nlohmann::json videoJson = {{"kind", "youtube#video"}, {"id", t_id}, {"snippet", {{"title", t_title}}}};
+
+    return std::make_shared<sane::YoutubeVideo>(videoJson);
+}
+
+TEST_CASE ("1: Testing sane::youtube: Removing duplicate videos from a feed.") {
+    std::list<std::shared_ptr<sane::YoutubeVideo>> videos;
+
+    SECTION("The first of each video is kept, in order") {
+        videos.push_back(makeVideo("dQw4w9WgXcQ", "first"));
+        videos.push_back(makeVideo("jNQXAC9IVRw", "other"));
+        videos.push_back(makeVideo("dQw4w9WgXcQ", "second"));
+
+        REQUIRE( sane::removeDuplicateVideos(videos) == 1 );
+        REQUIRE( videos.size() == 2 );
+        REQUIRE( videos.front()->getTitle() == "first" );
+        REQUIRE( videos.back()->getId() == "jNQXAC9IVRw" );
+    }
+
+    SECTION("Videos whose ID doesn't parse are all kept") {
+        videos.push_back(makeVideo("not an id", "first"));
+        videos.push_back(makeVideo("not an id", "second"));
+        videos.push_back(makeVideo("", "third"));
+
+        REQUIRE( sane::removeDuplicateVideos(videos) == 0 );
+        REQUIRE( videos.size() == 3 );
+    }
+
+    SECTION("Feed items are deduplicated the same way") {
+        std::vector<sane::FeedItem> items;
+        items.emplace_back("dQw4w9WgXcQ", 2000, 0, "first", 213, 0);
+        items.emplace_back("jNQXAC9IVRw", 1000, 1, "other", 19, 0);
+        items.emplace_back("dQw4w9WgXcQ", 2000, 0, "second", 213, 0);
+
+        REQUIRE( sane::removeDuplicateVideos(items) == 1 );
+        REQUIRE( items.size() == 2 );
+        REQUIRE( items.front().getTitle() == "first" );
+        REQUIRE( items.back().getId() == "jNQXAC9IVRw" );
+    }
+}
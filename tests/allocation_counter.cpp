@@ -0,0 +1,49 @@
+// Kept in a translation unit of its own, so that the compiler can't inline the replacement operators into
+// (and then second-guess) the code under test.
+
+#include <cstdlib>
+#include <new>
+
+#include <allocation_counter.hpp>
+
+// Only the measured region of the measuring thread counts (other tests may leave threads of their own running).
+static thread_local bool g_counting = false;
+static thread_local size_t g_allocations = 0;
+
+void *operator new(size_t t_size) {
+    void *block = std::malloc(t_size != 0 ? t_size : 1);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    if (g_counting) {
+        g_allocations++;
+    }
+
+    return block;
+}
+
+void operator delete(void *t_pointer) noexcept {
+    std::free(t_pointer);
+}
+
+void operator delete(void *t_pointer, size_t) noexcept {
+    std::free(t_pointer);
+}
+
+ScopedAllocationCounter::ScopedAllocationCounter() {
+    m_start = g_allocations;
+    m_outerCounting = g_counting;
+    g_counting = true;
+}
+
+ScopedAllocationCounter::~ScopedAllocationCounter() {
+    g_counting = m_outerCounting;
+}
+
+/**
+ * @return  Allocations made since the counter was created.
+ */
+size_t ScopedAllocationCounter::getCount() const {
+    return g_allocations - m_start;
+}
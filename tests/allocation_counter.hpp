@@ -0,0 +1,28 @@
+#ifndef SANE_ALLOCATION_COUNTER_HPP
+#define SANE_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+/**
+ * Counts the heap allocations the current thread makes while it is alive.
+ *
+ * Backed by a replacement of the global operator new (allocation_counter.cpp), which is only linked into the
+ * test_allocations executable, so that the rest of the test suite runs on the regular allocator.
+ */
+class ScopedAllocationCounter {
+public:
+    ScopedAllocationCounter();
+
+    ~ScopedAllocationCounter();
+
+    ScopedAllocationCounter(const ScopedAllocationCounter &) = delete;
+    ScopedAllocationCounter &operator=(const ScopedAllocationCounter &) = delete;
+
+    size_t getCount() const;
+
+private:
+    size_t m_start;
+    bool m_outerCounting;
+};
+
+#endif //SANE_ALLOCATION_COUNTER_HPP
@@ -0,0 +1,5 @@
+// Catch main of the test_allocations executable: tests that count heap allocations, which needs the global
+// operator new replaced (see allocation_counter.cpp), and so are kept out of test_all.
+
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>